@@ -0,0 +1,175 @@
+/**
+ * @file camera_channel.cpp
+ * @brief Non-blocking, bounded request queue towards the camera server.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+
+#include <algorithm>
+
+#include "camera_channel.hpp"
+
+constexpr size_t CameraChannel::DEFAULT_QUEUE_SIZE;
+
+static bool is_trigger(const camera_request &request) {
+    return !strcmp(request.action, "TRIGGER");
+}
+
+static bool same_target(const camera_request &a, const camera_request &b) {
+    return !strcmp(a.action, b.action) && !strcmp(a.command, b.command);
+}
+
+CameraChannel::CameraChannel(CameraTransport *client, size_t max_queue, Policy policy) :
+    client(client),
+    max_queue(max_queue),
+    policy(policy),
+    running(false),
+    writing(false),
+    stats{}
+{
+}
+
+CameraChannel::~CameraChannel() {
+    stop();
+}
+
+void CameraChannel::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return;
+    }
+
+    client->async_mode();
+    running = true;
+    thread = std::thread(&CameraChannel::run, this);
+}
+
+void CameraChannel::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_one();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+/* Must be called with mutex held */
+bool CameraChannel::coalesce(const camera_request &request) {
+    if (is_trigger(request)) {
+        return false;
+    }
+
+    auto it = std::find_if(queue.begin(), queue.end(),
+            [&request](const camera_request &r) { return same_target(r, request); });
+    if (it == queue.end()) {
+        return false;
+    }
+
+    // GET: the pending one answers both. SET: only the latest value matters.
+    if (!strcmp(request.action, "SET")) {
+        it->value = request.value;
+        it->timestamp = request.timestamp;
+    }
+    stats.coalesced++;
+    return true;
+}
+
+/* Must be called with mutex held */
+bool CameraChannel::make_room(const camera_request &request) {
+    if (queue.size() < max_queue) {
+        return true;
+    }
+
+    if (policy == Policy::DROP_NEWEST && !is_trigger(request)) {
+        return false;
+    }
+
+    // The front is being written right now, it is not ours to drop anymore.
+    auto first = queue.begin() + (writing ? 1 : 0);
+    auto victim = std::find_if(first, queue.end(),
+            [](const camera_request &r) { return !is_trigger(r); });
+    if (victim == queue.end()) {
+        // Queue is all triggers, the camera is not keeping up at all.
+        return false;
+    }
+
+    fprintf(stderr, "Camera queue full, dropping %s %s\n", victim->action, victim->command);
+    queue.erase(victim);
+    stats.dropped++;
+    return true;
+}
+
+bool CameraChannel::submit(const camera_request &request) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (coalesce(request)) {
+        return true;
+    }
+
+    if (!make_room(request)) {
+        fprintf(stderr, "Camera queue full, dropping %s %s\n", request.action, request.command);
+        stats.dropped++;
+        return false;
+    }
+
+    queue.push_back(request);
+    stats.submitted++;
+    stats.max_depth = std::max(stats.max_depth, queue.size());
+    cond.notify_one();
+    return true;
+}
+
+ssize_t CameraChannel::read(camera_responce *responce, int timeout_ms) {
+    if (!client->wait(POLLIN, timeout_ms)) {
+        return 0;
+    }
+    return client->read(responce, sizeof(*responce));
+}
+
+CameraChannel::Stats CameraChannel::get_stats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void CameraChannel::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (running) {
+        if (queue.empty()) {
+            cond.wait(lock);
+            continue;
+        }
+
+        // Copy out, the queue may be coalesced or trimmed while we wait.
+        camera_request request = queue.front();
+        writing = true;
+        lock.unlock();
+
+        bool writable = client->wait(POLLOUT, POLL_TIMEOUT_MS);
+        ssize_t ret = writable ? client->write(&request, sizeof(request)) : -1;
+
+        lock.lock();
+        writing = false;
+        if (!writable || (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) {
+            continue;
+        }
+
+        // A SET merged into the front while we wrote keeps its newer value queued.
+        if (!queue.empty() && same_target(queue.front(), request) &&
+            queue.front().value == request.value) {
+            queue.pop_front();
+        }
+
+        if (ret < 0) {
+            fprintf(stderr, "Camera write failed: %s\n", strerror(errno));
+            stats.write_errors++;
+        } else {
+            stats.written++;
+        }
+    }
+}
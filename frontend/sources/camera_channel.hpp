@@ -0,0 +1,81 @@
+/**
+ * @file camera_channel.hpp
+ * @brief Non-blocking, bounded request queue towards the camera server.
+ */
+
+#ifndef __CAMERA_CHANNEL_HPP__
+#define __CAMERA_CHANNEL_HPP__
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "camera_transport.hpp"
+#include "camera_protocol.hpp"
+
+/*
+ * Requests are queued by the MAVLink io thread and written by a dedicated
+ * thread, so a stalled camera server can only fill the queue, never block
+ * FCU message handling.
+ *
+ * Pending GETs for the same parameter are merged, a pending SET is updated
+ * in place with the newer value. Triggers are never merged and are the last
+ * thing dropped when the queue is full.
+ */
+class CameraChannel {
+public:
+    // What to give up when the queue is full and a new request arrives.
+    enum class Policy {
+        DROP_NEWEST,    // reject the new request
+        DROP_OLDEST,    // evict the oldest request that is not a trigger
+    };
+
+    struct Stats {
+        size_t submitted;   // requests accepted into the queue
+        size_t written;     // requests written to the socket
+        size_t coalesced;   // requests merged into a pending one
+        size_t dropped;     // requests lost to the queue limit
+        size_t write_errors;
+        size_t max_depth;   // high-water mark of the queue
+    };
+
+    static constexpr size_t DEFAULT_QUEUE_SIZE = 32;
+    // Write readiness is re-checked at this period so stop() is noticed.
+    static constexpr int POLL_TIMEOUT_MS = 100;
+
+    CameraChannel(CameraTransport *client, size_t max_queue = DEFAULT_QUEUE_SIZE,
+                  Policy policy = Policy::DROP_OLDEST);
+    ~CameraChannel();
+
+    void start();
+    void stop();
+
+    /* Queue a request, never blocks. Returns false if it was dropped. */
+    bool submit(const camera_request &request);
+
+    /* Wait up to timeout_ms for a responce, returns bytes read or <= 0. */
+    ssize_t read(camera_responce *responce, int timeout_ms = -1);
+
+    Stats get_stats();
+
+private:
+    CameraTransport *client;
+    size_t max_queue;
+    Policy policy;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread thread;
+    bool running;
+    bool writing;
+
+    std::deque<camera_request> queue;
+    Stats stats;
+
+    bool coalesce(const camera_request &request);
+    bool make_room(const camera_request &request);
+    void run();
+};
+
+#endif // __CAMERA_CHANNEL_HPP__
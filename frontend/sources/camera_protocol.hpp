@@ -0,0 +1,41 @@
+/**
+ * @file camera_protocol.hpp
+ * @brief Request/responce records exchanged with the camera server.
+ */
+
+#ifndef __CAMERA_PROTOCOL_HPP__
+#define __CAMERA_PROTOCOL_HPP__
+
+#include <stdint.h>
+
+#include "boost/date_time/posix_time/posix_time.hpp"
+
+/*
+ * Sent by the bridge with action "TRANSPORT" right after INITIALIZE, with the
+ * shared-memory descriptors attached (SCM_RIGHTS). The camera server answers
+ * on the socket with result 0 and from then on serves the rings instead.
+ */
+#define CAMERA_SHM_ATTACH "SHM_ATTACH"
+
+struct camera_request
+{
+    char command[100];
+    char action[100];
+    uint8_t value = 0;
+    uint8_t param_type;
+    uint16_t param_index;
+    boost::posix_time::ptime timestamp;
+};
+
+struct camera_responce
+{
+    char command[100];
+    char action[100];
+    uint8_t value = 0;
+    int result = -1;
+    uint8_t param_type;
+    uint16_t param_index;
+    boost::posix_time::ptime timestamp;
+};
+
+#endif // __CAMERA_PROTOCOL_HPP__
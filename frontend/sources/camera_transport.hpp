@@ -0,0 +1,27 @@
+/**
+ * @file camera_transport.hpp
+ * @brief Byte transport between the bridge and the camera server.
+ */
+
+#ifndef __CAMERA_TRANSPORT_HPP__
+#define __CAMERA_TRANSPORT_HPP__
+
+#include <sys/types.h>
+
+/*
+ * One call to write() is one request, one call to read() is one responce,
+ * whatever carries them.
+ */
+class CameraTransport {
+public:
+    virtual ~CameraTransport() {}
+
+    /* Switch read/write to non-blocking, use wait() to block. */
+    virtual void async_mode() = 0;
+    /* Wait for POLLIN and/or POLLOUT readiness, true if ready. */
+    virtual bool wait(short events, int timeout_ms) = 0;
+    virtual ssize_t read(void *buf, size_t count) = 0;
+    virtual ssize_t write(const void *buf, size_t count) = 0;
+};
+
+#endif // __CAMERA_TRANSPORT_HPP__
@@ -0,0 +1,337 @@
+/**
+ * @file event_server.cpp
+ * @brief Multi-client epoll server for the camera socket protocol.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "socket.hpp"
+#include "event_server.hpp"
+
+constexpr size_t EventSocketServer::MAX_PACKET_SIZE;
+constexpr size_t EventSocketServer::MAX_CLIENT_QUEUE;
+
+EventSocketServer::EventSocketServer(const char *name) :
+    listen_fd(-1),
+    epoll_fd(-1),
+    wake_fd(-1),
+    running(false),
+    rx_buf(MAX_PACKET_SIZE),
+    stats{}
+{
+    struct sockaddr_un addr;
+    size_t addr_len = 0;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_path[0] = 0;
+    addr_len += snprintf(&addr.sun_path[1], sizeof(addr.sun_path) - 1, "%s", name);
+    addr.sun_family = AF_LOCAL;
+    addr_len += offsetof(struct sockaddr_un, sun_path) + 1;
+
+    listen_fd = socket(AF_LOCAL, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0 ||
+            bind(listen_fd, (struct sockaddr *)&addr, addr_len) < 0 ||
+            listen(listen_fd, 10) < 0) {
+        fprintf(stderr, "Cannot listen on %s: %s\n", name, strerror(errno));
+        return;
+    }
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = listen_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+    ev.data.fd = wake_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev);
+}
+
+EventSocketServer::~EventSocketServer() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    for (auto &kv : clients) {
+        close(kv.first);
+    }
+    clients.clear();
+
+    for (int fd : {listen_fd, epoll_fd, wake_fd}) {
+        if (-1 != fd) {
+            close(fd);
+        }
+    }
+}
+
+bool EventSocketServer::is_open() {
+    return -1 != epoll_fd && -1 != wake_fd;
+}
+
+void EventSocketServer::stop() {
+    running = false;
+    uint64_t one = 1;
+    ssize_t ret = ::write(wake_fd, &one, sizeof(one));
+    (void)ret;
+}
+
+void EventSocketServer::run() {
+    struct epoll_event events[16];
+    running = true;
+
+    while (running) {
+        int n = epoll_wait(epoll_fd, events, 16, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fprintf(stderr, "epoll_wait: %s\n", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < n && running; i++) {
+            int fd = events[i].data.fd;
+            uint32_t revents = events[i].events;
+
+            if (fd == wake_fd) {
+                uint64_t counter;
+                ssize_t ret = ::read(wake_fd, &counter, sizeof(counter));
+                (void)ret;
+            } else if (fd == listen_fd) {
+                do_accept();
+            } else {
+                WatchCb watch_cb;
+                {
+                    std::lock_guard<std::recursive_mutex> lock(mutex);
+                    auto it = watches.find(fd);
+                    if (it != watches.end()) {
+                        watch_cb = it->second;
+                    }
+                }
+
+                if (watch_cb) {
+                    watch_cb();
+                    continue;
+                }
+
+                if (revents & EPOLLIN) {
+                    do_read(fd);
+                } else if (revents & (EPOLLHUP | EPOLLERR)) {
+                    close_client(fd);
+                }
+                if (revents & EPOLLOUT) {
+                    do_write(fd);
+                }
+            }
+        }
+    }
+}
+
+void EventSocketServer::do_accept() {
+    int fd;
+    while ((fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex);
+            Client &c = clients[fd];
+            c.want_write = false;
+
+            struct epoll_event ev;
+            memset(&ev, 0, sizeof(ev));
+            ev.events = EPOLLIN;
+            ev.data.fd = fd;
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+            stats.accepted++;
+        }
+
+        if (on_connect) {
+            on_connect(fd);
+        }
+    }
+}
+
+void EventSocketServer::do_read(ClientId client) {
+    int fds[MAX_PASSED_FDS];
+    int nfds = MAX_PASSED_FDS;
+
+    // SOCK_SEQPACKET: one read is one whole request
+    ssize_t ret = recv_with_fds(client, rx_buf.data(), rx_buf.size(), fds, &nfds);
+    if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return;
+    }
+    if (ret <= 0) {
+        close_client(client);
+        return;
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        stats.packets_in++;
+    }
+
+    if (on_request) {
+        on_request(client, rx_buf.data(), ret, fds, nfds);
+    } else {
+        for (int i = 0; i < nfds; i++) {
+            close(fds[i]);
+        }
+    }
+}
+
+/* Must be called with mutex held */
+void EventSocketServer::update_events(ClientId client, Client &c) {
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    if (c.want_write) {
+        ev.events |= EPOLLOUT;
+    }
+    ev.data.fd = client;
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, client, &ev);
+}
+
+void EventSocketServer::do_write(ClientId client) {
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        auto it = clients.find(client);
+        if (it == clients.end()) {
+            return;
+        }
+
+        Client &c = it->second;
+        bool failed = false;
+        while (!c.tx_q.empty()) {
+            auto &pkt = c.tx_q.front();
+            ssize_t ret = ::send(client, pkt.data(), pkt.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                return;
+            }
+            if (ret < 0) {
+                failed = true;
+                break;
+            }
+
+            c.tx_q.pop_front();
+            stats.packets_out++;
+        }
+
+        if (!failed) {
+            c.want_write = false;
+            update_events(client, c);
+            return;
+        }
+    }
+
+    // Outside the lock, on_disconnect may take locks of its own
+    close_client(client);
+}
+
+bool EventSocketServer::send(ClientId client, const void *buf, size_t count) {
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        auto it = clients.find(client);
+        if (it == clients.end()) {
+            return false;
+        }
+
+        Client &c = it->second;
+        bool failed = false;
+        if (c.tx_q.empty()) {
+            // Fast path, nothing queued in front of us
+            ssize_t ret = ::send(client, buf, count, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (ret >= 0) {
+                stats.packets_out++;
+                return true;
+            }
+            failed = errno != EAGAIN && errno != EWOULDBLOCK;
+        }
+
+        if (!failed) {
+            if (c.tx_q.size() >= MAX_CLIENT_QUEUE) {
+                stats.dropped++;
+                return false;
+            }
+
+            const uint8_t *bytes = static_cast<const uint8_t *>(buf);
+            c.tx_q.emplace_back(bytes, bytes + count);
+            if (!c.want_write) {
+                c.want_write = true;
+                update_events(client, c);
+            }
+            return true;
+        }
+    }
+
+    // Outside the lock, on_disconnect may take locks of its own
+    close_client(client);
+    return false;
+}
+
+void EventSocketServer::broadcast(const void *buf, size_t count) {
+    // send() may drop a client from the map, iterate over a snapshot
+    std::vector<ClientId> ids;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        for (auto &kv : clients) {
+            ids.push_back(kv.first);
+        }
+    }
+    for (ClientId id : ids) {
+        send(id, buf, count);
+    }
+}
+
+void EventSocketServer::disconnect(ClientId client) {
+    close_client(client);
+}
+
+void EventSocketServer::close_client(ClientId client) {
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        auto it = clients.find(client);
+        if (it == clients.end()) {
+            return;
+        }
+
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, client, NULL);
+        close(client);
+        clients.erase(it);
+    }
+
+    if (on_disconnect) {
+        on_disconnect(client);
+    }
+}
+
+bool EventSocketServer::watch(int fd, WatchCb cb) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        return false;
+    }
+
+    watches[fd] = cb;
+    return true;
+}
+
+void EventSocketServer::unwatch(int fd) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (watches.erase(fd)) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    }
+}
+
+EventSocketServer::Stats EventSocketServer::get_stats() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    Stats ret = stats;
+    ret.clients = clients.size();
+    return ret;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file event_server.hpp
+ * @brief Multi-client epoll server for the camera socket protocol.
+ */
+
+#ifndef __EVENT_SERVER_HPP__
+#define __EVENT_SERVER_HPP__
+
+#include <stdint.h>
+#include <sys/un.h>
+
+#include <map>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+
+/*
+ * Listens on the same abstract AF_LOCAL/SOCK_SEQPACKET address as
+ * SocketServer, but serves any number of clients (bridge, logger,
+ * diagnostics) from one epoll loop. Every client has its own bounded
+ * outbound queue, so a client that stops reading only loses its own
+ * packets.
+ *
+ * run() blocks and dispatches all callbacks from the calling thread.
+ * send(), broadcast() and stop() may be called from any thread, but not
+ * with a lock that on_disconnect takes: a failed send closes the client
+ * and calls on_disconnect on the sending thread. No callback is called
+ * with the server's own lock held.
+ */
+class EventSocketServer {
+public:
+    using ClientId = int;
+    using RequestCb = std::function<void (ClientId client, const void *buf, size_t count,
+                                          const int *fds, int nfds)>;
+    using ClientCb = std::function<void (ClientId client)>;
+    using WatchCb = std::function<void (void)>;
+
+    static constexpr size_t MAX_PACKET_SIZE = 4096;
+    static constexpr size_t MAX_CLIENT_QUEUE = 256;
+    static constexpr int MAX_PASSED_FDS = 8;
+
+    struct Stats {
+        size_t clients;
+        size_t accepted;
+        size_t packets_in;
+        size_t packets_out;
+        size_t dropped;     // outbound packets lost to full client queues
+    };
+
+    EventSocketServer(const char *name);
+    ~EventSocketServer();
+
+    bool is_open();
+    void run();
+    void stop();
+
+    /* Queue a packet for one client. false if the client is gone or its queue is full. */
+    bool send(ClientId client, const void *buf, size_t count);
+    /* Queue a packet for every connected client, e.g. camera events. */
+    void broadcast(const void *buf, size_t count);
+    void disconnect(ClientId client);
+
+    /* Add an extra descriptor to the loop, cb runs when it becomes readable. */
+    bool watch(int fd, WatchCb cb);
+    void unwatch(int fd);
+
+    Stats get_stats();
+
+    RequestCb on_request;
+    ClientCb on_connect;
+    ClientCb on_disconnect;
+
+private:
+    struct Client {
+        std::deque<std::vector<uint8_t> > tx_q;
+        bool want_write;
+    };
+
+    int listen_fd;
+    int epoll_fd;
+    int wake_fd;
+    std::atomic<bool> running;
+
+    std::recursive_mutex mutex;
+    std::map<ClientId, Client> clients;
+    std::map<int, WatchCb> watches;
+    std::vector<uint8_t> rx_buf;
+    Stats stats;
+
+    void do_accept();
+    void do_read(ClientId client);
+    void do_write(ClientId client);
+    void close_client(ClientId client);
+    void update_events(ClientId client, Client &c);
+};
+
+#endif // __EVENT_SERVER_HPP__
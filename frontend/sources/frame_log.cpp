@@ -0,0 +1,257 @@
+/**
+ * @file frame_log.cpp
+ * @brief Asynchronous diagnostics log of MAVLink frames.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#include <chrono>
+#include <sstream>
+
+#include "frame_log.hpp"
+
+constexpr size_t FrameLog::RING_SIZE;
+
+static_assert((FrameLog::RING_SIZE & (FrameLog::RING_SIZE - 1)) == 0, "RING_SIZE must be a power of two");
+
+FrameLog::FrameLog(FILE *out, Format format) :
+    out(out),
+    format(format),
+    default_level(Level::OFF),
+    ring(RING_SIZE),
+    enqueue_pos(0),
+    dequeue_pos(0),
+    n_dropped(0),
+    consumer_waiting(false),
+    running(false)
+{
+    for (size_t i = 0; i < RING_SIZE; i++) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+FrameLog::~FrameLog() {
+    stop();
+}
+
+void FrameLog::set_format(Format format) {
+    this->format = format;
+}
+
+void FrameLog::set_default_level(Level level) {
+    default_level = level;
+}
+
+void FrameLog::set_level(mavlink::msgid_t msgid, Level level) {
+    levels[msgid] = level;
+}
+
+void FrameLog::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return;
+    }
+    running = true;
+    thread = std::thread(&FrameLog::run, this);
+}
+
+void FrameLog::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_one();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+FrameLog::Level FrameLog::level_of(mavlink::msgid_t msgid) const {
+    auto it = levels.find(msgid);
+    return it != levels.end() ? it->second : default_level;
+}
+
+void FrameLog::log(const mavlink::mavlink_message_t *msg, Direction dir) {
+    if (level_of(msg->msgid) == Level::OFF) {
+        return;
+    }
+
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+        slot = &ring[pos & (RING_SIZE - 1)];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+        if (dif == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            // Ring full, the formatter is behind
+            n_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    slot->dir = dir;
+    memcpy(&slot->msg, msg, offsetof(mavlink::mavlink_message_t, payload64) + msg->len);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    if (consumer_waiting.load(std::memory_order_relaxed)) {
+        cond.notify_one();
+    }
+}
+
+bool FrameLog::pop(Slot *&slot) {
+    slot = &ring[dequeue_pos & (RING_SIZE - 1)];
+    return slot->sequence.load(std::memory_order_acquire) == dequeue_pos + 1;
+}
+
+void FrameLog::release(Slot *slot) {
+    slot->sequence.store(dequeue_pos + RING_SIZE, std::memory_order_release);
+    dequeue_pos++;
+}
+
+/* Escape a string for a JSON string literal */
+static void json_escape(std::string &dst, const std::string &src) {
+    for (unsigned char c : src) {
+        if (c == '"' || c == '\\') {
+            dst += '\\';
+            dst += c;
+        } else if (c < 0x20 || c >= 0x7f) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            dst += buf;
+        } else {
+            dst += c;
+        }
+    }
+}
+
+/* "  key: value" lines of to_yaml() as JSON members */
+static void yaml_to_json(std::string &dst, const std::string &yaml) {
+    std::istringstream lines(yaml);
+    std::string line;
+    bool first = true;
+
+    while (std::getline(lines, line)) {
+        if (line.compare(0, 2, "  ") != 0) {
+            continue;   // "NAME:" line
+        }
+        size_t colon = line.find(": ");
+        if (colon == std::string::npos) {
+            continue;
+        }
+
+        std::string key = line.substr(2, colon - 2);
+        std::string value = line.substr(colon + 2);
+
+        dst += first ? "\"" : ",\"";
+        dst += key;
+        dst += "\":";
+        first = false;
+
+        char *end;
+        strtod(value.c_str(), &end);
+        if (!value.empty() && *end == '\0') {
+            dst += value;
+        } else if (!value.empty() && value[0] == '[') {
+            dst += value;
+        } else {
+            if (value.size() >= 2 && value[0] == '"') {
+                value = value.substr(1, value.size() - 2);
+            }
+            dst += '"';
+            json_escape(dst, value);
+            dst += '"';
+        }
+    }
+}
+
+void FrameLog::write(const Slot &slot) {
+    const mavlink::mavlink_message_t *msg = &slot.msg;
+    Level level = level_of(msg->msgid);
+    auto dec = decoders.find(msg->msgid);
+    const char *name = dec != decoders.end() ? dec->second.name : "UNKNOWN";
+    std::string fields;
+    if (level == Level::FULL && dec != decoders.end()) {
+        fields = dec->second.yaml(msg);
+    }
+
+    unsigned long long sec = slot.time_us / 1000000, usec = slot.time_us % 1000000;
+    const char *dir = slot.dir == Direction::IN ? "in" : "out";
+
+    switch (format) {
+    case Format::TEXT:
+    {
+        fprintf(out, "%llu.%06llu %-3s %u/%u %s (%u) seq %u len %u", sec, usec, dir,
+                msg->sysid, msg->compid, name, msg->msgid, msg->seq, msg->len);
+        std::istringstream lines(fields);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.compare(0, 2, "  ") == 0) {
+                fprintf(out, " %s", line.c_str() + 2);
+            }
+        }
+        fputc('\n', out);
+        break;
+    }
+
+    case Format::YAML:
+        fprintf(out, "---\ntime: %llu.%06llu\ndir: %s\nsysid: %u\ncompid: %u\nseq: %u\nmsgid: %u\nlen: %u\n",
+                sec, usec, dir, msg->sysid, msg->compid, msg->seq, msg->msgid, msg->len);
+        if (!fields.empty()) {
+            fputs(fields.c_str(), out);
+        }
+        break;
+
+    case Format::JSON:
+    {
+        std::string json;
+        yaml_to_json(json, fields);
+        fprintf(out, "{\"time\":%llu.%06llu,\"dir\":\"%s\",\"sysid\":%u,\"compid\":%u,\"seq\":%u,"
+                "\"msgid\":%u,\"len\":%u,\"name\":\"%s\",\"fields\":{%s}}\n",
+                sec, usec, dir, msg->sysid, msg->compid, msg->seq, msg->msgid, msg->len, name, json.c_str());
+        break;
+    }
+    }
+}
+
+void FrameLog::run() {
+    size_t reported_drops = 0;
+
+    for (;;) {
+        Slot *slot;
+        if (pop(slot)) {
+            write(*slot);
+            release(slot);
+            continue;
+        }
+
+        // Drained: flush once instead of after every line
+        size_t drops = n_dropped.load(std::memory_order_relaxed);
+        if (drops != reported_drops) {
+            fprintf(out, "# frame log: %zu frames dropped\n", drops - reported_drops);
+            reported_drops = drops;
+        }
+        fflush(out);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!running) {
+            break;
+        }
+        consumer_waiting.store(true);
+        if (!pop(slot)) {
+            // Timed, a producer does not take the lock to notify
+            cond.wait_for(lock, std::chrono::milliseconds(50));
+        }
+        consumer_waiting.store(false);
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file frame_log.hpp
+ * @brief Asynchronous diagnostics log of MAVLink frames.
+ */
+
+#ifndef __FRAME_LOG_HPP__
+#define __FRAME_LOG_HPP__
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+
+#include <mavconn/interface.h>
+
+/*
+ * The io thread only copies the frame into a lock-free ring (bounded MPMC
+ * queue, sequence number per slot). Decoding, formatting and writing
+ * happen on a background thread. When the ring is full frames are dropped
+ * and counted, the producer never waits.
+ *
+ * Verbosity is per msgid and has to be configured before start().
+ */
+class FrameLog {
+public:
+    enum class Format : uint8_t {
+        TEXT,   // one line per frame
+        YAML,   // same output as Message::to_yaml()
+        JSON,   // one object per line
+    };
+
+    enum class Level : uint8_t {
+        OFF,
+        BRIEF,  // header only: time, ids, msgid, seq, length
+        FULL,   // decoded fields, for registered message types
+    };
+
+    enum class Direction : uint8_t {
+        IN,
+        OUT,
+    };
+
+    static constexpr size_t RING_SIZE = 256;    // power of two
+
+    // Decodes one message type to YAML
+    using YamlFn = std::function<std::string (const mavlink::mavlink_message_t *msg)>;
+
+    FrameLog(FILE *out = stdout, Format format = Format::YAML);
+    ~FrameLog();
+
+    void set_format(Format format);
+    void set_default_level(Level level);
+    void set_level(mavlink::msgid_t msgid, Level level);
+
+    /* Let FULL decode messages of type Msg. */
+    template<typename Msg>
+    void register_type() {
+        mavlink::msgid_t msgid = Msg::MSG_ID;
+        decoders[msgid] = Decoder{Msg::NAME, [](const mavlink::mavlink_message_t *msg) {
+            Msg obj;
+            mavlink::MsgMap map(msg);
+            obj.deserialize(map);
+            return obj.to_yaml();
+        }};
+    }
+
+    void start();
+    void stop();
+
+    /* Hot path, called from the io thread. Never blocks. */
+    void log(const mavlink::mavlink_message_t *msg, Direction dir = Direction::IN);
+
+    size_t dropped() const { return n_dropped; }
+
+private:
+    struct Decoder {
+        const char *name;
+        YamlFn yaml;
+    };
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        uint64_t time_us;
+        Direction dir;
+        mavlink::mavlink_message_t msg;     // header and the first len payload bytes only
+    };
+
+    FILE *out;
+    Format format;
+    Level default_level;
+    std::unordered_map<mavlink::msgid_t, Level> levels;
+    std::unordered_map<mavlink::msgid_t, Decoder> decoders;
+
+    std::vector<Slot> ring;
+    std::atomic<size_t> enqueue_pos;
+    size_t dequeue_pos;
+    std::atomic<size_t> n_dropped;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<bool> consumer_waiting;
+    std::thread thread;
+    bool running;
+
+    Level level_of(mavlink::msgid_t msgid) const;
+    bool pop(Slot *&slot);
+    void release(Slot *slot);
+    void write(const Slot &slot);
+    void run();
+};
+
+#endif // __FRAME_LOG_HPP__
@@ -0,0 +1,117 @@
+/**
+ * @file heartbeat.cpp
+ * @brief Fixed-rate camera heartbeat from a pre-encoded frame.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "heartbeat.hpp"
+
+constexpr double HeartbeatEmitter::DEFAULT_RATE;
+
+HeartbeatEmitter::HeartbeatEmitter(mavconn::MAVConnInterface::Ptr link,
+                                   const mavlink::common::msg::HEARTBEAT &hb,
+                                   std::mutex &seq_mutex) :
+    link(link),
+    seq_mutex(seq_mutex),
+    running(false),
+    frame(link->get_system_id(), link->get_component_id(), hb),
+    n_sent(0),
+    n_dropped(0),
+    n_no_remote(0)
+{
+    set_rate(DEFAULT_RATE);
+}
+
+HeartbeatEmitter::~HeartbeatEmitter() {
+    stop();
+}
+
+void HeartbeatEmitter::set_rate(double hz) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Below one per 5 s a GCS declares the component lost
+    if (hz < 0.2) {
+        hz = 0.2;
+    }
+    period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / hz));
+    cond.notify_one();
+}
+
+void HeartbeatEmitter::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return;
+    }
+    running = true;
+    thread = std::thread(&HeartbeatEmitter::run, this);
+}
+
+void HeartbeatEmitter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_one();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+size_t HeartbeatEmitter::sent() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_sent;
+}
+
+size_t HeartbeatEmitter::dropped() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_dropped;
+}
+
+size_t HeartbeatEmitter::no_remote() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_no_remote;
+}
+
+void HeartbeatEmitter::emit() {
+    // Shares the sequence with every other frame finalized on channel 0,
+    // queued under the same lock so the sequence stays in order on the wire
+    std::lock_guard<std::mutex> lock(seq_mutex);
+    mavlink::mavlink_status_t *status = mavlink::mavlink_get_channel_status(mavlink::MAVLINK_COMM_0);
+    size_t len = frame.finalize(status);
+
+    // A stalled link drops this one, the next heartbeat will try again
+    switch (link->try_send_bytes(frame.data(), len)) {
+    case mavconn::SendStatus::queued:
+        n_sent++;
+        break;
+    case mavconn::SendStatus::no_remote:
+        // Nobody connected yet, nothing was lost
+        n_no_remote++;
+        break;
+    default:
+        n_dropped++;
+        break;
+    }
+}
+
+void HeartbeatEmitter::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    clock::time_point next = clock::now();
+
+    while (running) {
+        clock::time_point now = clock::now();
+        if (now < next) {
+            cond.wait_until(lock, next);
+            continue;
+        }
+
+        emit();
+
+        // Keep the phase, but do not burst to catch up after a stall
+        next += period;
+        if (next < now) {
+            next = now + period;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/**
+ * @file heartbeat.hpp
+ * @brief Fixed-rate camera heartbeat from a pre-encoded frame.
+ */
+
+#ifndef __HEARTBEAT_HPP__
+#define __HEARTBEAT_HPP__
+
+#include <stdint.h>
+
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+#include <mavconn/interface.h>
+#include <mavconn/msgtemplate.h>
+
+/*
+ * Sends the camera HEARTBEAT at its own pace instead of echoing the FCU's.
+ * The frame is encoded once; each emission only writes the sequence byte
+ * and redoes the CRC (see mavconn::MsgTemplate).
+ */
+class HeartbeatEmitter {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr double DEFAULT_RATE = 1.0;   // Hz, what GCSs expect
+
+    // seq_mutex guards the channel 0 sequence, shared with every other frame finalized on it
+    HeartbeatEmitter(mavconn::MAVConnInterface::Ptr link, const mavlink::common::msg::HEARTBEAT &hb,
+                     std::mutex &seq_mutex);
+    ~HeartbeatEmitter();
+
+    void set_rate(double hz);
+    void start();
+    void stop();
+
+    // Heartbeats handed to the link / lost to a full TX queue /
+    // not sent because no peer was connected yet.
+    size_t sent();
+    size_t dropped();
+    size_t no_remote();
+
+private:
+    mavconn::MAVConnInterface::Ptr link;
+    std::mutex &seq_mutex;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread thread;
+    bool running;
+    clock::duration period;
+
+    mavconn::MsgTemplate<mavlink::common::msg::HEARTBEAT> frame;
+    size_t n_sent;
+    size_t n_dropped;
+    size_t n_no_remote;
+
+    void emit();
+    void run();
+};
+
+#endif // __HEARTBEAT_HPP__
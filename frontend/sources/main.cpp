@@ -20,6 +20,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <stddef.h>
 #include <poll.h>
 #include <limits.h>
 
@@ -32,145 +33,176 @@
 #include <sys/time.h>
 
 #include <mavconn/interface.h>
+#include <mavconn/msgtemplate.h>
+#include <mavconn/wire.h>
+#include <mavconn/trace.h>
+#include <mavconn/router.h>
+#include <mavconn/replay.h>
 #include "boost/date_time/posix_time/posix_time.hpp"
 #include "socket.hpp"
+#include "camera_protocol.hpp"
+#include "camera_channel.hpp"
+#include "shm_ring.hpp"
+#include "param_stream.hpp"
+#include "mock_camera.hpp"
+#include "heartbeat.hpp"
+#include "frame_log.hpp"
 
 using mavconn::MAVConnInterface;
 using mavconn::Framing;
 using mavlink::mavlink_message_t;
 
-#define NUMBER_OF_CAMERA_PARAMETERS 4
 #define OPTCMP(value, str, COMMAND) if (!strcmp(str, argv[1])) { value = COMMAND; }
 
-struct camera_request
-{
-    char command[100];
-    char action[100];
-    uint8_t value = 0;
-    uint8_t param_type;
-    uint16_t param_index;
-    boost::posix_time::ptime timestamp;
-};
-
-struct camera_responce
-{
-    char command[100];
-    char action[100];
-    uint8_t value = 0;
-    int result = -1;
-    uint8_t param_type;
-    uint16_t param_index;
-    boost::posix_time::ptime timestamp;
+/* Payload offset and size of a field, from the generated wire layouts */
+#define WIRE_OFFSET(MSG, FIELD) offsetof(mavconn::wire::common::MSG, FIELD)
+#define WIRE_SIZE(MSG, FIELD) sizeof(mavconn::wire::common::MSG::FIELD)
+
+/* Parameters exposed by the camera, position is the MAVLink param_index */
+static const std::vector<std::string> camera_parameters = {
+    "EXPOSURE_MODE",
+    "ISO",
+    "SHUTTERSPD",
+    "APERTURE",
+    "WHITE_BALANCE",
+    "EXPOSURE_COMP",
+    "COMPR_SETTING",
 };
 
-void get_camera_parameter(std::string param_id_str, SocketClient *main_client)
+void get_camera_parameter(std::string param_id_str, uint16_t param_index, CameraChannel *camera_channel)
 {
     camera_request *request = new camera_request{};
     strcpy(request->command, param_id_str.c_str());
     snprintf(request->action, sizeof(request->action), "GET");
     request->param_type = static_cast<uint8_t>(mavlink::common::MAV_PARAM_TYPE::UINT8);
+    request->param_index = param_index;
     request->timestamp = boost::posix_time::microsec_clock::local_time();
-    main_client->write(request, sizeof(*request));
+    camera_channel->submit(*request);
     delete request;
 }
 
-uint8_t set_camera_parameter(std::string param_id_str, SocketClient *main_client, uint8_t data) {
+void set_camera_parameter(std::string param_id_str, CameraChannel *camera_channel, uint8_t data) {
     camera_request *request = new camera_request{};
     strcpy(request->command, param_id_str.c_str());
     snprintf(request->action, sizeof(request->action), "SET");
     request->value = data;
     request->param_type = static_cast<uint8_t>(mavlink::common::MAV_PARAM_TYPE::UINT8);
     request->timestamp = boost::posix_time::microsec_clock::local_time();
-    main_client->write(request, sizeof(*request));
+    camera_channel->submit(*request);
     delete request;
 }
 
+/* Reply frames are encoded once, a responce only patches the fields it changes.
+ * Offsets come from the generated wire layouts (mavconn/wire.h).
+ */
+struct ReplyFrames
+{
+    mavconn::MsgTemplate<mavlink::common::msg::PARAM_EXT_VALUE> param_value;
+    mavconn::MsgTemplate<mavlink::common::msg::PARAM_EXT_ACK> param_ack;
+    mavconn::MsgTemplate<mavlink::common::msg::CAMERA_IMAGE_CAPTURED> image_captured;
+    mavconn::MsgTemplate<mavlink::common::msg::COMMAND_ACK> command_ack;
+
+    ReplyFrames(uint8_t sysid, uint8_t compid, uint16_t param_count) :
+        param_value(sysid, compid),
+        param_ack(sysid, compid),
+        image_captured(sysid, compid),
+        command_ack(sysid, compid)
+    {
+        // Total number of parameters
+        param_value.set<uint16_t>(WIRE_OFFSET(PARAM_EXT_VALUE, param_count), param_count);
+        image_captured.set<uint8_t>(WIRE_OFFSET(CAMERA_IMAGE_CAPTURED, camera_id), 1);   // 1 for first
+        command_ack.set<uint8_t>(WIRE_OFFSET(COMMAND_ACK, progress), 100);  // 100% not used
+    }
+};
+
+/* Channel 0 sequence, shared by the replies and the heartbeat thread */
+static std::mutex channel0_mutex;
+/* Replies the FCU link refused, guarded by channel0_mutex */
+static size_t replies_dropped = 0;
+static size_t replies_no_remote = 0;
+
+/* Send a finalized reply, sequence is shared with everything else on channel 0 */
+template<typename Msg>
+void send_reply(mavconn::MsgTemplate<Msg> &frame, MAVConnInterface::Ptr fcu_link)
+{
+    std::lock_guard<std::mutex> lock(channel0_mutex);
+    size_t len = frame.finalize(mavlink::mavlink_get_channel_status(mavlink::MAVLINK_COMM_0));
+
+    // Like the heartbeat, a full or closed link costs this reply, the GCS asks again
+    switch (fcu_link->try_send_bytes(frame.data(), len)) {
+    case mavconn::SendStatus::queued:
+        break;
+    case mavconn::SendStatus::no_remote:
+        replies_no_remote++;
+        break;
+    default:
+        replies_dropped++;
+        printf("Reply dropped by the FCU link, %zu so far\n", replies_dropped);
+        break;
+    }
+}
+
 /* Handle responce from camera func and send output to Mavlink
  */
-void handle_responce(camera_responce *responce, MAVConnInterface::Ptr fcu_link)
+void handle_responce(camera_responce *responce, MAVConnInterface::Ptr fcu_link, ParamStreamer *param_streamer,
+                     ReplyFrames *frames)
 {
     printf("Command: %s\n\t Action: %s\n\t Result: %d\n", responce->command, responce->action, responce->result);
 
+    // param_value carries a mavlink_param_union_t in its first bytes
+    mavlink::mavlink_param_union_t union_value;
+    union_value.param_uint32 = 0;
+    union_value.param_uint8 = responce->value;
+
     if (!std::strcmp(responce->action, "GET")) {
+        // Late answer to a request that timed out, its retry is answered instead
+        if (!param_streamer->value_received(responce->param_index)) {
+            return;
+        }
+
         // Emit the value of a parameter. The inclusion of param_count and param_index
         // in the message allows the recipient to keep track of received parameters and
         // allows them to re-request missing parameters after a loss or timeout.
-        mavlink::common::msg::PARAM_EXT_VALUE camera_param_msg;
-        memset(&camera_param_msg, 0, sizeof(mavlink::common::msg::PARAM_EXT_VALUE));
+        auto &frame = frames->param_value;
 
         // Parameter id, terminated by NULL if the length is less than 16 human-readable chars
         // and WITHOUT null termination (NULL) byte if the length is exactly 16 chars -
         // applications have to provide 16+1 bytes storage if the ID is stored as string
-        mavlink::set_string(camera_param_msg.param_id, std::string(responce->command));
-
-        // Total number of parameters
-        camera_param_msg.param_count = NUMBER_OF_CAMERA_PARAMETERS;
-        mavlink::mavlink_param_union_t union_value;
-        union_value.param_uint8 = responce->value;
-        memcpy(&camera_param_msg.param_value, &union_value, sizeof(float));
-        camera_param_msg.param_type = responce->param_type;
-        camera_param_msg.param_index = responce->param_index; //EXPOSURE_MODE_INDEX;
-
-        auto mi = camera_param_msg.get_message_info();
-        mavlink::mavlink_message_t valueMsg;
-        mavlink::MsgMap map(valueMsg);
-        camera_param_msg.serialize(map);
-        mavlink::mavlink_finalize_message(&valueMsg, fcu_link->get_system_id(), fcu_link->get_component_id(),
-                                          mi.min_length, mi.length, mi.crc_extra);
-        fcu_link->send_message(&valueMsg);
+        frame.set<uint16_t>(WIRE_OFFSET(PARAM_EXT_VALUE, param_index), responce->param_index);
+        frame.set_string(WIRE_OFFSET(PARAM_EXT_VALUE, param_id), WIRE_SIZE(PARAM_EXT_VALUE, param_id),
+                         responce->command);
+        frame.set<uint32_t>(WIRE_OFFSET(PARAM_EXT_VALUE, param_value), union_value.param_uint32);
+        frame.set<uint8_t>(WIRE_OFFSET(PARAM_EXT_VALUE, param_type), responce->param_type);
+        send_reply(frame, fcu_link);
 
     } else if (!std::strcmp(responce->action, "SET")) {
-        mavlink::common::msg::PARAM_EXT_ACK ack;
-
-        ack.param_result = responce->result == 0 ? static_cast<uint8_t>(mavlink::common::PARAM_ACK::ACCEPTED) :
-                           static_cast<uint8_t>(mavlink::common::PARAM_ACK::FAILED);
-        mavlink::set_string(ack.param_id, std::string(responce->command));
-
-        mavlink::mavlink_param_union_t union_value;
-        union_value.param_uint8 = responce->value;
-        memcpy(&ack.param_value, &union_value, sizeof(float));
-
-        ack.param_type = responce->param_type;
-        auto mi = ack.get_message_info();
+        auto &frame = frames->param_ack;
 
-        mavlink::mavlink_message_t ackMsg;
-        mavlink::MsgMap ack_map(ackMsg);
-        ack.serialize(ack_map);
-        mavlink::mavlink_finalize_message(&ackMsg, fcu_link->get_system_id(),
-                                          fcu_link->get_component_id(), mi.min_length, mi.length, mi.crc_extra);
-        fcu_link->send_message(&ackMsg);
+        frame.set_string(WIRE_OFFSET(PARAM_EXT_ACK, param_id), WIRE_SIZE(PARAM_EXT_ACK, param_id),
+                         responce->command);
+        frame.set<uint32_t>(WIRE_OFFSET(PARAM_EXT_ACK, param_value), union_value.param_uint32);
+        frame.set<uint8_t>(WIRE_OFFSET(PARAM_EXT_ACK, param_type), responce->param_type);
+        frame.set<uint8_t>(WIRE_OFFSET(PARAM_EXT_ACK, param_result), responce->result == 0 ?
+                           static_cast<uint8_t>(mavlink::common::PARAM_ACK::ACCEPTED) :
+                           static_cast<uint8_t>(mavlink::common::PARAM_ACK::FAILED));
+        send_reply(frame, fcu_link);
 
     } else if (!std::strcmp(responce->action, "TRIGGER")) {
         if (!std::strcmp(responce->command, "TRIGGER_SURVEY")) {
-            mavlink::common::msg::CAMERA_IMAGE_CAPTURED cic;
-            memset(&cic, 0, sizeof(mavlink::common::msg::CAMERA_IMAGE_CAPTURED));
-            cic.camera_id = 1; /*< Camera ID (1 for first, 2 for second, etc.) */
-            cic.image_index = 0; /*< Zero based index of this image (image count since armed -1) */
-            cic.capture_result = (responce->result == 0); /*< Boolean indicating success (1) or failure (0) while capturing this image. */
-            auto mi = cic.get_message_info();
-            mavlink::mavlink_message_t ackMsg;
-            mavlink::MsgMap ack_map(ackMsg);
-            cic.serialize(ack_map);
-            mavlink::mavlink_finalize_message(&ackMsg, fcu_link->get_system_id(),
-                                              fcu_link->get_component_id(), mi.min_length, mi.length, mi.crc_extra);
-            fcu_link->send_message(&ackMsg);
+            // image_index stays 0: zero based index of this image (image count since armed -1)
+            auto &frame = frames->image_captured;
+            // 1 success, 0 failure
+            frame.set<uint8_t>(WIRE_OFFSET(CAMERA_IMAGE_CAPTURED, capture_result), responce->result == 0);
+            send_reply(frame, fcu_link);
 
         } else if (!std::strcmp(responce->command, "TRIGGER_TEST_IMAGE")) {
-            mavlink::common::msg::COMMAND_ACK ack;
-            ack.command = responce->param_index;
-
             // Fill in the ack. Should be cleaned up when we have proper return from handle_camera_trigger()
-            ack.result = (responce->result == 0) ? static_cast<uint16_t>(mavlink::common::MAV_RESULT::ACCEPTED) :
-                         static_cast<uint16_t>(mavlink::common::MAV_RESULT::FAILED);
-            ack.progress = 100; // 100% not used
-
-            auto mi = ack.get_message_info();
-            mavlink::mavlink_message_t ackMsg;
-            mavlink::MsgMap ack_map(ackMsg);
-            ack.serialize(ack_map);
-            mavlink::mavlink_finalize_message(&ackMsg, fcu_link->get_system_id(),
-                                              fcu_link->get_component_id(), mi.min_length, mi.length, mi.crc_extra);
-            fcu_link->send_message(&ackMsg);
+            auto &frame = frames->command_ack;
+            frame.set<uint16_t>(WIRE_OFFSET(COMMAND_ACK, command), responce->param_index);
+            frame.set<uint8_t>(WIRE_OFFSET(COMMAND_ACK, result), (responce->result == 0) ?
+                               static_cast<uint8_t>(mavlink::common::MAV_RESULT::ACCEPTED) :
+                               static_cast<uint8_t>(mavlink::common::MAV_RESULT::FAILED));
+            send_reply(frame, fcu_link);
         }
     }
 }
@@ -180,42 +212,22 @@ void handle_responce(camera_responce *responce, MAVConnInterface::Ptr fcu_link)
  * is received from FCU. This is the place to parse received mavlink messages and call
  * handling functions.
  */
-void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInterface::Ptr fcu_link, SocketClient *main_client)
+void mavlink_callback(const mavlink_message_t *mmsg, Framing, CameraChannel *camera_channel,
+                      ParamStreamer *param_streamer, FrameLog *frame_log)
 {
+    // Copy only, formatting happens on the log thread
+    frame_log->log(mmsg);
+
     // Handle Message ID
     switch (mmsg->msgid)
     {
-    case mavlink::common::msg::HEARTBEAT::MSG_ID:
-    {
-        // Emit a HB every time we get a HB from the FCU
-        if (mmsg->sysid == 1) {
-            mavlink::common::msg::HEARTBEAT hb;
-            memset(&hb, 0, sizeof(mavlink::common::msg::HEARTBEAT)); // Set everthing to zero for now
-            auto mi = hb.get_message_info();
-
-            mavlink::mavlink_message_t hbMsg;
-            mavlink::MsgMap hb_map(hbMsg);
-            hb.serialize(hb_map);
-            mavlink::mavlink_finalize_message(&hbMsg, fcu_link->get_system_id(),
-                                              fcu_link->get_component_id(), mi.min_length, mi.length, mi.crc_extra);
-            fcu_link->send_message(&hbMsg);
-        }
-
-        break;
-    }
-
     case mavlink::common::msg::CAMERA_TRIGGER::MSG_ID:
     {
-        mavlink::common::msg::CAMERA_TRIGGER trig;
-        mavlink::MsgMap map(mmsg);
-        trig.deserialize(map);
-        std::cout << trig.to_yaml() << std::endl;
-
         camera_request *request = new camera_request{};
         strcpy(request->command, "TRIGGER_SURVEY");
         snprintf(request->action, sizeof(request->action), "TRIGGER");
         request->timestamp = boost::posix_time::microsec_clock::local_time();
-        main_client->write(request, sizeof(*request));
+        camera_channel->submit(*request);
         delete request;
 
         break;
@@ -223,19 +235,17 @@ void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInt
 
     case mavlink::common::msg::COMMAND_LONG::MSG_ID:
     {
-        mavlink::common::msg::COMMAND_LONG cmd;
-        mavlink::MsgMap map(mmsg);
-        cmd.deserialize(map);
-
-        if (cmd.command == static_cast<uint16_t>(mavlink::common::MAV_CMD::IMAGE_START_CAPTURE)) {
-            std::cout << cmd.to_yaml() << std::endl;
+        // Only the command id decides, the params are never decoded
+        mavconn::wire::common::view::COMMAND_LONG cmd(mmsg);
+        uint16_t command = cmd.command();
 
+        if (command == static_cast<uint16_t>(mavlink::common::MAV_CMD::IMAGE_START_CAPTURE)) {
             camera_request *request = new camera_request{};
             strcpy(request->command, "TRIGGER_TEST_IMAGE");
             snprintf(request->action, sizeof(request->action), "TRIGGER");
-            request->param_index = cmd.command;
+            request->param_index = command;
 	        request->timestamp = boost::posix_time::microsec_clock::local_time();
-            main_client->write(request, sizeof(*request));
+            camera_channel->submit(*request);
             delete request;
         }
 
@@ -243,19 +253,10 @@ void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInt
     }
 
     // Request all parameters of this component. After this request, all parameters are emitted.
+    // Emission is paced by the streamer, a repeated request resumes a running stream.
     case mavlink::common::msg::PARAM_EXT_REQUEST_LIST::MSG_ID:
     {
-        mavlink::common::msg::PARAM_EXT_REQUEST_LIST req_list;
-        mavlink::MsgMap map(mmsg);
-        req_list.deserialize(map);
-        std::cout << req_list.to_yaml() << std::endl;
-        get_camera_parameter("EXPOSURE_MODE", main_client);
-        get_camera_parameter("ISO", main_client);
-        get_camera_parameter("SHUTTERSPD", main_client);
-        get_camera_parameter("APERTURE", main_client);
-        get_camera_parameter("WHITE_BALANCE", main_client);
-        get_camera_parameter("EXPOSURE_COMP", main_client);
-        get_camera_parameter("COMPR_SETTING", main_client);
+        param_streamer->request_list();
 
         break;
     }
@@ -263,16 +264,21 @@ void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInt
     // Request to read the value of a parameter with the either the param_id string id or param_index.
     case mavlink::common::msg::PARAM_EXT_REQUEST_READ::MSG_ID:
     {
-        //printf("PARAM_EXT_REQUEST_READ\n");
-        mavlink::common::msg::PARAM_EXT_REQUEST_READ read;
-        mavlink::MsgMap map(mmsg);
-        read.deserialize(map);
-        std::cout << read.to_yaml() << std::endl;
-
-        if (read.param_index == -1) {
-            get_camera_parameter(mavlink::to_string(read.param_id), main_client);
+        mavconn::wire::common::view::PARAM_EXT_REQUEST_READ read(mmsg);
+        int16_t param_index = read.param_index();
+
+        if (param_index == -1) {
+            std::string param_id = read.param_id();
+            int index = param_streamer->index_of(param_id);
+            if (index >= 0) {
+                // Single read, answered right away instead of waiting behind the list
+                param_streamer->read_now(index);
+            } else {
+                std::cout << "Unknown camera parameter " << param_id << std::endl;
+            }
         } else {
-            std::cout << "Requesting camera parameters using param_index is currently not supported" << std::endl;
+            // GCS fills a gap in the list, goes through the paced stream
+            param_streamer->request_read(param_index);
         }
 
         break;
@@ -280,17 +286,13 @@ void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInt
 
     case mavlink::common::msg::PARAM_EXT_SET::MSG_ID:
     {
-        int ret = -1;
-        mavlink::common::msg::PARAM_EXT_SET set;
-        mavlink::MsgMap map(mmsg);
-        set.deserialize(map);
-        std::cout << set.to_yaml() << std::endl;
+        mavconn::wire::common::view::PARAM_EXT_SET set(mmsg);
 
-        mavlink::mavlink_param_union_t union_value;
-        memcpy(&union_value, &set.param_value, sizeof(float));
+        std::string param_id = set.param_id();
 
-        uint8_t data = union_value.param_uint8;
-        set_camera_parameter(mavlink::to_string(set.param_id), main_client, data);
+        // param_value holds a mavlink_param_union_t, param_uint8 is its first byte
+        uint8_t data = set.param_value(0);
+        set_camera_parameter(param_id, camera_channel, data);
 
         break;
     }
@@ -301,15 +303,78 @@ void mavlink_callback(const mavlink_message_t *mmsg, Framing framing, MAVConnInt
     }
 }
 
-/* Handle camera requests */
-void start_camera_server(SocketServer *serverport)
+/* Hand a shared-memory ring pair to the camera server.
+ * Falls back to the socket when it cannot be set up or the server refuses.
+ */
+CameraTransport *attach_shm_transport(SocketClient *main_client)
+{
+    ShmTransport *shm = ShmTransport::create();
+    if (shm == nullptr) {
+        return main_client;
+    }
+
+    camera_request *request = new camera_request{};
+    snprintf(request->command, sizeof(request->command), CAMERA_SHM_ATTACH);
+    snprintf(request->action, sizeof(request->action), "TRANSPORT");
+    request->timestamp = boost::posix_time::microsec_clock::local_time();
+    main_client->write_fds(request, sizeof(*request), shm->get_fds(), ShmTransport::FD_COUNT);
+    delete request;
+
+    camera_responce *responce = new camera_responce{};
+    ssize_t ret = main_client->read(responce, sizeof(*responce));
+    bool accepted = ret > 0 && responce->result == 0 && !strcmp(responce->command, CAMERA_SHM_ATTACH);
+    delete responce;
+
+    if (!accepted) {
+        printf("Camera server does not support shared memory, using socket\n");
+        delete shm;
+        return main_client;
+    }
+
+    printf("Camera transport: shared memory\n");
+    return shm;
+}
+
+/* Handle camera requests. Without camera hardware this is the mock camera,
+ * it serves until the process is killed.
+ */
+void start_camera_server(const char *socket_name, const MockCamera::Config &config)
 {
-    /*
-    CameraFunc* camera_func = new CameraFunc(serverport);
-    camera_func->start();
+    MockCamera *camera = new MockCamera(socket_name, config);
+    if (camera->is_open()) {
+        printf("Mock camera server on %s\n", socket_name);
+        camera->run();
+    }
+    delete camera;
+}
+
+/* SIGUSR1 requests a trace dump; the file is written from a helper thread, not the handler */
+static volatile sig_atomic_t trace_dump_requested = 0;
 
-    delete camera_func;
-    */
+static void trace_dump_signal(int) {
+    trace_dump_requested = 1;
+}
+
+void start_trace_dumper(const std::string &path) {
+    mavconn::trace::set_enabled(true);
+    signal(SIGUSR1, trace_dump_signal);
+
+    std::thread([path]() {
+        for (;;) {
+            usleep(200000);
+            if (!trace_dump_requested) {
+                continue;
+            }
+            trace_dump_requested = 0;
+
+            ssize_t count = mavconn::trace::dump(path);
+            if (count < 0) {
+                printf("Trace dump to %s failed: %s\n", path.c_str(), strerror(errno));
+            } else {
+                printf("Trace dump: %zd frames to %s\n", count, path.c_str());
+            }
+        }
+    }).detach();
 }
 
 /*
@@ -322,27 +387,42 @@ int main(int argc, char **argv)
 {
     char socket_name[100];
     snprintf(socket_name, 100, "mavlink2cam");
+
+    // Transport has to be chosen before the camera is set up below
+    bool use_shm = false;
+    bool use_mock = false;
+    MockCamera::Config mock_config;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp("-shm", argv[i])) {
+            use_shm = true;
+        } else if (!strcmp("-mock", argv[i])) {
+            use_mock = true;
+        } else if (!strcmp("-mockdelay", argv[i]) && ((i + 1) < argc)) {
+            // Mock camera processing time in us
+            mock_config.delay_us = atoi(argv[i + 1]);
+        } else if (!strcmp("-mockfail", argv[i]) && ((i + 1) < argc)) {
+            // Share of mock camera SET/TRIGGER requests that fail
+            mock_config.failure_rate = atof(argv[i + 1]);
+        }
+    }
+
     printf("%s\n", "banana");
     SocketClient *main_client = new SocketClient(socket_name);
 
     while (false == main_client->connect()) {
         fprintf(stderr, "Cannot connect camera server: %s\n", strerror(errno));
-        sleep(1);
-        /*
-        SocketServer *serverport = new SocketServer(socket_name);
-        if (0 == fork()) {
-            delete main_client;
-            start_camera_server(serverport);
-            delete serverport;
-            exit(0);
-        }
-        delete serverport;
-        
-        if (false == main_client->connect()) {
-            fprintf(stderr, "Cannot connect camera server: %s\n", strerror(errno));
-            exit(0);
+        if (use_mock) {
+            use_mock = false;
+            if (0 == fork()) {
+                delete main_client;
+                start_camera_server(socket_name, mock_config);
+                exit(0);
+            }
+            // Give the child time to bind the socket
+            usleep(100000);
+            continue;
         }
-        */
+        sleep(1);
     }
 
     // Send camera initialization request with main_client
@@ -358,13 +438,47 @@ int main(int argc, char **argv)
     camera_responce *responce = new camera_responce{};
     main_client->read(responce, sizeof(*responce));
 
+    // Socket stays connected either way, it carries the shared-memory setup
+    CameraTransport *camera_transport = main_client;
+    if (use_shm) {
+        camera_transport = attach_shm_transport(main_client);
+    }
+
+    // From here on requests go through the queue, the io thread never waits on the camera
+    CameraChannel *camera_channel = new CameraChannel(camera_transport);
+    camera_channel->start();
+
+    ParamStreamer *param_streamer = new ParamStreamer(camera_parameters,
+            [camera_channel](uint16_t index, const std::string &param_id) {
+                get_camera_parameter(param_id, index, camera_channel);
+            });
+
     // Configure connection to FCU
     std::string fcu_url, gcs_url;
     std::string fcu_protocol;
     int system_id, component_id;
     int tgt_system_id, tgt_component_id;
+    double heartbeat_rate = HeartbeatEmitter::DEFAULT_RATE;
+    std::string trace_path;
+    std::string tlog_path;
+    std::vector<std::string> route_urls;
+
+    // Received commands are logged in full, like the to_yaml() dumps used to be
+    FrameLog *frame_log = new FrameLog(stdout, FrameLog::Format::YAML);
+    frame_log->register_type<mavlink::common::msg::CAMERA_TRIGGER>();
+    frame_log->register_type<mavlink::common::msg::COMMAND_LONG>();
+    frame_log->register_type<mavlink::common::msg::PARAM_EXT_REQUEST_LIST>();
+    frame_log->register_type<mavlink::common::msg::PARAM_EXT_REQUEST_READ>();
+    frame_log->register_type<mavlink::common::msg::PARAM_EXT_SET>();
+    frame_log->register_type<mavlink::common::msg::HEARTBEAT>();
+    frame_log->set_level(mavlink::common::msg::CAMERA_TRIGGER::MSG_ID, FrameLog::Level::FULL);
+    frame_log->set_level(mavlink::common::msg::COMMAND_LONG::MSG_ID, FrameLog::Level::FULL);
+    frame_log->set_level(mavlink::common::msg::PARAM_EXT_REQUEST_LIST::MSG_ID, FrameLog::Level::FULL);
+    frame_log->set_level(mavlink::common::msg::PARAM_EXT_REQUEST_READ::MSG_ID, FrameLog::Level::FULL);
+    frame_log->set_level(mavlink::common::msg::PARAM_EXT_SET::MSG_ID, FrameLog::Level::FULL);
 
     MAVConnInterface::Ptr fcu_link;
+    std::shared_ptr<mavconn::MAVConnReplay> replay;
     fcu_url = "serial:///dev/ttyUSB0:57600";
     gcs_url = "udp://@";
     fcu_protocol = "v2.0";
@@ -385,15 +499,60 @@ int main(int argc, char **argv)
             } else if (!strcmp("-sitl", argv[i])) {
                 fcu_url = "udp://127.0.0.1:14540@";
                 printf("%s\n", "Starting in SITL mode at 127.0.0.1:14540");
+            } else if (!strcmp("-parambw", argv[i]) && ((i + 1) < argc)) {
+                // Bandwidth budget for parameter list streaming in bytes/s
+                param_streamer->set_bandwidth(atoi(argv[i + 1]));
+                printf("Parameter streaming budget %s B/s\n", argv[i + 1]);
+            } else if (!strcmp("-hbrate", argv[i]) && ((i + 1) < argc)) {
+                // Camera heartbeat rate in Hz
+                heartbeat_rate = atof(argv[i + 1]);
+                printf("Heartbeat rate %s Hz\n", argv[i + 1]);
+            } else if (!strcmp("-logfmt", argv[i]) && ((i + 1) < argc)) {
+                // Frame log output: text, yaml or json
+                if (!strcmp("text", argv[i + 1])) {
+                    frame_log->set_format(FrameLog::Format::TEXT);
+                } else if (!strcmp("json", argv[i + 1])) {
+                    frame_log->set_format(FrameLog::Format::JSON);
+                } else {
+                    frame_log->set_format(FrameLog::Format::YAML);
+                }
+            } else if (!strcmp("-replay", argv[i]) && ((i + 1) < argc)) {
+                // Feed a recorded tlog instead of the FCU; FILE?rate=max for full speed
+                fcu_url = std::string("file://") + std::string(argv[i + 1]);
+                printf("Replaying %s\n", argv[i + 1]);
+            } else if (!strcmp("-route", argv[i]) && ((i + 1) < argc)) {
+                // Extra link (GCS, companion) routed together with the FCU, may repeat
+                route_urls.push_back(argv[i + 1]);
+                printf("Routing %s\n", argv[i + 1]);
+            } else if (!strcmp("-tlog", argv[i]) && ((i + 1) < argc)) {
+                // Record FCU link traffic, play it back with -replay
+                tlog_path = argv[i + 1];
+                printf("Recording FCU link to %s\n", argv[i + 1]);
+            } else if (!strcmp("-trace", argv[i]) && ((i + 1) < argc)) {
+                // Record frame timing, dumped to the file on SIGUSR1
+                trace_path = argv[i + 1];
+                printf("Frame trace to %s on SIGUSR1\n", argv[i + 1]);
+            } else if (!strcmp("-loglevel", argv[i]) && ((i + 1) < argc)) {
+                // MSGID:LEVEL, or LEVEL for every message; 0 off, 1 brief, 2 full
+                const char *colon = strchr(argv[i + 1], ':');
+                if (colon != NULL) {
+                    frame_log->set_level(atoi(argv[i + 1]), static_cast<FrameLog::Level>(atoi(colon + 1)));
+                } else {
+                    frame_log->set_default_level(static_cast<FrameLog::Level>(atoi(argv[i + 1])));
+                }
             }
         }
     }
 
     try {
         fcu_link = MAVConnInterface::open_url(fcu_url, system_id, component_id);
+        replay = std::dynamic_pointer_cast<mavconn::MAVConnReplay>(fcu_link);
         // may be overridden by URL
         fcu_link->set_system_id(system_id);
         fcu_link->set_component_id(component_id);
+        if (!tlog_path.empty()) {
+            fcu_link->set_recorder(std::make_shared<mavconn::TlogWriter>(tlog_path));
+        }
         printf("%s\n", "Connected");
     }
 
@@ -413,18 +572,64 @@ int main(int argc, char **argv)
         fcu_link->set_protocol_version(mavconn::Protocol::V10);
     }
 
-    fcu_link->message_received_cb = std::bind(&mavlink_callback, std::placeholders::_1, std::placeholders::_2, fcu_link, main_client);
+    // With extra links the bridge becomes one endpoint of a router
+    if (!route_urls.empty()) {
+        mavconn::Router *router = new mavconn::Router();
+        router->add_link(fcu_link);
+        try {
+            for (auto &url : route_urls) {
+                router->add_link(MAVConnInterface::open_url(url, system_id, component_id));
+            }
+        }
+        catch (mavconn::DeviceError &ex) {
+            printf("Route: %s\n", ex.what());
+            return 0;
+        }
+        auto protocol = fcu_link->get_protocol_version();
+        fcu_link = router->open_local(system_id, component_id);
+        fcu_link->set_protocol_version(protocol);
+    }
+
+    // Replies and the heartbeat are finalized on channel 0, with the link's framing
+    if (fcu_link->get_protocol_version() == mavconn::Protocol::V10) {
+        mavlink::mavlink_get_channel_status(mavlink::MAVLINK_COMM_0)->flags |= MAVLINK_STATUS_FLAG_OUT_MAVLINK1;
+    }
+
+    param_streamer->start();
+
+    // Liveness no longer depends on the FCU heartbeat, frame is encoded once here
+    mavlink::common::msg::HEARTBEAT hb {}; // Set everthing to zero for now
+    HeartbeatEmitter *heartbeat = new HeartbeatEmitter(fcu_link, hb, channel0_mutex);
+    heartbeat->set_rate(heartbeat_rate);
+    heartbeat->start();
+
+    frame_log->start();
+
+    if (!trace_path.empty()) {
+        start_trace_dumper(trace_path);
+    }
+
+    fcu_link->message_received_cb = std::bind(&mavlink_callback, std::placeholders::_1, std::placeholders::_2,
+                                              camera_channel, param_streamer, frame_log);
     fcu_link->port_closed_cb = []() {
         printf("FCU connection closed, application will be terminated.\n");
         return 0;
     };
 
+    // A replay only starts once the callbacks are in place
+    if (replay) {
+        replay->start();
+    }
+
+    ReplyFrames *reply_frames = new ReplyFrames(fcu_link->get_system_id(), fcu_link->get_component_id(),
+                                                param_streamer->count());
+
     int read;
     while(1) {
         // Handle responce from server and send back mavlink messages
-        read = main_client->read(responce, sizeof(*responce));
-        if (read != 0) {
-            handle_responce(responce, fcu_link);
+        read = camera_channel->read(responce);
+        if (read > 0) {
+            handle_responce(responce, fcu_link, param_streamer, reply_frames);
         }
     }
 
@@ -0,0 +1,282 @@
+/**
+ * @file mock_camera.cpp
+ * @brief Camera server stand-in speaking the bridge socket protocol.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+
+#include "shm_ring.hpp"
+#include "mock_camera.hpp"
+
+MockCamera::MockCamera(const char *name, const Config &config) :
+    config(config),
+    server(name),
+    running(false),
+    rng(std::random_device()()),
+    n_initialized(0),
+    stats{}
+{
+    server.on_request = std::bind(&MockCamera::on_request, this, std::placeholders::_1,
+                                  std::placeholders::_2, std::placeholders::_3,
+                                  std::placeholders::_4, std::placeholders::_5);
+    server.on_disconnect = std::bind(&MockCamera::on_disconnect, this, std::placeholders::_1);
+
+    // Same parameter set as the bridge exposes, all UINT8
+    for (const char *id : {"EXPOSURE_MODE", "ISO", "SHUTTERSPD", "APERTURE",
+                           "WHITE_BALANCE", "EXPOSURE_COMP", "COMPR_SETTING"}) {
+        params[id] = 0;
+    }
+}
+
+MockCamera::~MockCamera() {
+    stop();
+}
+
+bool MockCamera::is_open() {
+    return server.is_open();
+}
+
+void MockCamera::start() {
+    running = true;
+    reply_thread = std::thread(&MockCamera::reply_loop, this);
+    server_thread = std::thread([this]() { server.run(); });
+}
+
+void MockCamera::run() {
+    running = true;
+    reply_thread = std::thread(&MockCamera::reply_loop, this);
+    server.run();
+}
+
+void MockCamera::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_one();
+    }
+    server.stop();
+
+    if (server_thread.joinable()) {
+        server_thread.join();
+    }
+    if (reply_thread.joinable()) {
+        reply_thread.join();
+    }
+
+    std::map<EventSocketServer::ClientId, std::shared_ptr<ShmSession> > sessions;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sessions.swap(shm_sessions);
+    }
+    for (auto &kv : sessions) {
+        kv.second->alive = false;
+        kv.second->thread.join();
+    }
+}
+
+size_t MockCamera::initialized() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return n_initialized;
+}
+
+MockCamera::Stats MockCamera::get_stats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void MockCamera::on_request(EventSocketServer::ClientId client, const void *buf, size_t count,
+                            const int *fds, int nfds) {
+    if (count < sizeof(camera_request)) {
+        fprintf(stderr, "mock camera: short request (%zu bytes)\n", count);
+        return;
+    }
+
+    camera_request request;
+    memcpy(&request, buf, sizeof(request));
+
+    if (!strcmp(request.command, CAMERA_SHM_ATTACH)) {
+        attach_shm(client, request, fds, nfds);
+        return;
+    }
+
+    for (int i = 0; i < nfds; i++) {
+        close(fds[i]);
+    }
+    handle(client, request);
+}
+
+void MockCamera::on_disconnect(EventSocketServer::ClientId client) {
+    std::shared_ptr<ShmSession> session;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = shm_sessions.find(client);
+        if (it == shm_sessions.end()) {
+            return;
+        }
+        session = std::move(it->second);
+        shm_sessions.erase(it);
+    }
+
+    session->alive = false;
+    session->thread.join();
+}
+
+void MockCamera::attach_shm(EventSocketServer::ClientId client, const camera_request &request,
+                            const int *fds, int nfds) {
+    camera_responce responce{};
+    strcpy(responce.command, request.command);
+    strcpy(responce.action, request.action);
+    responce.timestamp = request.timestamp;
+
+    ShmTransport *shm = nfds == ShmTransport::FD_COUNT ? ShmTransport::attach(fds) : nullptr;
+    if (shm == nullptr) {
+        for (int i = 0; i < nfds; i++) {
+            close(fds[i]);
+        }
+        server.send(client, &responce, sizeof(responce));
+        return;
+    }
+
+    shm->async_mode();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<ShmSession> &session = shm_sessions[client];
+        session.reset(new ShmSession());
+        session->transport.reset(shm);
+        session->alive = true;
+        session->thread = std::thread(&MockCamera::serve_shm, this, client, shm);
+    }
+
+    // Acknowledge on the socket, everything after goes through the rings
+    responce.result = 0;
+    server.send(client, &responce, sizeof(responce));
+}
+
+void MockCamera::serve_shm(EventSocketServer::ClientId client, ShmTransport *shm) {
+    ShmSession *session;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        session = shm_sessions[client].get();
+    }
+
+    camera_request request;
+    while (running && session->alive) {
+        if (!shm->wait(POLLIN, 100)) {
+            continue;
+        }
+        while (shm->read(&request, sizeof(request)) == sizeof(request)) {
+            handle(client, request);
+        }
+    }
+}
+
+void MockCamera::handle(EventSocketServer::ClientId client, const camera_request &request) {
+    camera_responce responce{};
+    strcpy(responce.command, request.command);
+    strcpy(responce.action, request.action);
+    responce.param_type = request.param_type;
+    responce.param_index = request.param_index;
+    responce.timestamp = request.timestamp;
+    responce.result = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.requests++;
+
+        int delay = 0;
+        if (!strcmp(request.command, "INITIALIZE")) {
+            // Bridge blocks on this one, answer right away
+            n_initialized++;
+        } else {
+            std::bernoulli_distribution fail(config.failure_rate);
+            if (!strcmp(request.action, "GET")) {
+                auto it = params.find(request.command);
+                if (it != params.end()) {
+                    responce.value = it->second;
+                } else {
+                    responce.result = -1;
+                }
+            } else if (!strcmp(request.action, "SET")) {
+                auto it = params.find(request.command);
+                if (it != params.end() && !fail(rng)) {
+                    it->second = request.value;
+                } else {
+                    responce.result = -1;
+                }
+                responce.value = request.value;
+            } else if (!strcmp(request.action, "TRIGGER")) {
+                responce.result = fail(rng) ? -1 : 0;
+            } else {
+                responce.result = -1;
+            }
+
+            if (responce.result != 0) {
+                stats.failures++;
+            }
+
+            delay = config.delay_us;
+            if (config.jitter_us > 0) {
+                delay += std::uniform_int_distribution<int>(0, config.jitter_us)(rng);
+            }
+        }
+
+        if (delay > 0) {
+            replies.emplace(clock::now() + std::chrono::microseconds(delay), Pending{client, responce});
+            cond.notify_one();
+            return;
+        }
+    }
+
+    reply(client, responce);
+}
+
+/* Must be called without mutex held, a failed send calls on_disconnect */
+void MockCamera::reply(EventSocketServer::ClientId client, const camera_responce &responce) {
+    std::shared_ptr<ShmSession> session;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.responces++;
+
+        auto it = shm_sessions.find(client);
+        if (it != shm_sessions.end()) {
+            session = it->second;
+        }
+    }
+
+    if (session) {
+        std::lock_guard<std::mutex> lock(session->tx_mutex);
+        if (session->transport->write(&responce, sizeof(responce)) < 0) {
+            fprintf(stderr, "mock camera: responce ring full, dropped %s\n", responce.command);
+        }
+        return;
+    }
+
+    server.send(client, &responce, sizeof(responce));
+}
+
+void MockCamera::reply_loop() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (running) {
+        if (replies.empty()) {
+            cond.wait(lock);
+            continue;
+        }
+
+        auto due = replies.begin()->first;
+        if (clock::now() < due) {
+            cond.wait_until(lock, due);
+            continue;
+        }
+
+        Pending pending = replies.begin()->second;
+        replies.erase(replies.begin());
+
+        lock.unlock();
+        reply(pending.client, pending.responce);
+        lock.lock();
+    }
+}
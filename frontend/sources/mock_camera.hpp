@@ -0,0 +1,99 @@
+/**
+ * @file mock_camera.hpp
+ * @brief Camera server stand-in speaking the bridge socket protocol.
+ */
+
+#ifndef __MOCK_CAMERA_HPP__
+#define __MOCK_CAMERA_HPP__
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <memory>
+#include <condition_variable>
+
+#include "event_server.hpp"
+#include "camera_protocol.hpp"
+
+class ShmTransport;
+
+/*
+ * Answers INITIALIZE, GET, SET and TRIGGER like the real camera server,
+ * after a configurable delay and with a configurable failure rate, and
+ * accepts the SHM_ATTACH transport switch. Lets the bridge run on a
+ * bench without camera hardware.
+ */
+class MockCamera {
+public:
+    struct Config {
+        int delay_us = 0;           // fixed processing time per request
+        int jitter_us = 0;          // uniform extra delay on top
+        double failure_rate = 0.0;  // share of SET/TRIGGER answered with result -1
+    };
+
+    struct Stats {
+        size_t requests;
+        size_t responces;
+        size_t failures;
+    };
+
+    MockCamera(const char *name, const Config &config);
+    ~MockCamera();
+
+    bool is_open();
+    /* Serve from background threads. */
+    void start();
+    /* Serve from the calling thread until stop(). */
+    void run();
+    void stop();
+
+    /* Clients that completed INITIALIZE */
+    size_t initialized();
+    Stats get_stats();
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct Pending {
+        EventSocketServer::ClientId client;
+        camera_responce responce;
+    };
+
+    struct ShmSession {
+        std::unique_ptr<ShmTransport> transport;
+        std::mutex tx_mutex;        // replies come from the reply and the session thread
+        std::atomic<bool> alive;
+        std::thread thread;
+    };
+
+    Config config;
+    EventSocketServer server;
+    std::thread server_thread;
+    std::thread reply_thread;
+    std::atomic<bool> running;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::multimap<clock::time_point, Pending> replies;
+    std::map<EventSocketServer::ClientId, std::shared_ptr<ShmSession> > shm_sessions;
+    std::map<std::string, uint8_t> params;
+    std::mt19937 rng;
+    size_t n_initialized;
+    Stats stats;
+
+    void on_request(EventSocketServer::ClientId client, const void *buf, size_t count,
+                    const int *fds, int nfds);
+    void on_disconnect(EventSocketServer::ClientId client);
+    void attach_shm(EventSocketServer::ClientId client, const camera_request &request, const int *fds, int nfds);
+    void serve_shm(EventSocketServer::ClientId client, ShmTransport *shm);
+
+    void handle(EventSocketServer::ClientId client, const camera_request &request);
+    void reply(EventSocketServer::ClientId client, const camera_responce &responce);
+    void reply_loop();
+};
+
+#endif // __MOCK_CAMERA_HPP__
@@ -0,0 +1,228 @@
+/**
+ * @file param_stream.cpp
+ * @brief Paced streaming of camera parameters for PARAM_EXT_REQUEST_LIST.
+ */
+
+#include <stdio.h>
+
+#include <algorithm>
+
+#include "param_stream.hpp"
+
+constexpr size_t ParamStreamer::DEFAULT_BANDWIDTH;
+constexpr size_t ParamStreamer::VALUE_FRAME_SIZE;
+constexpr size_t ParamStreamer::MAX_IN_FLIGHT;
+
+ParamStreamer::ParamStreamer(const std::vector<std::string> &param_ids, RequestFn request_fn) :
+    ids(param_ids),
+    request_fn(request_fn),
+    running(false),
+    entries(param_ids.size(), Entry{State::IDLE, 0, clock::time_point(), 0, clock::time_point()}),
+    in_flight(0),
+    bandwidth(DEFAULT_BANDWIDTH),
+    tokens(VALUE_FRAME_SIZE),
+    last_refill(clock::now())
+{
+}
+
+ParamStreamer::~ParamStreamer() {
+    stop();
+}
+
+void ParamStreamer::set_bandwidth(size_t bytes_per_sec) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Anything below one frame per second would never finish a list.
+    bandwidth = std::max(bytes_per_sec, VALUE_FRAME_SIZE);
+    cond.notify_one();
+}
+
+void ParamStreamer::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return;
+    }
+    running = true;
+    thread = std::thread(&ParamStreamer::run, this);
+}
+
+void ParamStreamer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        cond.notify_one();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void ParamStreamer::request_list() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!pending.empty() || in_flight > 0) {
+        // GCS repeated the request before we were done: resume, do not restart.
+        return;
+    }
+
+    for (uint16_t i = 0; i < entries.size(); i++) {
+        entries[i].state = State::IDLE;
+        queue(i, false);
+    }
+    cond.notify_one();
+}
+
+void ParamStreamer::request_read(uint16_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index >= entries.size()) {
+        return;
+    }
+
+    // A re-request by index means the GCS lost this value.
+    if (entries[index].state == State::SENT || entries[index].state == State::IDLE) {
+        queue(index, true);
+        cond.notify_one();
+    }
+}
+
+void ParamStreamer::read_now(uint16_t index) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (index >= entries.size()) {
+            return;
+        }
+
+        entries[index].direct++;
+        entries[index].direct_requested = clock::now();
+    }
+
+    request_fn(index, ids[index]);
+}
+
+bool ParamStreamer::value_received(uint16_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index < entries.size() && entries[index].direct > 0) {
+        // Answer to read_now(), not charged and the stream state stays as is
+        entries[index].direct--;
+        return true;
+    }
+
+    if (index >= entries.size() || entries[index].state != State::IN_FLIGHT) {
+        // Expired and re-queued or skipped, the retry answers instead.
+        return false;
+    }
+
+    tokens -= VALUE_FRAME_SIZE;
+    entries[index].state = State::SENT;
+    in_flight--;
+    cond.notify_one();
+    return true;
+}
+
+int ParamStreamer::index_of(const std::string &param_id) const {
+    auto it = std::find(ids.begin(), ids.end(), param_id);
+    return it == ids.end() ? -1 : std::distance(ids.begin(), it);
+}
+
+const std::string &ParamStreamer::param_id(uint16_t index) const {
+    return ids.at(index);
+}
+
+uint16_t ParamStreamer::count() const {
+    return ids.size();
+}
+
+bool ParamStreamer::is_streaming() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !pending.empty() || in_flight > 0;
+}
+
+/* Must be called with mutex held */
+void ParamStreamer::queue(uint16_t index, bool urgent) {
+    auto &e = entries[index];
+    e.state = State::PENDING;
+    e.retries = 0;
+
+    if (urgent) {
+        pending.push_front(index);
+    } else {
+        pending.push_back(index);
+    }
+}
+
+/* Must be called with mutex held */
+void ParamStreamer::refill(clock::time_point now) {
+    double dt = std::chrono::duration<double>(now - last_refill).count();
+    last_refill = now;
+
+    // Allow a burst of two frames so an idle link starts right away.
+    tokens = std::min(tokens + dt * bandwidth, 2.0 * VALUE_FRAME_SIZE);
+}
+
+/* Must be called with mutex held */
+void ParamStreamer::expire(clock::time_point now) {
+    auto timeout = std::chrono::milliseconds(RESPONSE_TIMEOUT_MS);
+
+    for (uint16_t i = 0; i < entries.size(); i++) {
+        auto &e = entries[i];
+        if (e.direct > 0 && now - e.direct_requested >= timeout) {
+            // Camera never answered the ad-hoc read, the GCS retries on its own
+            e.direct = 0;
+        }
+
+        if (e.state != State::IN_FLIGHT || now - e.requested < timeout) {
+            continue;
+        }
+
+        in_flight--;
+        if (++e.retries > MAX_RETRIES) {
+            // Camera does not answer for this one, let the GCS re-request it.
+            printf("Camera parameter %s timed out, skipping\n", ids[i].c_str());
+            e.state = State::IDLE;
+            continue;
+        }
+
+        e.state = State::PENDING;
+        pending.push_front(i);
+    }
+}
+
+void ParamStreamer::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (running) {
+        auto now = clock::now();
+        refill(now);
+        expire(now);
+
+        if (pending.empty() || in_flight >= MAX_IN_FLIGHT) {
+            // Wake up for new work, responses, or the next retry check.
+            cond.wait_for(lock, std::chrono::milliseconds(RESPONSE_TIMEOUT_MS / 4));
+            continue;
+        }
+
+        // Values in flight are charged when they arrive, keep their share free.
+        double needed = (in_flight + 1) * VALUE_FRAME_SIZE;
+        if (tokens < needed) {
+            auto wait = std::chrono::duration<double>((needed - tokens) / bandwidth);
+            cond.wait_for(lock, std::chrono::duration_cast<clock::duration>(wait));
+            continue;
+        }
+
+        uint16_t index = pending.front();
+        pending.pop_front();
+
+        auto &e = entries[index];
+        if (e.state != State::PENDING) {
+            // Queued twice (list and re-request), already handled.
+            continue;
+        }
+
+        e.state = State::IN_FLIGHT;
+        e.requested = now;
+        in_flight++;
+
+        lock.unlock();
+        request_fn(index, ids[index]);
+        lock.lock();
+    }
+}
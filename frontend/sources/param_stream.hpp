@@ -0,0 +1,108 @@
+/**
+ * @file param_stream.hpp
+ * @brief Paced streaming of camera parameters for PARAM_EXT_REQUEST_LIST.
+ */
+
+#ifndef __PARAM_STREAM_HPP__
+#define __PARAM_STREAM_HPP__
+
+#include <stdint.h>
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+
+/*
+ * Emits the camera parameter list one index at a time, paced to a byte
+ * budget, instead of requesting everything from the camera at once.
+ *
+ * The budget is charged when a value is emitted, answers to requests that
+ * already timed out are dropped and cost nothing.
+ *
+ * The GCS acknowledges implicitly: an index whose PARAM_EXT_VALUE went out
+ * is considered delivered unless the GCS re-requests it by index. A repeated
+ * PARAM_EXT_REQUEST_LIST while a stream is running resumes it, one received
+ * after the stream finished starts over.
+ */
+class ParamStreamer {
+public:
+    using clock = std::chrono::steady_clock;
+    // Called from the streamer thread, or from read_now(), to fetch one parameter from the camera.
+    using RequestFn = std::function<void (uint16_t index, const std::string &param_id)>;
+
+    // Default budget leaves most of a 57600 baud radio to other traffic.
+    static constexpr size_t DEFAULT_BANDWIDTH = 2000;
+    // Wire size of a MAVLink 2 PARAM_EXT_VALUE frame (header + payload + crc).
+    static constexpr size_t VALUE_FRAME_SIZE = 12 + 149;
+    // Camera requests outstanding at any time.
+    static constexpr size_t MAX_IN_FLIGHT = 2;
+    // Camera response timeout and retry count before an index is skipped.
+    static constexpr int RESPONSE_TIMEOUT_MS = 1000;
+    static constexpr int MAX_RETRIES = 3;
+
+    ParamStreamer(const std::vector<std::string> &param_ids, RequestFn request_fn);
+    ~ParamStreamer();
+
+    void set_bandwidth(size_t bytes_per_sec);
+    void start();
+    void stop();
+
+    // PARAM_EXT_REQUEST_LIST received.
+    void request_list();
+    // PARAM_EXT_REQUEST_READ for a single index, the GCS is filling a gap.
+    void request_read(uint16_t index);
+    // Ad-hoc read by param_id: requested right away, outside the list and its budget.
+    void read_now(uint16_t index);
+    // Camera answered for index. Returns false if the request already expired,
+    // the value must then be dropped; otherwise it is charged to the budget.
+    bool value_received(uint16_t index);
+
+    int index_of(const std::string &param_id) const;
+    const std::string &param_id(uint16_t index) const;
+    uint16_t count() const;
+    bool is_streaming();
+
+private:
+    enum class State : uint8_t {
+        IDLE,       // not part of the current stream
+        PENDING,    // waiting for budget
+        IN_FLIGHT,  // requested from the camera
+        SENT,       // value emitted, implicitly acknowledged
+    };
+
+    struct Entry {
+        State state;
+        int retries;
+        clock::time_point requested;
+        int direct;                     // read_now() answers still expected
+        clock::time_point direct_requested;
+    };
+
+    const std::vector<std::string> ids;
+    RequestFn request_fn;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread thread;
+    bool running;
+
+    std::vector<Entry> entries;
+    std::deque<uint16_t> pending;    // re-requested indices are served first
+    size_t in_flight;
+
+    size_t bandwidth;
+    double tokens;
+    clock::time_point last_refill;
+
+    void run();
+    void refill(clock::time_point now);
+    void expire(clock::time_point now);
+    void queue(uint16_t index, bool urgent);
+};
+
+#endif // __PARAM_STREAM_HPP__
@@ -0,0 +1,237 @@
+/**
+ * @file shm_ring.cpp
+ * @brief Shared-memory request/responce rings between bridge and camera server.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+
+#include <new>
+#include <algorithm>
+
+#include "shm_ring.hpp"
+
+constexpr size_t ShmRing::SLOT_COUNT;
+
+static void efd_signal(int efd) {
+    uint64_t one = 1;
+    ssize_t ret = ::write(efd, &one, sizeof(one));
+    (void)ret;  // counter saturation is the only failure, still a wakeup
+}
+
+static bool efd_wait(int efd, int timeout_ms) {
+    struct pollfd pfd;
+    pfd.fd = efd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd, 1, timeout_ms) <= 0) {
+        return false;
+    }
+
+    uint64_t counter;
+    ssize_t ret = ::read(efd, &counter, sizeof(counter));
+    (void)ret;  // EAGAIN if the other side raced us to it, harmless
+    return true;
+}
+
+ShmRing::ShmRing(Layout *layout, int data_efd, int space_efd) :
+    ring(layout),
+    data_efd(data_efd),
+    space_efd(space_efd)
+{
+}
+
+bool ShmRing::empty() {
+    return ring->hdr.head.load() == ring->hdr.tail.load();
+}
+
+bool ShmRing::full() {
+    return ring->hdr.head.load() - ring->hdr.tail.load() >= SLOT_COUNT;
+}
+
+bool ShmRing::push(const void *buf, size_t count) {
+    Header &hdr = ring->hdr;
+    uint32_t head = hdr.head.load(std::memory_order_relaxed);
+
+    if (count > sizeof(Slot::data) || head - hdr.tail.load(std::memory_order_acquire) >= SLOT_COUNT) {
+        return false;
+    }
+
+    Slot &slot = ring->slots[head % SLOT_COUNT];
+    memcpy(slot.data, buf, count);
+    slot.len = count;
+
+    // seq_cst pairs with the consumer setting consumer_waiting then re-checking head
+    hdr.head.store(head + 1);
+    if (hdr.consumer_waiting.load()) {
+        efd_signal(data_efd);
+    }
+    return true;
+}
+
+ssize_t ShmRing::pop(void *buf, size_t count) {
+    Header &hdr = ring->hdr;
+    uint32_t tail = hdr.tail.load(std::memory_order_relaxed);
+
+    if (tail == hdr.head.load(std::memory_order_acquire)) {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    Slot &slot = ring->slots[tail % SLOT_COUNT];
+    size_t len = std::min<size_t>(slot.len, count);
+    memcpy(buf, slot.data, len);
+
+    hdr.tail.store(tail + 1);
+    if (hdr.producer_waiting.load()) {
+        efd_signal(space_efd);
+    }
+    return len;
+}
+
+bool ShmRing::wait_data(int timeout_ms) {
+    if (!empty()) {
+        return true;
+    }
+
+    // Announce we sleep, then re-check so a push in between is not missed.
+    ring->hdr.consumer_waiting.store(1);
+    if (empty()) {
+        efd_wait(data_efd, timeout_ms);
+    }
+    ring->hdr.consumer_waiting.store(0);
+    return !empty();
+}
+
+bool ShmRing::wait_space(int timeout_ms) {
+    if (!full()) {
+        return true;
+    }
+
+    ring->hdr.producer_waiting.store(1);
+    if (full()) {
+        efd_wait(space_efd, timeout_ms);
+    }
+    ring->hdr.producer_waiting.store(0);
+    return !full();
+}
+
+size_t ShmTransport::mem_size() {
+    return 2 * sizeof(ShmRing::Layout);
+}
+
+ShmTransport::ShmTransport(const int *fds, void *mem, Side side) :
+    mem(mem),
+    nonblock(false),
+    // ring 0 carries requests (fds 1, 2), ring 1 carries responces (fds 3, 4)
+    tx(static_cast<ShmRing::Layout *>(mem) + (side == Side::BRIDGE ? 0 : 1),
+       fds[side == Side::BRIDGE ? 1 : 3], fds[side == Side::BRIDGE ? 2 : 4]),
+    rx(static_cast<ShmRing::Layout *>(mem) + (side == Side::BRIDGE ? 1 : 0),
+       fds[side == Side::BRIDGE ? 3 : 1], fds[side == Side::BRIDGE ? 4 : 2])
+{
+    memcpy(this->fds, fds, sizeof(this->fds));
+}
+
+ShmTransport::~ShmTransport() {
+    munmap(mem, mem_size());
+    for (int i = 0; i < FD_COUNT; i++) {
+        close(fds[i]);
+    }
+}
+
+ShmTransport *ShmTransport::create() {
+    int fds[FD_COUNT];
+    std::fill(fds, fds + FD_COUNT, -1);
+
+    fds[0] = memfd_create("mavlink2cam", MFD_CLOEXEC);
+    if (fds[0] < 0 || ftruncate(fds[0], mem_size()) < 0) {
+        fprintf(stderr, "Cannot create camera shared memory: %s\n", strerror(errno));
+        if (fds[0] >= 0) {
+            close(fds[0]);
+        }
+        return nullptr;
+    }
+
+    for (int i = 1; i < FD_COUNT; i++) {
+        fds[i] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    void *mem = mmap(NULL, mem_size(), PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    if (mem == MAP_FAILED || std::find(fds, fds + FD_COUNT, -1) != fds + FD_COUNT) {
+        fprintf(stderr, "Cannot map camera shared memory: %s\n", strerror(errno));
+        if (mem != MAP_FAILED) {
+            munmap(mem, mem_size());
+        }
+        for (int i = 0; i < FD_COUNT; i++) {
+            if (fds[i] >= 0) {
+                close(fds[i]);
+            }
+        }
+        return nullptr;
+    }
+
+    ShmRing::Layout *layout = static_cast<ShmRing::Layout *>(mem);
+    new (&layout[0]) ShmRing::Layout();
+    new (&layout[1]) ShmRing::Layout();
+    return new ShmTransport(fds, mem, Side::BRIDGE);
+}
+
+ShmTransport *ShmTransport::attach(const int *fds) {
+    struct stat st;
+    void *mem = MAP_FAILED;
+
+    if (fstat(fds[0], &st) == 0 && static_cast<size_t>(st.st_size) == mem_size()) {
+        mem = mmap(NULL, mem_size(), PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    }
+
+    if (mem == MAP_FAILED) {
+        fprintf(stderr, "Cannot map camera shared memory\n");
+        for (int i = 0; i < FD_COUNT; i++) {
+            close(fds[i]);
+        }
+        return nullptr;
+    }
+
+    return new ShmTransport(fds, mem, Side::CAMERA);
+}
+
+void ShmTransport::async_mode() {
+    nonblock = true;
+}
+
+bool ShmTransport::wait(short events, int timeout_ms) {
+    if (events & POLLIN) {
+        return rx.wait_data(timeout_ms);
+    }
+    return tx.wait_space(timeout_ms);
+}
+
+ssize_t ShmTransport::read(void *buf, size_t count) {
+    ssize_t ret;
+    while ((ret = rx.pop(buf, count)) < 0 && !nonblock) {
+        rx.wait_data(-1);
+    }
+    return ret;
+}
+
+ssize_t ShmTransport::write(const void *buf, size_t count) {
+    if (count > sizeof(ShmRing::Slot::data)) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+
+    while (!tx.push(buf, count)) {
+        if (nonblock) {
+            errno = EAGAIN;
+            return -1;
+        }
+        tx.wait_space(-1);
+    }
+    return count;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file shm_ring.hpp
+ * @brief Shared-memory request/responce rings between bridge and camera server.
+ */
+
+#ifndef __SHM_RING_HPP__
+#define __SHM_RING_HPP__
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "camera_transport.hpp"
+
+/*
+ * Single producer, single consumer ring of fixed size slots living in a
+ * memfd mapping shared by both processes. Payload is copied once into the
+ * slot by the producer and once out of it by the consumer, the kernel is
+ * only involved through an eventfd when the other side is asleep.
+ */
+class ShmRing {
+public:
+    static constexpr size_t SLOT_SIZE = 512;
+    static constexpr size_t SLOT_COUNT = 64;
+
+    struct Slot {
+        uint32_t len;
+        uint8_t data[SLOT_SIZE - sizeof(uint32_t)];
+    };
+
+    struct Header {
+        alignas(64) std::atomic<uint32_t> head;     // next slot to write, producer owned
+        alignas(64) std::atomic<uint32_t> tail;     // next slot to read, consumer owned
+        alignas(64) std::atomic<uint32_t> consumer_waiting;
+        std::atomic<uint32_t> producer_waiting;
+    };
+
+    struct Layout {
+        Header hdr;
+        Slot slots[SLOT_COUNT];
+    };
+
+    ShmRing(Layout *layout, int data_efd, int space_efd);
+
+    /* Producer side. false when full. */
+    bool push(const void *buf, size_t count);
+    /* Consumer side. -1 with EAGAIN when empty. */
+    ssize_t pop(void *buf, size_t count);
+
+    /* Block until push/pop can make progress. */
+    bool wait_space(int timeout_ms);
+    bool wait_data(int timeout_ms);
+
+    bool empty();
+    bool full();
+
+private:
+    Layout *ring;
+    int data_efd;   // producer -> consumer wakeup
+    int space_efd;  // consumer -> producer wakeup
+};
+
+/*
+ * Request ring towards the camera plus responce ring back, both in one memfd.
+ * The bridge creates it and hands the descriptors to the camera server over
+ * the already connected socket, see SHM_ATTACH in main.cpp.
+ */
+class ShmTransport : public CameraTransport {
+public:
+    // memfd, request data/space eventfds, responce data/space eventfds
+    static constexpr int FD_COUNT = 5;
+
+    enum class Side {
+        BRIDGE,     // writes requests, reads responces
+        CAMERA,     // reads requests, writes responces
+    };
+
+    ~ShmTransport();
+
+    /* Bridge side: allocate memfd and eventfds. nullptr on failure. */
+    static ShmTransport *create();
+    /* Camera side: map descriptors received from the bridge, takes ownership. */
+    static ShmTransport *attach(const int *fds);
+
+    const int *get_fds() const { return fds; }
+
+    void async_mode() override;
+    bool wait(short events, int timeout_ms) override;
+    ssize_t read(void *buf, size_t count) override;
+    ssize_t write(const void *buf, size_t count) override;
+
+private:
+    ShmTransport(const int *fds, void *mem, Side side);
+
+    int fds[FD_COUNT];
+    void *mem;
+    bool nonblock;
+
+    ShmRing tx;
+    ShmRing rx;
+
+    static size_t mem_size();
+};
+
+#endif // __SHM_RING_HPP__
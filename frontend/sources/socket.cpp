@@ -18,6 +18,48 @@
 
 #include "socket.hpp"
 
+#define MAX_PASSED_FDS 8
+
+ssize_t recv_with_fds(int sockfd, void *buf, size_t count, int *fds, int *nfds) {
+    struct iovec iov;
+    iov.iov_base = buf;
+    iov.iov_len = count;
+
+    char control[CMSG_SPACE(MAX_PASSED_FDS * sizeof(int))];
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t ret = ::recvmsg(sockfd, &msg, MSG_CMSG_CLOEXEC);
+    int max_fds = *nfds;
+    *nfds = 0;
+    if (ret < 0) {
+        return ret;
+    }
+
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+
+        int n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        int *passed = reinterpret_cast<int *>(CMSG_DATA(cmsg));
+        for (int i = 0; i < n; i++) {
+            if (*nfds < max_fds) {
+                fds[(*nfds)++] = passed[i];
+            } else {
+                close(passed[i]);
+            }
+        }
+    }
+
+    return ret;
+}
+
 SocketServer::SocketServer(char *name) {
     listen_fd = socket(AF_LOCAL, SOCK_SEQPACKET, 0);
     mAddrLen = 0;
@@ -94,6 +136,11 @@ ssize_t SocketServer::read(void *buf, size_t count) {
     return ::read(getCommFD(), buf, count);
 }
 
+/* Like read(), also returns up to *nfds descriptors passed with SCM_RIGHTS */
+ssize_t SocketServer::read_fds(void *buf, size_t count, int *fds, int *nfds) {
+    return recv_with_fds(getCommFD(), buf, count, fds, nfds);
+}
+
 ssize_t SocketServer::write(const void *buf, size_t count) {
     return ::write(getCommFD(), buf, count);
 }
@@ -140,6 +187,18 @@ bool SocketClient::is_hup() {
     return fds->revents & POLLHUP;
 }
 
+void SocketClient::async_mode() {
+    fcntl(mfd, F_SETFL, fcntl(mfd, F_GETFL) | O_NONBLOCK);
+}
+
+bool SocketClient::wait(short events, int timeout_ms) {
+    struct pollfd pfd;
+    pfd.fd = mfd;
+    pfd.events = events;
+    pfd.revents = 0;
+    return poll(&pfd, 1, timeout_ms) > 0 && (pfd.revents & events);
+}
+
 ssize_t SocketClient::read(void *buf, size_t count) {
     return ::read(getCommFD(), buf, count);
 }
@@ -148,3 +207,29 @@ ssize_t SocketClient::write(const void *buf, size_t count)
 {
     return ::write(getCommFD(), buf, count);
 }
+
+/* Like write(), also passes descriptors to the peer with SCM_RIGHTS */
+ssize_t SocketClient::write_fds(const void *buf, size_t count, const int *fds, int nfds)
+{
+    struct iovec iov;
+    iov.iov_base = const_cast<void *>(buf);
+    iov.iov_len = count;
+
+    char control[CMSG_SPACE(MAX_PASSED_FDS * sizeof(int))];
+    memset(control, 0, sizeof(control));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(nfds * sizeof(int));
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(nfds * sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds, nfds * sizeof(int));
+
+    return ::sendmsg(getCommFD(), &msg, 0);
+}
@@ -8,7 +8,12 @@
 
 #include <sys/un.h>
 
-class SocketClient {
+#include "camera_transport.hpp"
+
+/* recv() one packet, also collecting up to *nfds descriptors passed with SCM_RIGHTS */
+ssize_t recv_with_fds(int sockfd, void *buf, size_t count, int *fds, int *nfds);
+
+class SocketClient : public CameraTransport {
 private:
     int mfd;
     struct sockaddr_un mAddr;
@@ -17,13 +22,16 @@ private:
 
 public:
     SocketClient(char *name);
-    ~SocketClient();
+    ~SocketClient() override;
     bool connect();
     void prepare_hup(struct pollfd *fds);
     bool is_hup();
     int getCommFD();
-    ssize_t read(void *buf, size_t count);
-    ssize_t write(const void *buf, size_t count);
+    void async_mode() override;
+    bool wait(short events, int timeout_ms) override;
+    ssize_t read(void *buf, size_t count) override;
+    ssize_t write(const void *buf, size_t count) override;
+    ssize_t write_fds(const void *buf, size_t count, const int *fds, int nfds);
 };
 
 class SocketServer {
@@ -49,6 +57,7 @@ public:
     bool is_request_connect();
     void async_mode();
     ssize_t read(void *buf, size_t count);
+    ssize_t read_fds(void *buf, size_t count, int *fds, int *nfds);
     ssize_t write(const void *buf, size_t count);
 };
 
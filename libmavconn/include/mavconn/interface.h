@@ -35,6 +35,12 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <mavconn/mavlink_dialect.h>
+#include <mavconn/msgbuffer.h>
+#include <mavconn/txqueue.h>
+#include <mavconn/shaper.h>
+#include <mavconn/uring.h>
+#include <mavconn/trace.h>
+#include <mavconn/tlog.h>
 
 
 namespace mavconn {
@@ -52,6 +58,14 @@ enum class Framing : uint8_t {
 	bad_signature = mavlink::MAVLINK_FRAMING_BAD_SIGNATURE,
 };
 
+//! Outcome of a try_send_*() call
+enum class SendStatus : uint8_t {
+	queued = 0,		//!< accepted for sending
+	dropped_full,		//!< TX queue limit reached
+	closed,			//!< link is not open
+	no_remote,		//!< nobody to send to yet (UDP peer unknown, no TCP clients)
+};
+
 //! MAVLink protocol version
 enum class Protocol : uint8_t {
 	V10 = 1,	//!< MAVLink v1.0
@@ -112,6 +126,14 @@ public:
 		float rx_speed;		//!< current receive speed [B/s]
 	};
 
+	//! Sends refused by this link, by SendStatus
+	struct SendStats {
+		size_t dropped_full;
+		size_t closed;
+		size_t no_remote;
+		size_t coalesced;	//!< queued by replacing an older frame, see TxQueueConfig::coalesce
+	};
+
 	/**
 	 * @param[in] system_id     sysid for send_message
 	 * @param[in] component_id  compid for send_message
@@ -133,7 +155,7 @@ public:
 	 * @throws std::length_error  On exceeding Tx queue limit (MAX_TXQ_SIZE)
 	 * @param[in] *message  not changed
 	 */
-	virtual void send_message(const mavlink::mavlink_message_t *message) = 0;
+	virtual void send_message(const mavlink::mavlink_message_t *message);
 
 	/**
 	 * @brief Send message (child of mavlink::Message)
@@ -144,13 +166,62 @@ public:
 	 * @throws std::length_error  On exceeding Tx queue limit (MAX_TXQ_SIZE)
 	 * @param[in] &message  not changed
 	 */
-	virtual void send_message(const mavlink::Message &message) = 0;
+	virtual void send_message(const mavlink::Message &message);
+
+	/**
+	 * @brief Send message of a type known at compile time
+	 *
+	 * Same as send_message(const mavlink::Message &), but serializes
+	 * straight into the frame using _Msg::MSG_ID, LENGTH and CRC_EXTRA,
+	 * without virtual calls and without an intermediate mavlink_message_t.
+	 * The frame is built in its TX queue entry, under the link's lock.
+	 *
+	 * @throws std::length_error  On exceeding Tx queue limit (MAX_TXQ_SIZE)
+	 * @param[in] &message  not changed
+	 */
+	template<typename _Msg>
+	void send(const _Msg &message) {
+		if (try_send_encoded(MsgBuffer::Encoder(message), TxPriority::automatic) == SendStatus::dropped_full)
+			throw std::length_error("MAVConnInterface::send: TX queue overflow");
+	}
 
 	/**
 	 * @brief Send raw bytes (for some quirks)
 	 * @throws std::length_error  On exceeding Tx queue limit (MAX_TXQ_SIZE)
 	 */
-	virtual void send_bytes(const uint8_t *bytes, size_t length) = 0;
+	virtual void send_bytes(const uint8_t *bytes, size_t length);
+
+	/**
+	 * @brief Non-throwing send
+	 *
+	 * Same as send_message(), a full TX queue is reported instead of thrown,
+	 * which keeps overload as cheap as normal operation.
+	 * Refused sends are counted, see get_send_stats().
+	 *
+	 * @param[in] priority  TX queue class, by msgid if automatic (see set_tx_queue_config())
+	 */
+	virtual SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) = 0;
+	virtual SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) = 0;
+	virtual SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) = 0;
+
+	//! Non-throwing send<_Msg>()
+	template<typename _Msg>
+	SendStatus try_send(const _Msg &message, TxPriority priority = TxPriority::automatic) {
+		return try_send_encoded(MsgBuffer::Encoder(message), priority);
+	}
+
+	/**
+	 * @brief Queue the frame of send<_Msg>()
+	 *
+	 * Encodes with MsgBuffer(const MsgBuffer::Encoder &, ...) where the
+	 * frame is stored, taking the sequence number under the same lock
+	 * as try_send_message(const mavlink::Message &).
+	 */
+	virtual SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) = 0;
 
 	/**
 	 * @brief Send message and ignore possible drop due to Tx queue limit
@@ -169,8 +240,37 @@ public:
 
 	virtual mavlink::mavlink_status_t get_status();
 	virtual IOStat get_iostat();
+	virtual SendStats get_send_stats();
 	virtual bool is_open() = 0;
 
+	/**
+	 * @brief Record received frames and frames queued for sending
+	 *
+	 * Several links may share one writer.
+	 *
+	 * @param[in] writer  tlog to append to, nullptr stops recording
+	 */
+	virtual void set_recorder(std::shared_ptr<TlogWriter> writer);
+	std::shared_ptr<TlogWriter> get_recorder();
+
+	/**
+	 * @brief Priority classes, coalescing and shaping of the TX queue
+	 *
+	 * Applies to frames queued from now on. Links without a queue
+	 * (replay, router endpoints) ignore it.
+	 */
+	virtual void set_tx_queue_config(const TxQueueConfig &) {}
+
+	//! Pacing of the TX queue, see TxQueueConfig::rate
+	virtual TxShaper::Stats get_shaping_stats() {
+		return TxShaper::Stats {};
+	}
+
+	//! Backend the link receives with, IoBackend::asio where io_uring was not asked for or not available
+	virtual IoBackend get_io_backend() {
+		return IoBackend::asio;
+	}
+
 	inline uint8_t get_system_id() {
 		return sys_id;
 	}
@@ -198,8 +298,16 @@ public:
 	 * - udp://
 	 * - tcp://
 	 * - tcp-l://
+	 * - unix://
+	 * - unix-l://
+	 * - shm://
+	 * - shm-w://
+	 * - file:// (tlog replay)
+	 * - replay://
 	 *
 	 * Please see user's documentation for details.
+	 * Links that read a socket or a tty take ?rxbuf=bytes to size the
+	 * receive buffer; replay and shm have their own.
 	 *
 	 * @param[in] url           resource locator
 	 * @param[in] system_id     optional system id
@@ -220,6 +328,16 @@ protected:
 	static constexpr size_t MAX_PACKET_SIZE = MAVLINK_MAX_PACKET_LEN + 16;
 	//! Maximum count of transmission buffers.
 	static constexpr size_t MAX_TXQ_SIZE = 1000;
+	//! Smallest receive buffer: one whole frame. Frames may straddle reads.
+	static constexpr size_t MIN_RX_BUFFER_SIZE = MsgBuffer::MAX_SIZE;
+	//! Largest receive buffer, far beyond what one read returns
+	static constexpr size_t MAX_RX_BUFFER_SIZE = 16 * 1024 * 1024;
+
+	static inline size_t clamp_rx_buffer_size(size_t requested) {
+		if (requested < MIN_RX_BUFFER_SIZE)
+			return MIN_RX_BUFFER_SIZE;
+		return (requested < MAX_RX_BUFFER_SIZE) ? requested : size_t(MAX_RX_BUFFER_SIZE);
+	}
 
 	//! This map merge all dialect mavlink_msg_entry_t structs. Needed for packet parser.
 	static std::unordered_map<mavlink::msgid_t, const mavlink::mavlink_msg_entry_t*> message_entries;
@@ -243,17 +361,81 @@ protected:
 	void iostat_tx_add(size_t bytes);
 	void iostat_rx_add(size_t bytes);
 
-	void log_recv(const char *pfx, mavlink::mavlink_message_t &msg, Framing framing);
-	void log_send(const char *pfx, const mavlink::mavlink_message_t *msg);
-	void log_send_obj(const char *pfx, const mavlink::Message &msg);
+	//! Count a refused send, for try_send_*() returns
+	inline SendStatus send_refused(SendStatus status) {
+		n_send_refused[static_cast<size_t>(status)].fetch_add(1, std::memory_order_relaxed);
+		return status;
+	}
+
+	//! Count a send that replaced a queued frame of its stream
+	inline void send_coalesced() {
+		n_send_coalesced.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//! Recording tap for the TX queue, call with the buffer just queued
+	inline void record_tx(const MsgBuffer &buf) {
+		if (recording_tx.load(std::memory_order_relaxed))
+			record_frame(buf.data + buf.pos, buf.len - buf.pos);
+	}
+
+	void record_frame(const uint8_t *frame, size_t length);
+
+	/**
+	 * @brief Record received frames only
+	 *
+	 * For the clients of a server: the server records each frame it
+	 * sends once, not once per client.
+	 */
+	void set_rx_recorder(std::shared_ptr<TlogWriter> writer);
+
+	/**
+	 * Trace hooks, see trace.h.
+	 * Compiled out with MAVCONN_TRACE=0, a single flag test otherwise.
+	 */
+	inline void log_recv(const char *, mavlink::mavlink_message_t &msg, Framing framing) {
+#if MAVCONN_TRACE
+		if (trace::enabled())
+			trace::record(trace::Event::recv, conn_id, &msg, static_cast<uint8_t>(framing));
+#else
+		(void)msg;
+		(void)framing;
+#endif
+	}
+
+	inline void log_send(const char *, const mavlink::mavlink_message_t *msg) {
+#if MAVCONN_TRACE
+		if (trace::enabled())
+			trace::record(trace::Event::send, conn_id, msg);
+#else
+		(void)msg;
+#endif
+	}
+
+	inline void log_send_obj(const char *, const mavlink::Message &msg) {
+#if MAVCONN_TRACE
+		if (trace::enabled()) {
+			auto info = msg.get_message_info();
+			trace::record(trace::Event::send_obj, conn_id, info.id, 0, 0, sys_id, comp_id);
+		}
+#else
+		(void)msg;
+#endif
+	}
 
 private:
 	friend const mavlink::mavlink_msg_entry_t* mavlink::mavlink_get_msg_entry(uint32_t msgid);
+	friend class TlogReader;	// decodes without a link
 
 	mavlink::mavlink_status_t m_status;
 	mavlink::mavlink_message_t m_buffer;
 
+	std::atomic<bool> recording;		//!< received frames
+	std::atomic<bool> recording_tx;		//!< queued frames
+	std::shared_ptr<TlogWriter> recorder;		//!< use atomic_load/atomic_store
+
 	std::atomic<size_t> tx_total_bytes, rx_total_bytes;
+	std::atomic<size_t> n_send_refused[4];	//!< indexed by SendStatus
+	std::atomic<size_t> n_send_coalesced;
 	std::recursive_mutex iostat_mutex;
 	size_t last_tx_total_bytes, last_rx_total_bytes;
 	std::chrono::time_point<steady_clock> last_iostat;
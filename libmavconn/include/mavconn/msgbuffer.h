@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <new>
 #include <cassert>
+#include <cstddef>
 #include <mavconn/mavlink_dialect.h>
 
 namespace mavconn {
@@ -66,6 +68,108 @@ struct MsgBuffer {
 		assert(len < MAX_SIZE);
 	}
 
+	//! Tag for the typed constructor
+	struct Typed {};
+
+	/**
+	 * @brief Buffer constructor for a message type known at compile time.
+	 *
+	 * Uses _Msg::MSG_ID, LENGTH, MIN_LENGTH and CRC_EXTRA instead of
+	 * get_message_info(), calls serialize() without virtual dispatch and
+	 * lets MsgMap write the payload straight into the frame:
+	 * a mavlink_message_t header is overlaid in front of the frame, so its
+	 * payload64 starts right behind the frame header. The frame starts at @a pos.
+	 *
+	 * @note Signing is not supported (same as the rest of libmavconn).
+	 */
+	template<typename _Msg>
+	MsgBuffer(const _Msg &obj, mavlink::mavlink_status_t *status, uint8_t sysid, uint8_t compid, Typed)
+	{
+		encode_typed(obj, status, sysid, compid);
+	}
+
+	/**
+	 * @brief Typed constructor behind a plain function pointer
+	 *
+	 * Carries a message of a compile-time type through a virtual call,
+	 * so a link can encode it right into its TX queue entry, under the
+	 * lock that guards the sequence number.
+	 */
+	struct Encoder {
+		const void *obj;
+		mavlink::msgid_t msgid;
+		void (*encode)(MsgBuffer *buf, const void *obj, mavlink::mavlink_status_t *status,
+				uint8_t sysid, uint8_t compid);
+
+		template<typename _Msg>
+		explicit Encoder(const _Msg &msg) :
+			obj(&msg),
+			msgid(_Msg::MSG_ID),
+			encode([](MsgBuffer *buf, const void *obj, mavlink::mavlink_status_t *status,
+						uint8_t sysid, uint8_t compid) {
+					buf->encode_typed(*static_cast<const _Msg *>(obj), status, sysid, compid);
+				})
+		{ }
+	};
+
+	/**
+	 * @brief Buffer constructor from an Encoder, same frame as the typed constructor
+	 */
+	MsgBuffer(const Encoder &enc, mavlink::mavlink_status_t *status, uint8_t sysid, uint8_t compid)
+	{
+		enc.encode(this, enc.obj, status, sysid, compid);
+	}
+
+	//! Body of the typed constructor
+	template<typename _Msg>
+	void encode_typed(const _Msg &obj, mavlink::mavlink_status_t *status, uint8_t sysid, uint8_t compid)
+	{
+		static_assert(sizeof(mavlink::mavlink_message_t) <= MAX_SIZE, "message overlay does not fit");
+
+		const bool mavlink1 = (status->flags & MAVLINK_STATUS_FLAG_OUT_MAVLINK1) != 0;
+		const size_t header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_NUM_HEADER_BYTES;
+
+		pos = offsetof(mavlink::mavlink_message_t, payload64) - header_len;
+		auto msg = new (data) mavlink::mavlink_message_t;
+		mavlink::MsgMap map(msg);
+		obj._Msg::serialize(map);
+
+		uint8_t *frame = data + pos;
+		uint8_t *payload = frame + header_len;
+		uint8_t length;
+
+		if (mavlink1) {
+			length = _Msg::MIN_LENGTH;
+			frame[0] = MAVLINK_STX_MAVLINK1;
+			frame[1] = length;
+			frame[2] = status->current_tx_seq++;
+			frame[3] = sysid;
+			frame[4] = compid;
+			frame[5] = _Msg::MSG_ID & 0xff;
+		}
+		else {
+			length = mavlink::_mav_trim_payload(reinterpret_cast<const char *>(payload), _Msg::LENGTH);
+			frame[0] = MAVLINK_STX;
+			frame[1] = length;
+			frame[2] = 0;	// incompat_flags
+			frame[3] = 0;	// compat_flags
+			frame[4] = status->current_tx_seq++;
+			frame[5] = sysid;
+			frame[6] = compid;
+			frame[7] = _Msg::MSG_ID & 0xff;
+			frame[8] = (_Msg::MSG_ID >> 8) & 0xff;
+			frame[9] = (_Msg::MSG_ID >> 16) & 0xff;
+		}
+
+		uint16_t crc = mavlink::crc_calculate(frame + 1, header_len - 1);
+		mavlink::crc_accumulate_buffer(&crc, reinterpret_cast<const char *>(payload), length);
+		mavlink::crc_accumulate(_Msg::CRC_EXTRA, &crc);
+		payload[length] = crc & 0xff;
+		payload[length + 1] = crc >> 8;
+
+		len = pos + header_len + length + MAVLINK_NUM_CHECKSUM_BYTES;
+	}
+
 	/**
 	 * @brief Buffer constructor for send_bytes()
 	 * @param[in] nbytes should be less than MAX_SIZE
@@ -87,6 +191,27 @@ struct MsgBuffer {
 		return data + pos;
 	}
 
+	/**
+	 * @brief Message id of the frame starting at pos
+	 * @return msgid, -1 for raw bytes that do not start a frame
+	 */
+	int64_t msgid() const {
+		return frame_msgid(data + pos, len - pos);
+	}
+
+	/**
+	 * @brief Message id from a frame header
+	 * @return msgid, -1 if @a p does not start a frame
+	 */
+	static int64_t frame_msgid(const uint8_t *p, ssize_t length) {
+		if (length > 5 && p[0] == MAVLINK_STX_MAVLINK1)
+			return p[5];
+		else if (length > 9 && p[0] == MAVLINK_STX)
+			return p[7] | (p[8] << 8) | (p[9] << 16);
+		else
+			return -1;
+	}
+
 	ssize_t nbytes() {
 		return len - pos;
 	}
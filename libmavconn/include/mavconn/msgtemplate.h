@@ -0,0 +1,213 @@
+/**
+ * @brief MAVConn pre-encoded message template
+ * @file msgtemplate.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <mavconn/mavlink_dialect.h>
+
+namespace mavconn {
+/**
+ * @brief Ready to send MAVLink frame of one message type.
+ *
+ * Serializes the initial message once, then payload fields are patched in
+ * place by wire offset (offsetof() the mavconn::wire layouts, see wire.h)
+ * and finalize() only fills in length, sequence and CRC.
+ * Meant for messages sent over and over with few changing fields:
+ * heartbeats, acks, parameter values.
+ *
+ * MAVLink 1 framing is used like in MsgBuffer: when asked for, or when the
+ * status has MAVLINK_STATUS_FLAG_OUT_MAVLINK1 set; the payload is then cut
+ * to MIN_LENGTH and only the low byte of the msgid is sent.
+ *
+ * Not thread safe, use one template per sending thread.
+ * Fields are stored in host byte order, same as MsgMap on little endian
+ * targets; signing is not supported.
+ */
+template<typename _Msg>
+class MsgTemplate {
+public:
+	static constexpr size_t HEADER_LEN = MAVLINK_NUM_HEADER_BYTES;
+	static constexpr size_t V1_HEADER_LEN = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1;
+	static constexpr size_t MAX_FRAME_LEN = MAVLINK_NUM_NON_PAYLOAD_BYTES + _Msg::LENGTH;
+
+	/**
+	 * @param[in] sysid, compid  source of the frame
+	 * @param[in] init           initial field values
+	 */
+	MsgTemplate(uint8_t sysid, uint8_t compid, const _Msg &init = _Msg()) :
+		pos(0),
+		len(0),
+		crc_pos(MAX_FRAME_LEN - MAVLINK_NUM_CHECKSUM_BYTES),
+		dirty(true),
+		mavlink1(false),
+		sysid(sysid),
+		compid(compid),
+		crc_prefix(0)
+	{
+		mavlink::mavlink_message_t msg;
+		mavlink::MsgMap map(msg);
+		init.serialize(map);
+
+		std::memset(frame, 0, sizeof(frame));
+		std::memset(under_crc, 0, sizeof(under_crc));
+		std::memcpy(payload(), _MAV_PAYLOAD(&msg), _Msg::LENGTH);
+	}
+
+	/**
+	 * @brief Set scalar field at payload offset
+	 */
+	template<typename _T>
+	void set(size_t offset, _T value) {
+		static_assert(std::is_arithmetic<_T>::value, "use set_string() or set_array()");
+		assert(offset + sizeof(_T) <= _Msg::LENGTH);
+		touch();
+		std::memcpy(payload() + offset, &value, sizeof(_T));
+	}
+
+	/**
+	 * @brief Set char[size] field, zero padded, not terminated when full (like mavlink::set_string)
+	 */
+	void set_string(size_t offset, size_t size, const char *str) {
+		assert(offset + size <= _Msg::LENGTH);
+		touch();
+		std::strncpy(reinterpret_cast<char *>(payload() + offset), str, size);
+	}
+
+	/**
+	 * @brief Set array field
+	 */
+	template<typename _T, size_t _N>
+	void set_array(size_t offset, const std::array<_T, _N> &value) {
+		assert(offset + sizeof(value) <= _Msg::LENGTH);
+		touch();
+		std::memcpy(payload() + offset, value.data(), sizeof(value));
+	}
+
+	/**
+	 * @brief Fill in length, sequence and CRC
+	 * @param[in] seq        sequence number
+	 * @param[in] v1         MAVLink 1 framing
+	 * @return frame length
+	 */
+	size_t finalize(uint8_t seq, bool v1 = false) {
+		if (v1 != mavlink1) {
+			touch();
+			mavlink1 = v1;
+		}
+
+		if (dirty) {
+			// The payload stays put, a MAVLink 1 header ends where a MAVLink 2 one does
+			if (mavlink1) {
+				len = _Msg::MIN_LENGTH;
+				pos = HEADER_LEN - V1_HEADER_LEN;
+				frame[pos + 0] = MAVLINK_STX_MAVLINK1;
+				frame[pos + 1] = len;
+				frame[pos + 3] = sysid;
+				frame[pos + 4] = compid;
+				frame[pos + 5] = _Msg::MSG_ID & 0xff;
+			}
+			else {
+				len = _Msg::LENGTH;
+				while (len > 1 && payload()[len - 1] == 0)
+					len--;
+
+				pos = 0;
+				frame[0] = MAVLINK_STX;
+				frame[1] = len;
+				frame[2] = 0;	// incompat_flags
+				frame[3] = 0;	// compat_flags
+				frame[5] = sysid;
+				frame[6] = compid;
+				frame[7] = _Msg::MSG_ID & 0xff;
+				frame[8] = (_Msg::MSG_ID >> 8) & 0xff;
+				frame[9] = (_Msg::MSG_ID >> 16) & 0xff;
+			}
+
+			crc_pos = HEADER_LEN + len;
+			// the CRC goes over payload bytes that are not sent, touch() puts them back
+			under_crc[0] = frame[crc_pos];
+			under_crc[1] = frame[crc_pos + 1];
+
+			// bytes in front of seq stay the same until the payload changes
+			mavlink::crc_init(&crc_prefix);
+			for (size_t i = pos + 1; i < seq_pos(); i++)
+				mavlink::crc_accumulate(frame[i], &crc_prefix);
+
+			dirty = false;
+		}
+
+		frame[seq_pos()] = seq;
+
+		uint16_t crc = crc_prefix;
+		for (size_t i = seq_pos(); i < crc_pos; i++)
+			mavlink::crc_accumulate(frame[i], &crc);
+		mavlink::crc_accumulate(_Msg::CRC_EXTRA, &crc);
+
+		frame[crc_pos] = crc & 0xff;
+		frame[crc_pos + 1] = crc >> 8;
+
+		return size();
+	}
+
+	/**
+	 * @brief Finalize with the next sequence number and the framing of a channel
+	 */
+	size_t finalize(mavlink::mavlink_status_t *status) {
+		return finalize(status->current_tx_seq++, (status->flags & MAVLINK_STATUS_FLAG_OUT_MAVLINK1) != 0);
+	}
+
+	//! Frame bytes, valid after finalize()
+	const uint8_t *data() const {
+		return frame + pos;
+	}
+
+	//! Frame length of the last finalize()
+	size_t size() const {
+		return crc_pos + MAVLINK_NUM_CHECKSUM_BYTES - pos;
+	}
+
+private:
+	uint8_t frame[MAX_FRAME_LEN];
+	size_t pos;
+	size_t len;
+	size_t crc_pos;
+	bool dirty;
+	bool mavlink1;
+	uint8_t sysid;
+	uint8_t compid;
+	uint8_t under_crc[2];
+	uint16_t crc_prefix;
+
+	uint8_t *payload() {
+		return frame + HEADER_LEN;
+	}
+
+	size_t seq_pos() const {
+		return mavlink1 ? pos + 2 : 4;
+	}
+
+	void touch() {
+		if (!dirty) {
+			frame[crc_pos] = under_crc[0];
+			frame[crc_pos + 1] = under_crc[1];
+		}
+		dirty = true;
+	}
+};
+}	// namespace mavconn
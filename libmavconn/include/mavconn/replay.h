@@ -0,0 +1,96 @@
+/**
+ * @brief MAVConn tlog replay link class
+ * @file replay.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mavconn/interface.h>
+#include <mavconn/msgbuffer.h>
+
+namespace mavconn {
+/**
+ * @brief Replays a recorded tlog as if it was received
+ *
+ * Frames are fed through the regular parser, so at Rate::max the link
+ * measures parser and callback throughput on real flight data.
+ * Sent messages go nowhere, they are only counted and recorded.
+ *
+ * Replay starts with start(), once message_received_cb is set
+ * (open_url() does not start it). At the end of the file the link
+ * closes and calls port_closed_cb.
+ */
+class MAVConnReplay : public MAVConnInterface {
+public:
+	enum class Rate {
+		realtime,	//!< keep the recorded timing
+		max,		//!< as fast as the parser goes
+	};
+
+	//! Bytes read from the file at once
+	static constexpr size_t READ_SIZE = 64 * 1024;
+
+	/**
+	 * @param[in] path  tlog file
+	 * @param[in] rate  replay speed
+	 */
+	MAVConnReplay(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+			std::string path = "", Rate rate = Rate::realtime);
+	~MAVConnReplay();
+
+	void close() override;
+
+	//! Begin the replay, callbacks must not change after this
+	void start();
+
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	inline bool is_open() override {
+		return !closed;
+	}
+
+	//! Frames replayed so far
+	inline size_t frames() {
+		return n_frames;
+	}
+
+	//! Bytes skipped because they did not form a record
+	inline size_t skipped() {
+		return n_skipped;
+	}
+
+private:
+	int fd;
+	Rate rate;
+	std::thread replay_thread;
+	std::atomic<bool> running;
+	std::atomic<bool> closed;
+	std::mutex wait_mutex;
+	std::condition_variable wait_cond;
+
+	std::atomic<size_t> n_frames;
+	std::atomic<size_t> n_skipped;
+
+	bool wait_until(steady_clock::time_point tp);
+	void run();
+};
+}	// namespace mavconn
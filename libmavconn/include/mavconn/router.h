@@ -0,0 +1,121 @@
+/**
+ * @brief MAVConn message router
+ * @file router.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <mavconn/interface.h>
+
+namespace mavconn {
+class MAVConnRouterPort;
+
+/**
+ * @brief Routes messages between several links
+ *
+ * Follows the MAVLink routing rules:
+ * - every received message teaches the router that its (sysid, compid)
+ *   is reachable through the link it came in on;
+ * - messages without a target, or with target_system 0, go to every
+ *   other link;
+ * - targeted messages go only to the links the target was seen on
+ *   (the target system's links if the component was never seen);
+ * - messages are never sent back to the link they came from,
+ *   and frames with a bad CRC are not forwarded.
+ *
+ * Forwarding sends the frame bytes as received, signature included,
+ * rebuilt once per message however many links it goes to.
+ *
+ * The router takes over message_received_cb of the links it is given.
+ * A removed link keeps a callback that no longer routes anything.
+ * A program that is itself a MAVLink node talks through open_local(),
+ * which is routed like any other link.
+ */
+class Router {
+public:
+	using LinkId = size_t;
+
+	struct Stats {
+		size_t received;	//!< good frames from all links
+		size_t forwarded;	//!< frames handed to links
+		size_t dropped;		//!< lost to full TX queues
+		size_t unroutable;	//!< targeted to nobody we know
+		size_t bad_frames;	//!< bad CRC or signature, not forwarded
+	};
+
+	Router();
+	~Router();
+
+	Router(const Router&) = delete;
+
+	/**
+	 * @brief Route traffic of a link
+	 * @return id used by remove_link() and routes()
+	 */
+	LinkId add_link(MAVConnInterface::Ptr link);
+
+	void remove_link(LinkId id);
+
+	/**
+	 * @brief Local endpoint
+	 *
+	 * Messages sent on the returned interface enter the router as if
+	 * received from a link; its message_received_cb gets what is routed
+	 * to the ids it sends from and all broadcasts.
+	 * The endpoint leaves the router when closed or released.
+	 */
+	MAVConnInterface::Ptr open_local(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE);
+
+	//! Links on which @a sysid / @a compid was seen, compid 0 for any component
+	std::vector<LinkId> routes(uint8_t sysid, uint8_t compid = 0);
+
+	Stats get_stats();
+
+private:
+	friend class MAVConnRouterPort;
+
+	using DeliverFn = std::function<void (const mavlink::mavlink_message_t *msg, const uint8_t *frame, size_t length)>;
+
+	struct Link {
+		LinkId id;
+		MAVConnInterface::Ptr link;		//!< nullptr for local endpoints
+		std::weak_ptr<MAVConnRouterPort> port;	//!< local endpoint
+		DeliverFn deliver;
+
+		std::recursive_mutex cb_mutex;		//!< held while the link's callback routes
+		bool active = true;			//!< false once removed, under cb_mutex
+	};
+
+	std::mutex mutex;
+	std::vector<std::shared_ptr<Link>> links;	//!< indexed by LinkId, nullptr once removed
+	std::unordered_map<uint16_t, std::vector<LinkId>> component_routes;	//!< sysid << 8 | compid
+	std::unordered_map<uint8_t, std::vector<LinkId>> system_routes;
+
+	std::atomic<size_t> n_received;
+	std::atomic<size_t> n_forwarded;
+	std::atomic<size_t> n_dropped;
+	std::atomic<size_t> n_unroutable;
+	std::atomic<size_t> n_bad_frames;
+
+	LinkId add(std::shared_ptr<Link> l);
+	void deactivate(Link &l);
+	void learn(LinkId from, uint8_t sysid, uint8_t compid);
+	void route(LinkId from, const mavlink::mavlink_message_t *msg, Framing framing);
+};
+}	// namespace mavconn
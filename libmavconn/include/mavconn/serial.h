@@ -31,22 +31,39 @@ class MAVConnSerial : public MAVConnInterface,
 public:
 	static constexpr auto DEFAULT_DEVICE = "/dev/ttyACM0";
 	static constexpr auto DEFAULT_BAUDRATE = 57600;
+	//! Room for several frames per read at high baudrates
+	static constexpr size_t DEFAULT_RX_BUFFER_SIZE = 4096;
 
 	/**
 	 * Open and run serial link.
 	 *
 	 * @param[in] device    TTY device path
 	 * @param[in] baudrate  serial baudrate
+	 * @param[in] rx_buffer_size  bytes read at once
+	 * @param[in] io_backend      receive on io_uring if available
 	 */
 	MAVConnSerial(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
-			std::string device = DEFAULT_DEVICE, unsigned baudrate = DEFAULT_BAUDRATE, bool hwflow = false);
+			std::string device = DEFAULT_DEVICE, unsigned baudrate = DEFAULT_BAUDRATE, bool hwflow = false,
+			size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE, IoBackend io_backend = IoBackend::asio);
 	~MAVConnSerial();
 
 	void close() override;
 
-	void send_message(const mavlink::mavlink_message_t *message) override;
-	void send_message(const mavlink::Message &message) override;
-	void send_bytes(const uint8_t *bytes, size_t length) override;
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	void set_tx_queue_config(const TxQueueConfig &config) override;
+	TxShaper::Stats get_shaping_stats() override;
+
+	inline IoBackend get_io_backend() override {
+		return rx_uring ? IoBackend::uring : IoBackend::asio;
+	}
 
 	inline bool is_open() override {
 		return serial_dev.is_open();
@@ -54,14 +71,21 @@ public:
 
 private:
 	boost::asio::io_service io_service;
+	std::unique_ptr<boost::asio::io_service::work> io_work;	//!< only writes run on asio with io_uring
 	std::thread io_thread;
 	boost::asio::serial_port serial_dev;
 
 	std::atomic<bool> tx_in_progress;
-	std::deque<MsgBuffer> tx_q;
-	std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+	TxQueue<MsgBuffer> tx_q;
+	TxShaper tx_shaper;
+	boost::asio::steady_timer tx_timer;
+	std::vector<uint8_t> rx_buf;
+	std::unique_ptr<UringReader> rx_uring;
 	std::recursive_mutex mutex;
 
+	//! Queue a coalesced frame, replacing the queued one of its stream; mutex held
+	bool queue_latest(size_t cls, const MsgBuffer &buf);
+
 	void do_read();
 	void do_write(bool check_tx_state);
 };
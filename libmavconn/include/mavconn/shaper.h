@@ -0,0 +1,207 @@
+/**
+ * @brief MAVConn transmit bandwidth shaping
+ * @file shaper.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <chrono>
+#include <algorithm>
+#include <unordered_map>
+#include <mavconn/txqueue.h>
+
+namespace mavconn {
+/**
+ * @brief Token bucket counting bytes
+ *
+ * Fills at rate bytes/s up to burst bytes.
+ * A frame larger than the burst goes out on a full bucket and leaves it
+ * in debt, so the average rate still holds.
+ */
+class TokenBucket {
+public:
+	using clock = std::chrono::steady_clock;
+
+	TokenBucket(size_t rate_ = 0, size_t burst_ = 0, clock::time_point now = clock::now()) :
+		rate(rate_),
+		burst(std::max<size_t>(burst_ != 0 ? burst_ : rate_ / 10, MAVLINK_MAX_PACKET_LEN)),
+		tokens(burst),
+		last(now)
+	{ }
+
+	//! Time until @a bytes may go, zero if they may go now
+	clock::duration wait(size_t bytes, clock::time_point now) {
+		refill(now);
+
+		double need = std::min<double>(bytes, burst);
+		if (tokens >= need)
+			return clock::duration::zero();
+		if (rate <= 0)
+			return clock::duration::max();
+
+		auto wait = std::chrono::duration<double>((need - tokens) / rate);
+		return std::chrono::duration_cast<clock::duration>(wait) + clock::duration(1);
+	}
+
+	void take(size_t bytes) {
+		tokens -= bytes;
+	}
+
+private:
+	double rate;
+	double burst;
+	double tokens;
+	clock::time_point last;
+
+	void refill(clock::time_point now) {
+		if (now <= last)
+			return;
+
+		tokens = std::min(burst, tokens + rate * std::chrono::duration<double>(now - last).count());
+		last = now;
+	}
+};
+
+/**
+ * @brief Paces a TX queue to the link throughput
+ *
+ * Called by the drain loop before each frame. The link bucket
+ * (TxQueueConfig::rate) holds frames back until the link can take them,
+ * so they wait in our queue where priorities and coalescing still apply
+ * instead of in the radio's buffer.
+ * Per-msgid buckets (TxQueueConfig::msgid_rate) cap single streams:
+ * a frame over its budget is dropped, it must not hold back the others.
+ *
+ * Not thread safe, the link guards it with its mutex.
+ */
+class TxShaper {
+public:
+	using clock = TokenBucket::clock;
+
+	enum class Verdict {
+		send,		//!< front() may go now
+		wait,		//!< try again after the returned time
+		empty,		//!< nothing left to send
+	};
+
+	struct Stats {
+		size_t frames_sent;	//!< frames let through
+		size_t bytes_sent;
+		size_t frames_delayed;	//!< frames held back by the link bucket
+		size_t frames_dropped;	//!< frames over their msgid budget
+		std::chrono::microseconds delay;	//!< total time frames were held back
+	};
+
+	TxShaper() :
+		enabled(false),
+		link_limited(false),
+		in_frame(false),
+		delayed(false),
+		stats {}
+	{ }
+
+	void configure(const TxQueueConfig &cfg) {
+		auto now = clock::now();
+
+		enabled = cfg.rate != 0 || !cfg.msgid_rate.empty();
+		link = TokenBucket(cfg.rate, cfg.burst, now);
+		link_limited = cfg.rate != 0;
+
+		msgid_bucket.clear();
+		for (auto &kv : cfg.msgid_rate)
+			msgid_bucket.emplace(kv.first, TokenBucket(kv.second, 0, now));
+	}
+
+	/**
+	 * @brief Decide on the front frame of @a q
+	 *
+	 * Drops frames over their msgid budget and charges the buckets
+	 * for the frame that may go. A frame partly written is always let through.
+	 *
+	 * @param frame_of  returns the MsgBuffer of a queue entry
+	 * @param[out] wait set with Verdict::wait
+	 */
+	template<typename T, typename FrameOf>
+	Verdict pace(TxQueue<T> &q, FrameOf frame_of, clock::duration &wait) {
+		if (q.empty())
+			return Verdict::empty;
+		if (!enabled || in_frame)
+			return Verdict::send;
+
+		auto now = clock::now();
+		for (;;) {
+			const MsgBuffer &buf = frame_of(q.front());
+			const size_t bytes = buf.len - buf.pos;
+
+			TokenBucket *msgid_limit = nullptr;
+			auto it = msgid_bucket.find(buf.msgid());
+			if (it != msgid_bucket.end()) {
+				msgid_limit = &it->second;
+				if (msgid_limit->wait(bytes, now) != clock::duration::zero()) {
+					stats.frames_dropped++;
+					q.pop_front();
+					if (q.empty())
+						return Verdict::empty;
+					continue;
+				}
+			}
+
+			if (link_limited) {
+				wait = link.wait(bytes, now);
+				if (wait != clock::duration::zero()) {
+					if (!delayed) {
+						delayed = true;
+						delayed_since = now;
+						stats.frames_delayed++;
+					}
+					return Verdict::wait;
+				}
+
+				link.take(bytes);
+			}
+
+			if (delayed) {
+				delayed = false;
+				stats.delay += std::chrono::duration_cast<std::chrono::microseconds>(now - delayed_since);
+			}
+
+			if (msgid_limit != nullptr)
+				msgid_limit->take(bytes);
+
+			in_frame = true;
+			stats.frames_sent++;
+			stats.bytes_sent += bytes;
+			return Verdict::send;
+		}
+	}
+
+	//! The frame let through by pace() is complete
+	void frame_done() {
+		in_frame = false;
+	}
+
+	Stats get_stats() const {
+		return stats;
+	}
+
+private:
+	bool enabled;
+	bool link_limited;
+	bool in_frame;
+	bool delayed;
+	clock::time_point delayed_since;
+	TokenBucket link;
+	std::unordered_map<mavlink::msgid_t, TokenBucket> msgid_bucket;
+	Stats stats;
+};
+}	// namespace mavconn
@@ -0,0 +1,115 @@
+/**
+ * @brief MAVConn shared memory link class
+ * @file shm.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <mavconn/interface.h>
+#include <mavconn/msgbuffer.h>
+
+namespace mavconn {
+/**
+ * @brief Shared memory link for processes on one host
+ *
+ * The writer publishes every sent frame into a ring of frame slots in a
+ * named POSIX shared memory object, any number of readers tap it, each
+ * with its own cursor. Nothing is copied through the kernel.
+ *
+ * The writer never waits for readers: a reader that falls a whole ring
+ * behind loses the overwritten frames and counts them, see get_lost_frames().
+ * Readers sleep on a futex in the ring, the writer makes a syscall
+ * only when one of them sleeps.
+ *
+ * The link is one way: the writer receives nothing, sends of a reader
+ * return SendStatus::no_remote.
+ * A reader closes when the writer closes or its process is gone.
+ */
+class MAVConnShm : public MAVConnInterface {
+public:
+	enum class Role {
+		writer,		//!< creates the ring, one per name
+		reader,		//!< attaches to the writer's ring
+	};
+
+	static constexpr auto DEFAULT_NAME = "mavlink";
+	//! Frame slots, rounded up to a power of two
+	static constexpr size_t DEFAULT_SLOTS = 1024;
+	//! Largest ring, about 300 MB of shared memory
+	static constexpr size_t MAX_SLOTS = 1024 * 1024;
+	//! Frames are parsed in batches of up to that many bytes
+	static constexpr size_t DEFAULT_RX_BUFFER_SIZE = 16384;
+
+	/**
+	 * @param[id] name   shared memory object name (/dev/shm/name)
+	 * @param[id] role   writer or reader
+	 * @param[id] slots  ring size in frames, writer only
+	 */
+	MAVConnShm(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+			std::string name = DEFAULT_NAME, Role role = Role::reader,
+			size_t slots = DEFAULT_SLOTS);
+	~MAVConnShm();
+
+	void close() override;
+
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	inline bool is_open() override {
+		return opened;
+	}
+
+	//! Frames a reader missed because the writer lapped it
+	inline size_t get_lost_frames() {
+		return n_lost;
+	}
+
+private:
+	struct Header;
+	struct Slot;
+
+	Role role;
+	std::string shm_name;
+	int fd;
+	void *map;
+	size_t map_size;
+	Header *ring;
+	Slot *slots;
+	size_t slot_mask;
+
+	std::atomic<bool> opened;
+	std::recursive_mutex mutex;
+
+	std::thread rx_thread;
+	std::vector<uint8_t> rx_buf;
+	uint64_t cursor;		//!< sequence of the next frame to read
+	std::atomic<size_t> n_lost;
+
+	void create(size_t slots);
+	void attach();
+	void unmap();
+	bool writer_alive();
+
+	SendStatus publish(const MsgBuffer &buf);
+	size_t read_batch();
+	void do_read();
+};
+}	// namespace mavconn
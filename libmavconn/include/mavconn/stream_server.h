@@ -0,0 +1,306 @@
+/**
+ * @brief MAVConn server side of the stream links (TCP, Unix socket)
+ * @file stream_server.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <list>
+#include <chrono>
+#include <boost/asio.hpp>
+#include <mavconn/interface.h>
+#include <mavconn/msgbuffer.h>
+
+namespace mavconn {
+/**
+ * @brief TX queue entry of a stream link
+ *
+ * The frame is immutable and allocated once, a broadcast shares it
+ * between all clients of a server. The entry only holds the pointer
+ * and the per client send position, so queueing copies no frame and
+ * the frame on the wire outlives its entry.
+ */
+struct StreamTxBuffer {
+	std::shared_ptr<const MsgBuffer> buf;
+	ssize_t pos;
+	std::chrono::steady_clock::time_point queued_at;
+
+	StreamTxBuffer(std::shared_ptr<const MsgBuffer> buf_, std::chrono::steady_clock::time_point queued_at_) :
+		buf(std::move(buf_)),
+		pos(buf->pos),
+		queued_at(queued_at_)
+	{ }
+
+	//! Encode a frame for this entry alone, @a args as for the MsgBuffer constructors
+	template<typename ... _Args>
+	explicit StreamTxBuffer(std::chrono::steady_clock::time_point queued_at_, _Args && ... args) :
+		StreamTxBuffer(std::make_shared<const MsgBuffer>(std::forward<_Args>(args)...), queued_at_)
+	{ }
+
+	const MsgBuffer &frame() const {
+		return *buf;
+	}
+
+	//! Take the frame of a newer entry, keeping the place in the queue
+	void replace(const StreamTxBuffer &other) {
+		buf = other.buf;
+		pos = other.pos;
+	}
+
+	const uint8_t *dpos() const {
+		return buf->data + pos;
+	}
+
+	ssize_t nbytes() const {
+		return buf->len - pos;
+	}
+};
+
+/**
+ * @brief Client list of a stream server
+ *
+ * Accepted clients run on the server's io thread, each with its own
+ * TX queue. Broadcasts go to every client: a client whose queue is
+ * full misses the frame, the others do not. The derived server owns
+ * the acceptor and implements close() and is_open(), its destructor
+ * calls close() and join_io().
+ *
+ * _Client provides a server side constructor, client_connected(),
+ * queue_frame() and TxBuffer = StreamTxBuffer.
+ */
+template<typename _Client>
+class MAVConnStreamServer : public MAVConnInterface {
+public:
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override {
+		assert(message != nullptr);
+
+		log_send(pfx, message);
+
+		return send_frame(priority, message);
+	}
+
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override {
+		log_send_obj(pfx, message);
+
+		return send_frame(priority, message, get_status_p(), sys_id, comp_id);
+	}
+
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override {
+		return send_frame(priority, bytes, length);
+	}
+
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override {
+		return send_frame(priority, enc, get_status_p(), sys_id, comp_id);
+	}
+
+	mavlink::mavlink_status_t get_status() override {
+		mavlink::mavlink_status_t status {};
+
+		lock_guard lock(mutex);
+		for (auto &instp : client_list) {
+			auto inst_status = instp->get_status();
+
+			status.packet_rx_success_count += inst_status.packet_rx_success_count;
+			status.packet_rx_drop_count    += inst_status.packet_rx_drop_count;
+			status.buffer_overrun          += inst_status.buffer_overrun;
+			status.parse_error             += inst_status.parse_error;
+
+			/* seq counters always 0 for this connection type */
+		}
+
+		return status;
+	}
+
+	IOStat get_iostat() override {
+		IOStat iostat {};
+
+		lock_guard lock(mutex);
+		for (auto &instp : client_list) {
+			auto inst_iostat = instp->get_iostat();
+
+			iostat.tx_total_bytes += inst_iostat.tx_total_bytes;
+			iostat.tx_speed       += inst_iostat.tx_speed;
+			iostat.rx_total_bytes += inst_iostat.rx_total_bytes;
+			iostat.rx_speed       += inst_iostat.rx_speed;
+		}
+
+		return iostat;
+	}
+
+	void set_recorder(std::shared_ptr<TlogWriter> writer) override {
+		lock_guard lock(mutex);
+		MAVConnInterface::set_recorder(writer);
+
+		// clients record what they receive, broadcasts are recorded here once
+		for (auto &instp : client_list) {
+			instp->set_rx_recorder(writer);
+		}
+	}
+
+	void set_tx_queue_config(const TxQueueConfig &config) override {
+		lock_guard lock(mutex);
+		client_tx_config = config;
+
+		for (auto &instp : client_list) {
+			instp->set_tx_queue_config(config);
+		}
+	}
+
+	TxShaper::Stats get_shaping_stats() override {
+		TxShaper::Stats sum {};
+
+		lock_guard lock(mutex);
+		for (auto &instp : client_list) {
+			auto stats = instp->get_shaping_stats();
+			sum.frames_sent += stats.frames_sent;
+			sum.bytes_sent += stats.bytes_sent;
+			sum.frames_delayed += stats.frames_delayed;
+			sum.frames_dropped += stats.frames_dropped;
+			sum.delay += stats.delay;
+		}
+
+		return sum;
+	}
+
+	//! Number of connected clients
+	size_t client_count() {
+		lock_guard lock(mutex);
+		return client_list.size();
+	}
+
+protected:
+	boost::asio::io_service io_service;
+	std::thread io_thread;
+
+	size_t client_rx_buffer_size;
+	TxQueueConfig client_tx_config;
+	std::list<std::shared_ptr<_Client> > client_list;
+	std::recursive_mutex mutex;
+
+	MAVConnStreamServer(uint8_t system_id, uint8_t component_id, size_t rx_buffer_size, const char *pfx_) :
+		MAVConnInterface(system_id, component_id),
+		io_service(),
+		client_rx_buffer_size(rx_buffer_size),
+		pfx(pfx_)
+	{ }
+
+	//! Stop the io thread and close the clients, from close() on any thread, once, not under the lock
+	void stop_io() {
+		io_service.stop();
+
+		// not from a handler on our own io thread, join_io() takes that one
+		if (io_thread.joinable() && io_thread.get_id() != std::this_thread::get_id())
+			io_thread.join();
+
+		// their callbacks point to this server
+		lock_guard lock(mutex);
+		for (auto &instp : client_list)
+			instp->close();
+		client_list.clear();
+	}
+
+	//! From the destructor after close(), the io thread may still be returning from the handler that closed
+	void join_io() {
+		if (io_thread.joinable()) {
+			if (io_thread.get_id() != std::this_thread::get_id())
+				io_thread.join();
+			else
+				io_thread.detach();
+		}
+	}
+
+	//! A client for the next async_accept(), running on our io_service
+	std::shared_ptr<_Client> make_client() {
+		return std::make_shared<_Client>(sys_id, comp_id, io_service, client_rx_buffer_size);
+	}
+
+	/**
+	 * Wire a client the acceptor just connected and add it to the list.
+	 * Its callbacks point to this server, stop_io() closes it.
+	 */
+	void client_accepted(std::shared_ptr<_Client> client) {
+		lock_guard lock(mutex);
+
+		std::weak_ptr<_Client> weak_client{client};
+		client->client_connected();
+		client->set_rx_recorder(get_recorder());
+		client->set_tx_queue_config(client_tx_config);
+		client->message_received_cb = std::bind(&MAVConnStreamServer::recv_message, this,
+				std::placeholders::_1, std::placeholders::_2);
+		client->port_closed_cb = [this, weak_client] () { client_closed(weak_client); };
+
+		client_list.push_back(client);
+	}
+
+private:
+	const char *pfx;
+
+	/**
+	 * Encode a frame once, from @a args as for the MsgBuffer constructors,
+	 * and queue it to all clients, which share the buffer.
+	 */
+	template<typename ... _Args>
+	SendStatus send_frame(TxPriority priority, _Args && ... args) {
+		using TxBuffer = typename _Client::TxBuffer;
+
+		auto now = std::chrono::steady_clock::now();
+		bool queued = false;
+		bool all_closed = true;
+
+		if (!is_open())
+			return send_refused(SendStatus::closed);
+
+		// also guards the server's tx sequence number
+		lock_guard lock(mutex);
+		if (client_list.empty())
+			return send_refused(SendStatus::no_remote);
+
+		// encoded once, all clients get the same bytes and sequence number
+		auto buf = std::make_shared<const MsgBuffer>(std::forward<_Args>(args)...);
+		for (auto &instp : client_list) {
+			auto status = instp->queue_frame(TxBuffer(buf, now), priority);
+			if (status == SendStatus::queued)
+				queued = true;
+			else if (status != SendStatus::closed)
+				all_closed = false;
+		}
+
+		// clients that went away are only removed later on the io thread
+		if (!queued)
+			return send_refused(all_closed ? SendStatus::closed : SendStatus::dropped_full);
+
+		record_tx(*buf);
+		return SendStatus::queued;
+	}
+
+	void client_closed(std::weak_ptr<_Client> weak_instp) {
+		// the client calls in under its own lock, maybe while a send here
+		// holds ours and walks the list: drop it later on the io thread
+		io_service.post([this, weak_instp] () {
+					if (auto instp = weak_instp.lock()) {
+						lock_guard lock(mutex);
+						client_list.remove(instp);
+					}
+				});
+	}
+
+	void recv_message(const mavlink::mavlink_message_t *message, const Framing framing) {
+		if (message_received_cb)
+			message_received_cb(message, framing);
+	}
+};
+}	// namespace mavconn
@@ -17,12 +17,13 @@
 
 #pragma once
 
-#include <list>
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <boost/asio.hpp>
 #include <mavconn/interface.h>
 #include <mavconn/msgbuffer.h>
+#include <mavconn/stream_server.h>
 
 
 namespace mavconn {
@@ -36,26 +37,52 @@ class MAVConnTCPClient : public MAVConnInterface,
 public:
 	static constexpr auto DEFAULT_SERVER_HOST = "localhost";
 	static constexpr auto DEFAULT_SERVER_PORT = 5760;
+	//! A busy stream is drained in few reads
+	static constexpr size_t DEFAULT_RX_BUFFER_SIZE = 16384;
+
+	//! What a full TX queue does with one more frame
+	enum class TxPolicy {
+		overflow_error,		//!< refuse with SendStatus::dropped_full, send_*() throw (standalone client)
+		drop_newest,		//!< discard the new frame
+		drop_oldest,		//!< discard the oldest frame not yet on the wire
+		disconnect,		//!< close the connection, the peer can not keep up
+		latest_per_msgid,	//!< replace a queued frame of the same stream (msgid, source, target), else drop_newest
+	};
 
 	/**
 	 * Create generic TCP client (connect to the server)
 	 * @param[id] server_addr    remote host
 	 * @param[id] server_port    remote port
+	 * @param[id] rx_buffer_size bytes read at once
+	 * @param[id] io_backend     receive on io_uring if available
 	 */
 	MAVConnTCPClient(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
-			std::string server_host = DEFAULT_SERVER_HOST, unsigned short server_port = DEFAULT_SERVER_PORT);
+			std::string server_host = DEFAULT_SERVER_HOST, unsigned short server_port = DEFAULT_SERVER_PORT,
+			size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE, IoBackend io_backend = IoBackend::asio);
 	/**
 	 * Special client variation for use in MAVConnTCPServer
 	 */
 	explicit MAVConnTCPClient(uint8_t system_id, uint8_t component_id,
-			boost::asio::io_service &server_io);
+			boost::asio::io_service &server_io, size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE);
 	~MAVConnTCPClient();
 
 	void close() override;
 
-	void send_message(const mavlink::mavlink_message_t *message) override;
-	void send_message(const mavlink::Message &message) override;
-	void send_bytes(const uint8_t *bytes, size_t length) override;
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	void set_tx_queue_config(const TxQueueConfig &config) override;
+	TxShaper::Stats get_shaping_stats() override;
+
+	inline IoBackend get_io_backend() override {
+		return rx_uring ? IoBackend::uring : IoBackend::asio;
+	}
 
 	inline bool is_open() override {
 		return socket.is_open();
@@ -63,22 +90,53 @@ public:
 
 private:
 	friend class MAVConnTCPServer;
+	template<typename> friend class MAVConnStreamServer;
+	using TxBuffer = StreamTxBuffer;
+
 	boost::asio::io_service io_service;
 	std::unique_ptr<boost::asio::io_service::work> io_work;
 	std::thread io_thread;
+	bool standalone;	//!< own io thread, not a client of MAVConnTCPServer
 
 	boost::asio::ip::tcp::socket socket;
 	boost::asio::ip::tcp::endpoint server_ep;
 
 	std::atomic<bool> tx_in_progress;
-	std::deque<MsgBuffer> tx_q;
-	std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+	TxQueue<TxBuffer> tx_q;
+	TxShaper tx_shaper;
+	boost::asio::steady_timer tx_timer;
+	TxPolicy tx_policy;
+	size_t tx_q_limit;
+	size_t n_tx_dropped;
+	size_t n_tx_replaced;
+	std::chrono::steady_clock::duration max_tx_lag;
+	std::vector<uint8_t> rx_buf;
+	std::unique_ptr<UringReader> rx_uring;	//!< standalone client only
 	std::recursive_mutex mutex;
 
 	/**
 	 * This special function called by TCP server when connection accepted.
 	 */
-	void client_connected(size_t server_channel);
+	void client_connected();
+
+	/**
+	 * Queue an encoded frame, also used by the server to fan out
+	 * one frame to all clients.
+	 */
+	SendStatus queue_frame(const TxBuffer &entry, TxPriority priority = TxPriority::automatic);
+
+	/**
+	 * Apply tx_policy to a queue that is full for class @a cls.
+	 * @param[out] replaced  @a entry went out as the newer value of a queued frame
+	 * @return true if @a entry is to be queued
+	 */
+	bool tx_q_overflow(size_t cls, const TxBuffer &entry, bool &replaced);
+
+	/**
+	 * What the io handlers hold: a server's client lives as long as they
+	 * do, a standalone client is not owned by them and joins its io thread.
+	 */
+	std::shared_ptr<MAVConnTCPClient> handler_ref();
 
 	void do_recv();
 	void do_send(bool check_tx_state);
@@ -89,48 +147,65 @@ private:
  *
  * @note IPv4 only
  */
-class MAVConnTCPServer : public MAVConnInterface,
+class MAVConnTCPServer : public MAVConnStreamServer<MAVConnTCPClient>,
 	public std::enable_shared_from_this<MAVConnTCPServer> {
 public:
 	static constexpr auto DEFAULT_BIND_HOST = "localhost";
 	static constexpr auto DEFAULT_BIND_PORT = 5760;
 
+	//! Per client TX queue state
+	struct ClientStats {
+		size_t conn_id;
+		std::string remote;	//!< address:port
+		size_t queued;		//!< frames waiting
+		size_t queued_bytes;
+		size_t dropped;		//!< by the queue policy
+		size_t replaced;	//!< superseded by a newer frame of the same stream
+		std::chrono::microseconds lag;		//!< age of the oldest waiting frame
+		std::chrono::microseconds max_lag;	//!< longest queue to wire time seen
+		TxShaper::Stats shaping;
+	};
+
 	/**
 	 * @param[id] server_addr    bind host
 	 * @param[id] server_port    bind port
+	 * @param[id] rx_buffer_size receive buffer of each accepted client
 	 */
 	MAVConnTCPServer(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
-			std::string bind_host = DEFAULT_BIND_HOST, unsigned short bind_port = DEFAULT_BIND_PORT);
+			std::string bind_host = DEFAULT_BIND_HOST, unsigned short bind_port = DEFAULT_BIND_PORT,
+			size_t rx_buffer_size = MAVConnTCPClient::DEFAULT_RX_BUFFER_SIZE);
 	~MAVConnTCPServer();
 
 	void close() override;
 
-	void send_message(const mavlink::mavlink_message_t *message) override;
-	void send_message(const mavlink::Message &message) override;
-	void send_bytes(const uint8_t *bytes, size_t length) override;
-
-	mavlink::mavlink_status_t get_status() override;
-	IOStat get_iostat() override;
 	inline bool is_open() override {
 		return acceptor.is_open();
 	}
 
-private:
-	boost::asio::io_service io_service;
-	std::unique_ptr<boost::asio::io_service::work> io_work;
-	std::thread io_thread;
+	/**
+	 * @brief Bound each client's TX queue
+	 *
+	 * Broadcasts go to every client whatever happens to the others:
+	 * a client whose queue is full is handled by @a policy alone.
+	 * try_send_*() return queued if at least one client took the frame,
+	 * per client drops are in get_client_stats().
+	 * Applies to connected and future clients.
+	 *
+	 * @param[in] policy       TxPolicy::overflow_error is taken as drop_newest
+	 * @param[in] queue_limit  frames per client, 0 for MAX_TXQ_SIZE
+	 */
+	void set_slow_client_policy(MAVConnTCPClient::TxPolicy policy, size_t queue_limit = 0);
+
+	std::vector<ClientStats> get_client_stats();
 
+private:
 	boost::asio::ip::tcp::acceptor acceptor;
 	boost::asio::ip::tcp::endpoint bind_ep;
 
-	std::list<std::shared_ptr<MAVConnTCPClient> > client_list;
-	std::recursive_mutex mutex;
+	MAVConnTCPClient::TxPolicy client_tx_policy;
+	size_t client_tx_q_limit;
 
 	void do_accept();
-
-	// client slots
-	void client_closed(std::weak_ptr<MAVConnTCPClient> weak_instp);
-	void recv_message(const mavlink::mavlink_message_t *message, const Framing framing);
 };
 }	// namespace mavconn
 
@@ -0,0 +1,222 @@
+/**
+ * @brief MAVConn telemetry log (tlog) files
+ * @file tlog.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <condition_variable>
+#include <mavconn/mavlink_dialect.h>
+
+namespace mavconn {
+/**
+ * @brief tlog record layout, as written by QGroundControl and MAVProxy
+ *
+ * Each record is a big endian 64-bit timestamp (microseconds since the
+ * Unix epoch) followed by one raw MAVLink v1 or v2 frame.
+ */
+namespace tlog {
+static constexpr size_t TIMESTAMP_SIZE = 8;
+
+//! Wall clock in tlog units
+uint64_t now_us();
+
+inline uint64_t get_timestamp(const uint8_t *p)
+{
+	uint64_t ts = 0;
+	for (size_t i = 0; i < TIMESTAMP_SIZE; i++)
+		ts = (ts << 8) | p[i];
+	return ts;
+}
+
+inline void put_timestamp(uint8_t *p, uint64_t ts)
+{
+	for (size_t i = TIMESTAMP_SIZE; i > 0; i--) {
+		p[i - 1] = ts & 0xff;
+		ts >>= 8;
+	}
+}
+
+/**
+ * @brief Length of the frame starting at @a p
+ * @return frame length, 0 if @a p does not start a frame or it is cut off at @a avail
+ */
+size_t frame_length(const uint8_t *p, size_t avail);
+}	// namespace tlog
+
+/**
+ * @brief Append-only tlog writer
+ *
+ * Records are collected in a block buffer, the io threads only do a
+ * memcpy per frame. Full blocks, and the partial one every FLUSH_INTERVAL,
+ * are written by a flush thread with one write(2) each.
+ * Thread safe: a link records both its io thread and its senders.
+ */
+class TlogWriter {
+public:
+	static constexpr size_t BLOCK_SIZE = 64 * 1024;
+	//! Blocks waiting for the disk, beyond that new blocks are dropped
+	static constexpr size_t MAX_PENDING = 16;
+	//! A partial block is written out at least this often
+	static constexpr std::chrono::milliseconds FLUSH_INTERVAL {1000};
+
+	/**
+	 * @throws DeviceError  if the file can not be opened
+	 */
+	explicit TlogWriter(const std::string &path);
+	~TlogWriter();
+
+	TlogWriter(const TlogWriter&) = delete;
+
+	/**
+	 * @brief Append one frame
+	 * @param[in] time_us  timestamp, tlog::now_us() if 0
+	 */
+	void write(const uint8_t *frame, size_t length, uint64_t time_us = 0);
+
+	//! Write out everything recorded so far, waits for the flush thread
+	void flush();
+
+	size_t frames() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return n_frames;
+	}
+
+	//! Blocks lost to write errors or a full pending list
+	size_t errors() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return n_errors;
+	}
+
+private:
+	std::mutex mutex;
+	std::condition_variable flush_cond;	//!< wakes the flush thread
+	std::condition_variable done_cond;	//!< pending list written
+	int fd;
+	std::vector<uint8_t> block;
+	std::deque<std::vector<uint8_t>> pending;
+	std::vector<std::vector<uint8_t>> spare;
+	bool writing;
+	bool stopping;
+	size_t n_frames;
+	size_t n_errors;
+	std::thread flush_thread;
+
+	void hand_off_locked();
+	void run();
+	bool write_block(const std::vector<uint8_t> &data);
+};
+
+/**
+ * @brief Random access tlog reader
+ *
+ * The file is mapped, not read. An index of every record (time, offset,
+ * msgid) is built by scanning the record headers only and is kept next
+ * to the log as <path>.idx, so reopening a multi-gigabyte log is one
+ * read of the index. Frames are checked (CRC) only when decoded.
+ *
+ * Time lookups use binary search and expect the timestamps to grow,
+ * which holds for logs written by a single recorder.
+ */
+class TlogReader {
+public:
+	//! One record, also the on-disk index entry (native endian)
+	struct Entry {
+		uint64_t time_us;
+		uint64_t offset;	//!< of the frame, past the timestamp
+		uint32_t msgid;
+		uint16_t length;	//!< of the frame
+		uint16_t reserved;
+	};
+	static_assert(sizeof(Entry) == 24, "tlog index entry layout");
+
+	//! Index file header
+	struct IndexHeader {
+		char magic[8];		//!< "MAVTLIDX"
+		uint32_t version;	//!< 1
+		uint32_t entry_size;
+		uint64_t log_size;	//!< tlog size and mtime the index was built for
+		int64_t log_mtime_ns;
+		uint64_t count;
+	};
+
+	using IndexList = std::vector<uint32_t>;
+
+	/**
+	 * @param[in] path         tlog file
+	 * @param[in] index_path   where the index is loaded from and saved to, "" for path + ".idx"
+	 * @throws DeviceError  if the log can not be opened or mapped
+	 */
+	explicit TlogReader(const std::string &path, std::string index_path = "");
+	~TlogReader();
+
+	TlogReader(const TlogReader&) = delete;
+
+	//! All records in file order
+	inline const std::vector<Entry> &entries() const {
+		return index;
+	}
+
+	//! Positions in entries() of one message type, empty if it never occurs
+	const IndexList &entries(mavlink::msgid_t msgid) const;
+
+	//! First record at or after @a time_us, entries().size() if none
+	size_t seek(uint64_t time_us) const;
+
+	//! First record of @a msgid at or after @a time_us, nullptr if none
+	const Entry *find(mavlink::msgid_t msgid, uint64_t time_us) const;
+
+	//! Records of the given types between @a from_us and @a to_us, in file order
+	std::vector<const Entry *> select(const std::vector<mavlink::msgid_t> &msgids,
+			uint64_t from_us = 0, uint64_t to_us = UINT64_MAX) const;
+
+	//! Raw frame bytes of a record, valid as long as the reader
+	inline const uint8_t *frame(const Entry &e) const {
+		return map + e.offset;
+	}
+
+	/**
+	 * @brief Run a record through the MAVLink framer
+	 * @return true if the frame is intact
+	 */
+	bool decode(const Entry &e, mavlink::mavlink_message_t &msg) const;
+
+	//! True if the index was loaded, not rebuilt
+	inline bool index_loaded() const {
+		return loaded;
+	}
+
+private:
+	int fd;
+	const uint8_t *map;
+	size_t map_size;
+	int64_t mtime_ns;
+	bool loaded;
+
+	std::vector<Entry> index;
+	std::unordered_map<mavlink::msgid_t, IndexList> by_msgid;
+
+	bool load_index(const std::string &index_path);
+	void build_index();
+	void save_index(const std::string &index_path);
+};
+}	// namespace mavconn
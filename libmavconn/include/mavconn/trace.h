@@ -0,0 +1,103 @@
+/**
+ * @brief MAVConn frame tracing
+ * @file trace.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <mavconn/mavlink_dialect.h>
+
+/**
+ * Build with -DMAVCONN_TRACE=0 to compile the trace hooks out.
+ * Otherwise tracing costs one relaxed load per frame while disabled.
+ */
+#ifndef MAVCONN_TRACE
+#define MAVCONN_TRACE 1
+#endif
+
+namespace mavconn {
+namespace trace {
+
+//! Records per thread ring, older records are overwritten
+static constexpr size_t RING_SIZE = 4096;
+
+enum class Event : uint8_t {
+	recv = 0,	//!< frame parsed, framing tells the result
+	send = 1,	//!< mavlink_message_t queued
+	send_obj = 2,	//!< mavlink::Message queued, seq not known yet
+};
+
+/**
+ * @brief One traced frame, also the binary dump record (little endian).
+ */
+struct Record {
+	uint64_t time_ns;	//!< steady clock
+	uint32_t msgid;
+	uint32_t conn_id;
+	uint16_t thread;	//!< ring index, one ring per thread
+	uint8_t event;		//!< Event
+	uint8_t framing;	//!< mavconn::Framing for recv, 0 otherwise
+	uint8_t seq;
+	uint8_t len;
+	uint8_t sysid;
+	uint8_t compid;
+};
+static_assert(sizeof(Record) == 24, "trace record layout");
+
+/**
+ * @brief Binary trace file header, followed by @a count records sorted by time
+ */
+struct FileHeader {
+	char magic[8];		//!< "MAVTRACE"
+	uint32_t version;	//!< 2 (1 had a 16 bit conn_id)
+	uint32_t record_size;
+	uint64_t count;
+	uint64_t steady_ns;	//!< steady clock at dump time
+	uint64_t system_ns;	//!< wall clock at dump time, to convert time_ns
+};
+
+//! Runtime switch, initialized from the MAVCONN_TRACE environment variable
+extern std::atomic<bool> enabled_flag;
+
+inline bool enabled()
+{
+	return MAVCONN_TRACE && enabled_flag.load(std::memory_order_relaxed);
+}
+
+void set_enabled(bool enable);
+
+/**
+ * @brief Append a record to the calling thread's ring
+ */
+void record(Event event, size_t conn_id, uint32_t msgid, uint8_t seq, uint8_t len,
+		uint8_t sysid, uint8_t compid, uint8_t framing = 0);
+
+inline void record(Event event, size_t conn_id, const mavlink::mavlink_message_t *msg, uint8_t framing = 0)
+{
+	record(event, conn_id, msg->msgid, msg->seq, msg->len, msg->sysid, msg->compid, framing);
+}
+
+/**
+ * @brief Write all rings to a binary trace file
+ * @return number of records written, -1 on error
+ */
+ssize_t dump(const std::string &path);
+
+//! Drop all records
+void clear();
+
+}	// namespace trace
+}	// namespace mavconn
@@ -0,0 +1,323 @@
+/**
+ * @brief MAVConn transmit queue with priority classes
+ * @file txqueue.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <deque>
+#include <cassert>
+#include <cstddef>
+#include <unordered_map>
+#include <mavconn/mavlink_dialect.h>
+#include <mavconn/msgbuffer.h>
+
+namespace mavconn {
+//! Transmit priority class, lower is sent first
+enum class TxPriority : uint8_t {
+	high = 0,		//!< commands, acks, heartbeats
+	normal = 1,
+	low = 2,
+	bulk = 3,		//!< parameter, log and file transfers
+	automatic = 0xff,	//!< class from TxQueueConfig::msgid_class
+};
+
+//! How the drain loop picks the next class
+enum class TxScheduling : uint8_t {
+	strict,		//!< always the highest non-empty class
+	weighted,	//!< up to weight frames per class in turn
+};
+
+/**
+ * @brief Transmit queue settings of a link
+ *
+ * The default puts every message in TxPriority::normal, a plain FIFO.
+ */
+struct TxQueueConfig {
+	static constexpr size_t NUM_CLASSES = 4;
+
+	TxScheduling scheduling;
+	TxPriority default_class;
+	size_t limit[NUM_CLASSES];	//!< frames per class, 0 for only the link limit
+	unsigned weight[NUM_CLASSES];	//!< frames per turn with TxScheduling::weighted
+	std::unordered_map<mavlink::msgid_t, TxPriority> msgid_class;
+	//! latest value wins: msgid -> payload offset of an instance byte, -1 for none
+	std::unordered_map<mavlink::msgid_t, int> coalesce;
+
+	size_t rate;	//!< link throughput [B/s] the drain is paced to, 0 for unlimited
+	size_t burst;	//!< bytes sent back to back, 0 for rate / 10
+	//! per msgid budgets [B/s], frames over budget are dropped
+	std::unordered_map<mavlink::msgid_t, size_t> msgid_rate;
+
+	TxQueueConfig() :
+		scheduling(TxScheduling::strict),
+		default_class(TxPriority::normal),
+		limit {},
+		weight { 8, 4, 2, 1 },
+		rate(0),
+		burst(0)
+	{ }
+
+	/**
+	 * @brief Commands and heartbeats ahead of everything, transfers last
+	 *
+	 * Keeps COMMAND_ACK from waiting behind a parameter or log download
+	 * on a slow radio.
+	 */
+	static TxQueueConfig command_first(TxScheduling scheduling = TxScheduling::strict) {
+		TxQueueConfig cfg;
+
+		cfg.scheduling = scheduling;
+		// HEARTBEAT, COMMAND_INT, COMMAND_LONG, COMMAND_ACK, COMMAND_CANCEL
+		for (mavlink::msgid_t msgid : { 0, 75, 76, 77, 80 })
+			cfg.msgid_class[msgid] = TxPriority::high;
+		// PARAM_VALUE, FILE_TRANSFER_PROTOCOL, LOG_ENTRY, LOG_DATA,
+		// ENCAPSULATED_DATA, PARAM_EXT_VALUE
+		for (mavlink::msgid_t msgid : { 22, 110, 118, 120, 131, 322 })
+			cfg.msgid_class[msgid] = TxPriority::bulk;
+
+		return cfg;
+	}
+
+	/**
+	 * @brief Let a newer @a msgid frame replace the queued one in place
+	 *
+	 * Frames are of the same stream when source, target and the
+	 * @a instance_ofs payload byte (e.g. a sensor id) match, so a congested
+	 * link holds one frame per stream and sends the freshest value.
+	 */
+	void coalesce_latest(mavlink::msgid_t msgid, int instance_ofs = -1) {
+		coalesce[msgid] = instance_ofs;
+	}
+};
+
+/**
+ * @brief Transmit queue split in priority classes
+ *
+ * Used like the std::deque it replaces: the drain loop sends front()
+ * until it is complete and then calls pop_front().
+ * front() stays the same frame until pop_front(), however urgent the
+ * frames queued meanwhile, so a partly written frame is never cut.
+ *
+ * Not thread safe, the link guards it with its mutex.
+ */
+template<typename T>
+class TxQueue {
+public:
+	static constexpr size_t NUM_CLASSES = TxQueueConfig::NUM_CLASSES;
+	static constexpr size_t NONE = NUM_CLASSES;
+
+	using Queue = std::deque<T>;
+
+	TxQueue() :
+		count(0),
+		current(NONE),
+		last(0),
+		credit {}
+	{ }
+
+	void configure(const TxQueueConfig &cfg) {
+		config = cfg;
+		for (auto &c : credit)
+			c = 0;
+	}
+
+	const TxQueueConfig &get_config() const {
+		return config;
+	}
+
+	//! Class of a frame, @a msgid -1 for raw bytes
+	size_t classify(int64_t msgid, TxPriority priority) const {
+		if (priority == TxPriority::automatic) {
+			auto it = config.msgid_class.find(msgid);
+			priority = (it != config.msgid_class.end()) ? it->second : config.default_class;
+		}
+
+		size_t cls = static_cast<size_t>(priority);
+		return (cls < NUM_CLASSES) ? cls : NUM_CLASSES - 1;
+	}
+
+	//! True if @a msgid frames are coalesced
+	bool coalesced(int64_t msgid) const {
+		return !config.coalesce.empty() && config.coalesce.count(msgid) != 0;
+	}
+
+	/**
+	 * @brief Newest queued frame of the stream of @a buf
+	 *
+	 * The frame being sent is not considered.
+	 * @param frame_of  returns the MsgBuffer of a queue entry
+	 * @return nullptr if there is none
+	 */
+	template<typename FrameOf>
+	T *find_stream(size_t cls, const MsgBuffer &buf, FrameOf frame_of) {
+		uint64_t key;
+		if (!stream_key(buf, key))
+			return nullptr;
+
+		auto &cq = q[cls];
+		auto first = cq.begin();
+		if (current == cls && first != cq.end())
+			++first;
+
+		for (auto it = cq.end(); it != first; ) {
+			--it;
+			uint64_t other;
+			if (stream_key(frame_of(*it), other) && other == key)
+				return &*it;
+		}
+
+		return nullptr;
+	}
+
+	//! True if class @a cls or the link (@a total_limit) can not take another frame
+	bool full(size_t cls, size_t total_limit) const {
+		return count >= total_limit || class_full(cls);
+	}
+
+	//! True if class @a cls is at its own limit
+	bool class_full(size_t cls) const {
+		return config.limit[cls] != 0 && q[cls].size() >= config.limit[cls];
+	}
+
+	size_t size() const {
+		return count;
+	}
+
+	bool empty() const {
+		return count == 0;
+	}
+
+	template<typename... Args>
+	T &emplace_back(size_t cls, Args&&... args) {
+		q[cls].emplace_back(std::forward<Args>(args)...);
+		count++;
+		return q[cls].back();
+	}
+
+	//! Frame to send, picked when the previous one was popped
+	T &front() {
+		assert(count > 0);
+		if (current == NONE)
+			current = select();
+		return q[current].front();
+	}
+
+	void pop_front() {
+		assert(current != NONE);
+		q[current].pop_front();
+		count--;
+		current = NONE;
+	}
+
+	//! Frames of one class, in order
+	Queue &at(size_t cls) {
+		return q[cls];
+	}
+
+	//! Class of the frame returned by front(), NONE if it was not taken yet
+	size_t current_class() const {
+		return current;
+	}
+
+	//! Remove a frame other than the one being sent
+	void erase(size_t cls, typename Queue::iterator it) {
+		assert(cls != current || it != q[cls].begin());
+		q[cls].erase(it);
+		count--;
+	}
+
+	void clear() {
+		for (auto &cq : q)
+			cq.clear();
+		count = 0;
+		current = NONE;
+	}
+
+private:
+	TxQueueConfig config;
+	Queue q[NUM_CLASSES];
+	size_t count;
+	size_t current;
+	size_t last;			//!< class served last, weighted scheduling
+	unsigned credit[NUM_CLASSES];	//!< frames left in this turn, weighted scheduling
+
+	/**
+	 * Stream of a frame: msgid, source, target and instance, 8 bits each
+	 * but the msgid. Fields trimmed from a v2 payload are 0.
+	 */
+	bool stream_key(const MsgBuffer &buf, uint64_t &key) const {
+		const uint8_t *p = buf.data + buf.pos;
+		ssize_t length = buf.len - buf.pos;
+
+		int64_t msgid = MsgBuffer::frame_msgid(p, length);
+		auto it = config.coalesce.find(msgid);
+		if (msgid < 0 || it == config.coalesce.end())
+			return false;
+
+		const bool mavlink1 = p[0] == MAVLINK_STX_MAVLINK1;
+		const size_t header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_NUM_HEADER_BYTES;
+		const uint8_t *payload = p + header_len;
+		const size_t payload_len = p[1];
+		auto field = [payload, payload_len](size_t ofs) -> uint64_t {
+			return (ofs < payload_len) ? payload[ofs] : 0;
+		};
+
+		uint64_t target_system = 0, target_component = 0, instance = 0;
+		auto entry = mavlink::mavlink_get_msg_entry(msgid);
+		if (entry != nullptr) {
+			if (entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM)
+				target_system = field(entry->target_system_ofs);
+			if (entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_COMPONENT)
+				target_component = field(entry->target_component_ofs);
+		}
+		if (it->second >= 0)
+			instance = field(it->second);
+
+		const uint64_t sysid = mavlink1 ? p[3] : p[5];
+		const uint64_t compid = mavlink1 ? p[4] : p[6];
+
+		key = uint64_t(msgid) << 40 | sysid << 32 | compid << 24 |
+			target_system << 16 | target_component << 8 | instance;
+		return true;
+	}
+
+	size_t select() {
+		if (config.scheduling == TxScheduling::strict) {
+			for (size_t cls = 0; cls < NUM_CLASSES; cls++) {
+				if (!q[cls].empty())
+					return cls;
+			}
+		}
+		else {
+			// stay on a class for its weight, then the next backlogged one
+			for (int round = 0; round < 2; round++) {
+				for (size_t i = 0; i < NUM_CLASSES; i++) {
+					size_t cls = (last + i) % NUM_CLASSES;
+					if (!q[cls].empty() && credit[cls] > 0) {
+						credit[cls]--;
+						last = cls;
+						return cls;
+					}
+				}
+
+				for (size_t cls = 0; cls < NUM_CLASSES; cls++)
+					credit[cls] = (config.weight[cls] > 0) ? config.weight[cls] : 1;
+			}
+		}
+
+		assert(false);
+		return 0;
+	}
+};
+}	// namespace mavconn
@@ -37,23 +37,40 @@ public:
 	static constexpr auto DEFAULT_REMOTE_PORT = 14550;
 	//! Marker for boardcast mode. Not valid domain name.
 	static constexpr auto BROADCAST_REMOTE_HOST = "***i want broadcast***";
+	//! Largest UDP payload, datagrams packing several frames are read whole
+	static constexpr size_t DEFAULT_RX_BUFFER_SIZE = 65536;
 
 	/**
 	 * @param[id] bind_host    bind host
 	 * @param[id] bind_port    bind port
 	 * @param[id] remote_host  remote host (optional)
 	 * @param[id] remote_port  remote port (optional)
+	 * @param[id] rx_buffer_size  bytes read at once, longer datagrams are truncated
+	 * @param[id] io_backend      receive on io_uring if available
 	 */
 	MAVConnUDP(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
 			std::string bind_host = DEFAULT_BIND_HOST, unsigned short bind_port = DEFAULT_BIND_PORT,
-			std::string remote_host = DEFAULT_REMOTE_HOST, unsigned short remote_port = DEFAULT_REMOTE_PORT);
+			std::string remote_host = DEFAULT_REMOTE_HOST, unsigned short remote_port = DEFAULT_REMOTE_PORT,
+			size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE, IoBackend io_backend = IoBackend::asio);
 	~MAVConnUDP();
 
 	void close() override;
 
-	void send_message(const mavlink::mavlink_message_t *message) override;
-	void send_message(const mavlink::Message &message) override;
-	void send_bytes(const uint8_t *bytes, size_t length) override;
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	void set_tx_queue_config(const TxQueueConfig &config) override;
+	TxShaper::Stats get_shaping_stats() override;
+
+	inline IoBackend get_io_backend() override {
+		return rx_uring ? IoBackend::uring : IoBackend::asio;
+	}
 
 	inline bool is_open() override {
 		return socket.is_open();
@@ -71,10 +88,17 @@ private:
 	boost::asio::ip::udp::endpoint bind_ep;
 
 	std::atomic<bool> tx_in_progress;
-	std::deque<MsgBuffer> tx_q;
-	std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+	TxQueue<MsgBuffer> tx_q;
+	TxShaper tx_shaper;
+	boost::asio::steady_timer tx_timer;
+	std::vector<uint8_t> rx_buf;
+	std::unique_ptr<UringReader> rx_uring;
 	std::recursive_mutex mutex;
 
+	//! Queue a coalesced frame, replacing the queued one of its stream; mutex held
+	bool queue_latest(size_t cls, const MsgBuffer &buf);
+
+	void uring_recv(uint8_t *data, size_t len, const sockaddr *addr, socklen_t addrlen);
 	void do_recvfrom();
 	void do_sendto(bool check_tx_state);
 };
@@ -0,0 +1,148 @@
+/**
+ * @brief MAVConn Unix domain socket link classes
+ * @file unix.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <mavconn/interface.h>
+#include <mavconn/msgbuffer.h>
+#include <mavconn/stream_server.h>
+
+namespace mavconn {
+/**
+ * @brief Unix domain socket client
+ *
+ * SOCK_SEQPACKET, one frame per packet: the kernel keeps frame boundaries,
+ * so there are no partial writes and no IP stack on the way.
+ * A path starting with '@' names a Linux abstract socket.
+ */
+class MAVConnUnixClient : public MAVConnInterface,
+	public std::enable_shared_from_this<MAVConnUnixClient> {
+public:
+	static constexpr auto DEFAULT_PATH = "/tmp/mavlink.sock";
+	//! A packet holds one frame, peers may pack a few
+	static constexpr size_t DEFAULT_RX_BUFFER_SIZE = 4096;
+
+	/**
+	 * Connect to a unix-l:// server
+	 * @param[id] path           socket path
+	 * @param[id] rx_buffer_size bytes read at once, longer packets are truncated
+	 */
+	MAVConnUnixClient(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+			std::string path = DEFAULT_PATH,
+			size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE);
+	/**
+	 * Special client variation for use in MAVConnUnixServer
+	 */
+	explicit MAVConnUnixClient(uint8_t system_id, uint8_t component_id,
+			boost::asio::io_service &server_io, size_t rx_buffer_size = DEFAULT_RX_BUFFER_SIZE);
+	~MAVConnUnixClient();
+
+	void close() override;
+
+	SendStatus try_send_message(const mavlink::mavlink_message_t *message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority priority = TxPriority::automatic) override;
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override;
+
+	void set_tx_queue_config(const TxQueueConfig &config) override;
+	TxShaper::Stats get_shaping_stats() override;
+
+	inline bool is_open() override {
+		return socket.is_open();
+	}
+
+private:
+	friend class MAVConnUnixServer;
+	template<typename> friend class MAVConnStreamServer;
+	using TxBuffer = StreamTxBuffer;
+
+	boost::asio::io_service io_service;
+	std::unique_ptr<boost::asio::io_service::work> io_work;
+	std::thread io_thread;
+	bool standalone;			//!< own io thread, not a client of MAVConnUnixServer
+	boost::asio::io_service &io;		//!< own io_service or the server's
+
+	boost::asio::generic::seq_packet_protocol::socket socket;
+
+	std::atomic<bool> tx_in_progress;
+	TxQueue<TxBuffer> tx_q;			//!< frames may be shared by all clients of a server
+	TxShaper tx_shaper;
+	boost::asio::steady_timer tx_timer;
+	std::vector<uint8_t> rx_buf;
+	boost::asio::socket_base::message_flags rx_flags;
+	std::recursive_mutex mutex;
+
+	/**
+	 * This special function called by the server when connection accepted.
+	 */
+	void client_connected();
+
+	//! Queue an encoded frame, also used by the server to fan out one frame
+	SendStatus queue_frame(const TxBuffer &entry, TxPriority priority = TxPriority::automatic);
+
+	/**
+	 * What the io handlers hold: a server's client lives as long as they
+	 * do, a standalone client is not owned by them and joins its io thread.
+	 */
+	std::shared_ptr<MAVConnUnixClient> handler_ref();
+
+	void do_recv();
+	void do_send(bool check_tx_state);
+};
+
+/**
+ * @brief Unix domain socket server
+ *
+ * Broadcasts to every connected client, each on its own TX queue:
+ * a client whose queue is full misses the frame, the others do not.
+ *
+ * A server holds an flock() on "<path>.lock" while it runs: a socket file
+ * whose lock is free was left by a server that is gone and is replaced.
+ * The socket file is removed on close(), the lock file stays for the
+ * next server. Abstract sockets need neither.
+ */
+class MAVConnUnixServer : public MAVConnStreamServer<MAVConnUnixClient>,
+	public std::enable_shared_from_this<MAVConnUnixServer> {
+public:
+	/**
+	 * @param[id] path           socket path
+	 * @param[id] rx_buffer_size receive buffer of each accepted client
+	 */
+	MAVConnUnixServer(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+			std::string path = MAVConnUnixClient::DEFAULT_PATH,
+			size_t rx_buffer_size = MAVConnUnixClient::DEFAULT_RX_BUFFER_SIZE);
+	~MAVConnUnixServer();
+
+	void close() override;
+
+	inline bool is_open() override {
+		return acceptor.is_open();
+	}
+
+private:
+	boost::asio::basic_socket_acceptor<boost::asio::generic::seq_packet_protocol> acceptor;
+	std::string socket_path;
+	int lock_fd;			//!< flock() on the socket path, -1 for abstract sockets
+
+	void lock_socket_path();
+	void do_accept();
+};
+}	// namespace mavconn
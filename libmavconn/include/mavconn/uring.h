@@ -0,0 +1,100 @@
+/**
+ * @brief MAVConn io_uring receive backend
+ * @file uring.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <functional>
+#include <sys/socket.h>
+
+namespace mavconn {
+
+//! How a link waits for and reads incoming data
+enum class IoBackend {
+	asio,		//!< epoll reactor, one syscall to wait and one per read
+	uring,		//!< io_uring, wait and re-arm in one syscall (built with MAVCONN_IO_URING)
+};
+
+/**
+ * @brief Receive loop of one fd on io_uring
+ *
+ * Replaces the asio read loop of a link on kernels that have io_uring:
+ * the reads stay queued in the kernel, and one io_uring_enter() submits
+ * the re-armed reads and waits for the next completions, so a busy link
+ * makes one syscall per batch instead of an epoll_wait() and a read each.
+ *
+ * Streams (serial, TCP) keep one read in flight into a registered buffer,
+ * datagram sockets (UDP) several recvmsg() with the sender address.
+ *
+ * The loop runs on its own thread, which also sets up the ring: the kernel
+ * interrupts the thread that made a ring once the ring goes away, that
+ * must not be a thread of the link. The link only calls stop(). Built without MAVCONN_IO_URING, or when the kernel refuses
+ * io_uring, open() returns nullptr and the link stays on asio.
+ */
+class UringReader {
+public:
+	enum class Kind {
+		stream,		//!< tty or connected stream socket
+		datagram,	//!< datagram socket, each read reports the sender
+	};
+
+	//! Received bytes, addr is the sender of a datagram, nullptr for streams
+	using RecvCb = std::function<void (uint8_t *data, size_t len, const sockaddr *addr, socklen_t addrlen)>;
+	//! The fd failed or reached EOF (err 0), the loop has ended
+	using ErrorCb = std::function<void (int err)>;
+
+	//! Reads in flight on a datagram socket
+	static constexpr size_t DATAGRAM_DEPTH = 8;
+
+	~UringReader();
+
+	//! Built with io_uring and the kernel lets us set up a ring with what we need
+	static bool available();
+
+	/**
+	 * Set up a ring for fd on a new thread, which waits for start()
+	 *
+	 * @param[in] fd           the link's fd, stays owned by the link
+	 * @param[in] kind         stream or datagram
+	 * @param[in] buffer_size  bytes per read, like the link's rx buffer
+	 * @return nullptr when io_uring is not available
+	 */
+	static std::unique_ptr<UringReader> open(int fd, Kind kind, size_t buffer_size);
+
+	/**
+	 * Run the receive loop on the reader's thread
+	 *
+	 * Callbacks are called on that thread, error_cb at most once.
+	 */
+	void start(const std::string &thread_name, RecvCb recv_cb, ErrorCb error_cb);
+
+	/**
+	 * Cancel the reads and end the loop, waits for it unless called from a callback
+	 *
+	 * The link calls it before it closes the fd. From a callback the reads
+	 * are cancelled and reaped before it returns, the thread is joined by
+	 * the next stop() or the destructor.
+	 */
+	void stop();
+
+private:
+	struct Ring;
+
+	std::shared_ptr<Ring> ring;
+
+	explicit UringReader(std::shared_ptr<Ring> ring);
+};
+}	// namespace mavconn
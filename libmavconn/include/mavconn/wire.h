@@ -0,0 +1,128 @@
+/**
+ * @brief MAVConn packed wire layouts
+ * @file wire.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <mavconn/mavlink_dialect.h>
+
+namespace mavconn {
+namespace wire {
+/*
+ * Wire structs mirror the payload byte for byte, which only matches the
+ * field values on little endian hosts: decode() and encode() refuse to
+ * build elsewhere, big endian hosts use the views or MsgMap.
+ * The views load each field through load_le() and work on both.
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+static constexpr bool HOST_LITTLE_ENDIAN = false;
+#else
+static constexpr bool HOST_LITTLE_ENDIAN = true;
+#endif
+
+/**
+ * @brief Load a little endian field into a host value
+ */
+template<typename _T>
+inline _T load_le(const uint8_t *src)
+{
+	_T value;
+	if (HOST_LITTLE_ENDIAN) {
+		std::memcpy(&value, src, sizeof(_T));
+	}
+	else {
+		uint8_t *dst = reinterpret_cast<uint8_t *>(&value);
+		for (size_t i = 0; i < sizeof(_T); i++)
+			dst[i] = src[sizeof(_T) - 1 - i];
+	}
+	return value;
+}
+
+/**
+ * @brief Decode payload into a wire struct with one bounded copy
+ *
+ * MAVLink 2 drops trailing zero bytes of the payload, the missing tail
+ * (and any extension field the sender does not know) is zero filled.
+ */
+template<typename _W>
+inline void decode(const mavlink::mavlink_message_t *msg, _W &out)
+{
+	static_assert(HOST_LITTLE_ENDIAN || sizeof(_W) == 0, "wire structs need a little endian host, use the views");
+
+	const size_t n = std::min<size_t>(msg->len, sizeof(_W));
+
+	std::memcpy(&out, _MAV_PAYLOAD(msg), n);
+	std::memset(reinterpret_cast<uint8_t *>(&out) + n, 0, sizeof(_W) - n);
+}
+
+/**
+ * @brief Encode wire struct into message payload
+ *
+ * Finalize as usual, e.g.:
+ * mavlink_finalize_message(msg, sysid, compid, _W::MIN_LENGTH, _W::LENGTH, _W::CRC_EXTRA)
+ */
+template<typename _W>
+inline void encode(const _W &in, mavlink::mavlink_message_t *msg)
+{
+	static_assert(HOST_LITTLE_ENDIAN || sizeof(_W) == 0, "wire structs need a little endian host, use MsgMap");
+
+	msg->msgid = _W::MSG_ID;
+	msg->len = _W::LENGTH;
+	std::memcpy(_MAV_PAYLOAD_NON_CONST(msg), &in, sizeof(_W));
+}
+
+/**
+ * @brief Base of the generated lazy views (wire::<dialect>::view::<MSG>)
+ *
+ * Keeps a pointer to the received payload and its length at construction,
+ * each accessor loads one field. Fields cut off by MAVLink 2 payload
+ * trimming read as zero. The view must not outlive the message.
+ */
+class View {
+protected:
+	explicit View(const mavlink::mavlink_message_t *msg) :
+		payload(reinterpret_cast<const uint8_t *>(_MAV_PAYLOAD(msg))),
+		len(msg->len)
+	{ }
+
+	template<typename _T>
+	_T load_field(size_t offset) const {
+		if (offset + sizeof(_T) <= len)
+			return load_le<_T>(payload + offset);
+
+		uint8_t buf[sizeof(_T)] = {};
+		if (offset < len)
+			std::memcpy(buf, payload + offset, len - offset);
+		return load_le<_T>(buf);
+	}
+
+	//! char[size] field, like mavlink::to_string()
+	std::string load_string(size_t offset, size_t size) const {
+		if (offset >= len)
+			return std::string();
+		const char *p = reinterpret_cast<const char *>(payload + offset);
+		return std::string(p, strnlen(p, std::min(size, len - offset)));
+	}
+
+private:
+	const uint8_t *payload;
+	size_t len;
+};
+}	// namespace wire
+}	// namespace mavconn
+
+#include <mavconn/wire_common.h>
@@ -0,0 +1,6403 @@
+/**
+ * @brief MAVConn packed wire layouts, common dialect
+ * @file wire_common.h
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+
+// AUTOMATIC GENERATED FILE!
+// from tools/wiregen.py, do not edit
+
+// include through <mavconn/wire.h>
+
+namespace mavconn {
+namespace wire {
+namespace common {
+
+/**
+ * @brief HEARTBEAT wire layout
+ */
+MAVPACKED(
+struct HEARTBEAT {
+	static constexpr mavlink::msgid_t MSG_ID = 0;
+	static constexpr size_t LENGTH = 9;
+	static constexpr size_t MIN_LENGTH = 9;
+	static constexpr uint8_t CRC_EXTRA = 50;
+
+	uint32_t custom_mode;                   // offset: 0
+	uint8_t type;                           // offset: 4
+	uint8_t autopilot;                      // offset: 5
+	uint8_t base_mode;                      // offset: 6
+	uint8_t system_status;                  // offset: 7
+	uint8_t mavlink_version;                // offset: 8
+});
+static_assert(sizeof(HEARTBEAT) == HEARTBEAT::LENGTH, "HEARTBEAT wire layout");
+
+/**
+ * @brief SYS_STATUS wire layout
+ */
+MAVPACKED(
+struct SYS_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 1;
+	static constexpr size_t LENGTH = 31;
+	static constexpr size_t MIN_LENGTH = 31;
+	static constexpr uint8_t CRC_EXTRA = 124;
+
+	uint32_t onboard_control_sensors_present;// offset: 0
+	uint32_t onboard_control_sensors_enabled;// offset: 4
+	uint32_t onboard_control_sensors_health;// offset: 8
+	uint16_t load;                          // offset: 12
+	uint16_t voltage_battery;               // offset: 14
+	int16_t current_battery;                // offset: 16
+	uint16_t drop_rate_comm;                // offset: 18
+	uint16_t errors_comm;                   // offset: 20
+	uint16_t errors_count1;                 // offset: 22
+	uint16_t errors_count2;                 // offset: 24
+	uint16_t errors_count3;                 // offset: 26
+	uint16_t errors_count4;                 // offset: 28
+	int8_t battery_remaining;               // offset: 30
+});
+static_assert(sizeof(SYS_STATUS) == SYS_STATUS::LENGTH, "SYS_STATUS wire layout");
+
+/**
+ * @brief SYSTEM_TIME wire layout
+ */
+MAVPACKED(
+struct SYSTEM_TIME {
+	static constexpr mavlink::msgid_t MSG_ID = 2;
+	static constexpr size_t LENGTH = 12;
+	static constexpr size_t MIN_LENGTH = 12;
+	static constexpr uint8_t CRC_EXTRA = 137;
+
+	uint64_t time_unix_usec;                // offset: 0
+	uint32_t time_boot_ms;                  // offset: 8
+});
+static_assert(sizeof(SYSTEM_TIME) == SYSTEM_TIME::LENGTH, "SYSTEM_TIME wire layout");
+
+/**
+ * @brief PING wire layout
+ */
+MAVPACKED(
+struct PING {
+	static constexpr mavlink::msgid_t MSG_ID = 4;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 237;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t seq;                           // offset: 8
+	uint8_t target_system;                  // offset: 12
+	uint8_t target_component;               // offset: 13
+});
+static_assert(sizeof(PING) == PING::LENGTH, "PING wire layout");
+
+/**
+ * @brief CHANGE_OPERATOR_CONTROL wire layout
+ */
+MAVPACKED(
+struct CHANGE_OPERATOR_CONTROL {
+	static constexpr mavlink::msgid_t MSG_ID = 5;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 217;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t control_request;                // offset: 1
+	uint8_t version;                        // offset: 2
+	char passkey[25];                       // offset: 3
+});
+static_assert(sizeof(CHANGE_OPERATOR_CONTROL) == CHANGE_OPERATOR_CONTROL::LENGTH, "CHANGE_OPERATOR_CONTROL wire layout");
+
+/**
+ * @brief CHANGE_OPERATOR_CONTROL_ACK wire layout
+ */
+MAVPACKED(
+struct CHANGE_OPERATOR_CONTROL_ACK {
+	static constexpr mavlink::msgid_t MSG_ID = 6;
+	static constexpr size_t LENGTH = 3;
+	static constexpr size_t MIN_LENGTH = 3;
+	static constexpr uint8_t CRC_EXTRA = 104;
+
+	uint8_t gcs_system_id;                  // offset: 0
+	uint8_t control_request;                // offset: 1
+	uint8_t ack;                            // offset: 2
+});
+static_assert(sizeof(CHANGE_OPERATOR_CONTROL_ACK) == CHANGE_OPERATOR_CONTROL_ACK::LENGTH, "CHANGE_OPERATOR_CONTROL_ACK wire layout");
+
+/**
+ * @brief AUTH_KEY wire layout
+ */
+MAVPACKED(
+struct AUTH_KEY {
+	static constexpr mavlink::msgid_t MSG_ID = 7;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 119;
+
+	char key[32];                           // offset: 0
+});
+static_assert(sizeof(AUTH_KEY) == AUTH_KEY::LENGTH, "AUTH_KEY wire layout");
+
+/**
+ * @brief SET_MODE wire layout
+ */
+MAVPACKED(
+struct SET_MODE {
+	static constexpr mavlink::msgid_t MSG_ID = 11;
+	static constexpr size_t LENGTH = 6;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 89;
+
+	uint32_t custom_mode;                   // offset: 0
+	uint8_t target_system;                  // offset: 4
+	uint8_t base_mode;                      // offset: 5
+});
+static_assert(sizeof(SET_MODE) == SET_MODE::LENGTH, "SET_MODE wire layout");
+
+/**
+ * @brief PARAM_REQUEST_READ wire layout
+ */
+MAVPACKED(
+struct PARAM_REQUEST_READ {
+	static constexpr mavlink::msgid_t MSG_ID = 20;
+	static constexpr size_t LENGTH = 20;
+	static constexpr size_t MIN_LENGTH = 20;
+	static constexpr uint8_t CRC_EXTRA = 214;
+
+	int16_t param_index;                    // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	char param_id[16];                      // offset: 4
+});
+static_assert(sizeof(PARAM_REQUEST_READ) == PARAM_REQUEST_READ::LENGTH, "PARAM_REQUEST_READ wire layout");
+
+/**
+ * @brief PARAM_REQUEST_LIST wire layout
+ */
+MAVPACKED(
+struct PARAM_REQUEST_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 21;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 159;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+});
+static_assert(sizeof(PARAM_REQUEST_LIST) == PARAM_REQUEST_LIST::LENGTH, "PARAM_REQUEST_LIST wire layout");
+
+/**
+ * @brief PARAM_VALUE wire layout
+ */
+MAVPACKED(
+struct PARAM_VALUE {
+	static constexpr mavlink::msgid_t MSG_ID = 22;
+	static constexpr size_t LENGTH = 25;
+	static constexpr size_t MIN_LENGTH = 25;
+	static constexpr uint8_t CRC_EXTRA = 220;
+
+	float param_value;                      // offset: 0
+	uint16_t param_count;                   // offset: 4
+	uint16_t param_index;                   // offset: 6
+	char param_id[16];                      // offset: 8
+	uint8_t param_type;                     // offset: 24
+});
+static_assert(sizeof(PARAM_VALUE) == PARAM_VALUE::LENGTH, "PARAM_VALUE wire layout");
+
+/**
+ * @brief PARAM_SET wire layout
+ */
+MAVPACKED(
+struct PARAM_SET {
+	static constexpr mavlink::msgid_t MSG_ID = 23;
+	static constexpr size_t LENGTH = 23;
+	static constexpr size_t MIN_LENGTH = 23;
+	static constexpr uint8_t CRC_EXTRA = 168;
+
+	float param_value;                      // offset: 0
+	uint8_t target_system;                  // offset: 4
+	uint8_t target_component;               // offset: 5
+	char param_id[16];                      // offset: 6
+	uint8_t param_type;                     // offset: 22
+});
+static_assert(sizeof(PARAM_SET) == PARAM_SET::LENGTH, "PARAM_SET wire layout");
+
+/**
+ * @brief GPS_RAW_INT wire layout
+ */
+MAVPACKED(
+struct GPS_RAW_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 24;
+	static constexpr size_t LENGTH = 50;
+	static constexpr size_t MIN_LENGTH = 30;
+	static constexpr uint8_t CRC_EXTRA = 24;
+
+	uint64_t time_usec;                     // offset: 0
+	int32_t lat;                            // offset: 8
+	int32_t lon;                            // offset: 12
+	int32_t alt;                            // offset: 16
+	uint16_t eph;                           // offset: 20
+	uint16_t epv;                           // offset: 22
+	uint16_t vel;                           // offset: 24
+	uint16_t cog;                           // offset: 26
+	uint8_t fix_type;                       // offset: 28
+	uint8_t satellites_visible;             // offset: 29
+	int32_t alt_ellipsoid;                  // offset: 30
+	uint32_t h_acc;                         // offset: 34
+	uint32_t v_acc;                         // offset: 38
+	uint32_t vel_acc;                       // offset: 42
+	uint32_t hdg_acc;                       // offset: 46
+});
+static_assert(sizeof(GPS_RAW_INT) == GPS_RAW_INT::LENGTH, "GPS_RAW_INT wire layout");
+
+/**
+ * @brief GPS_STATUS wire layout
+ */
+MAVPACKED(
+struct GPS_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 25;
+	static constexpr size_t LENGTH = 101;
+	static constexpr size_t MIN_LENGTH = 101;
+	static constexpr uint8_t CRC_EXTRA = 23;
+
+	uint8_t satellites_visible;             // offset: 0
+	uint8_t satellite_prn[20];              // offset: 1
+	uint8_t satellite_used[20];             // offset: 21
+	uint8_t satellite_elevation[20];        // offset: 41
+	uint8_t satellite_azimuth[20];          // offset: 61
+	uint8_t satellite_snr[20];              // offset: 81
+});
+static_assert(sizeof(GPS_STATUS) == GPS_STATUS::LENGTH, "GPS_STATUS wire layout");
+
+/**
+ * @brief SCALED_IMU wire layout
+ */
+MAVPACKED(
+struct SCALED_IMU {
+	static constexpr mavlink::msgid_t MSG_ID = 26;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 170;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int16_t xacc;                           // offset: 4
+	int16_t yacc;                           // offset: 6
+	int16_t zacc;                           // offset: 8
+	int16_t xgyro;                          // offset: 10
+	int16_t ygyro;                          // offset: 12
+	int16_t zgyro;                          // offset: 14
+	int16_t xmag;                           // offset: 16
+	int16_t ymag;                           // offset: 18
+	int16_t zmag;                           // offset: 20
+});
+static_assert(sizeof(SCALED_IMU) == SCALED_IMU::LENGTH, "SCALED_IMU wire layout");
+
+/**
+ * @brief RAW_IMU wire layout
+ */
+MAVPACKED(
+struct RAW_IMU {
+	static constexpr mavlink::msgid_t MSG_ID = 27;
+	static constexpr size_t LENGTH = 26;
+	static constexpr size_t MIN_LENGTH = 26;
+	static constexpr uint8_t CRC_EXTRA = 144;
+
+	uint64_t time_usec;                     // offset: 0
+	int16_t xacc;                           // offset: 8
+	int16_t yacc;                           // offset: 10
+	int16_t zacc;                           // offset: 12
+	int16_t xgyro;                          // offset: 14
+	int16_t ygyro;                          // offset: 16
+	int16_t zgyro;                          // offset: 18
+	int16_t xmag;                           // offset: 20
+	int16_t ymag;                           // offset: 22
+	int16_t zmag;                           // offset: 24
+});
+static_assert(sizeof(RAW_IMU) == RAW_IMU::LENGTH, "RAW_IMU wire layout");
+
+/**
+ * @brief RAW_PRESSURE wire layout
+ */
+MAVPACKED(
+struct RAW_PRESSURE {
+	static constexpr mavlink::msgid_t MSG_ID = 28;
+	static constexpr size_t LENGTH = 16;
+	static constexpr size_t MIN_LENGTH = 16;
+	static constexpr uint8_t CRC_EXTRA = 67;
+
+	uint64_t time_usec;                     // offset: 0
+	int16_t press_abs;                      // offset: 8
+	int16_t press_diff1;                    // offset: 10
+	int16_t press_diff2;                    // offset: 12
+	int16_t temperature;                    // offset: 14
+});
+static_assert(sizeof(RAW_PRESSURE) == RAW_PRESSURE::LENGTH, "RAW_PRESSURE wire layout");
+
+/**
+ * @brief SCALED_PRESSURE wire layout
+ */
+MAVPACKED(
+struct SCALED_PRESSURE {
+	static constexpr mavlink::msgid_t MSG_ID = 29;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 115;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float press_abs;                        // offset: 4
+	float press_diff;                       // offset: 8
+	int16_t temperature;                    // offset: 12
+});
+static_assert(sizeof(SCALED_PRESSURE) == SCALED_PRESSURE::LENGTH, "SCALED_PRESSURE wire layout");
+
+/**
+ * @brief ATTITUDE wire layout
+ */
+MAVPACKED(
+struct ATTITUDE {
+	static constexpr mavlink::msgid_t MSG_ID = 30;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 39;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float roll;                             // offset: 4
+	float pitch;                            // offset: 8
+	float yaw;                              // offset: 12
+	float rollspeed;                        // offset: 16
+	float pitchspeed;                       // offset: 20
+	float yawspeed;                         // offset: 24
+});
+static_assert(sizeof(ATTITUDE) == ATTITUDE::LENGTH, "ATTITUDE wire layout");
+
+/**
+ * @brief ATTITUDE_QUATERNION wire layout
+ */
+MAVPACKED(
+struct ATTITUDE_QUATERNION {
+	static constexpr mavlink::msgid_t MSG_ID = 31;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 246;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float q1;                               // offset: 4
+	float q2;                               // offset: 8
+	float q3;                               // offset: 12
+	float q4;                               // offset: 16
+	float rollspeed;                        // offset: 20
+	float pitchspeed;                       // offset: 24
+	float yawspeed;                         // offset: 28
+});
+static_assert(sizeof(ATTITUDE_QUATERNION) == ATTITUDE_QUATERNION::LENGTH, "ATTITUDE_QUATERNION wire layout");
+
+/**
+ * @brief LOCAL_POSITION_NED wire layout
+ */
+MAVPACKED(
+struct LOCAL_POSITION_NED {
+	static constexpr mavlink::msgid_t MSG_ID = 32;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 185;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float x;                                // offset: 4
+	float y;                                // offset: 8
+	float z;                                // offset: 12
+	float vx;                               // offset: 16
+	float vy;                               // offset: 20
+	float vz;                               // offset: 24
+});
+static_assert(sizeof(LOCAL_POSITION_NED) == LOCAL_POSITION_NED::LENGTH, "LOCAL_POSITION_NED wire layout");
+
+/**
+ * @brief GLOBAL_POSITION_INT wire layout
+ */
+MAVPACKED(
+struct GLOBAL_POSITION_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 33;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 104;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int32_t lat;                            // offset: 4
+	int32_t lon;                            // offset: 8
+	int32_t alt;                            // offset: 12
+	int32_t relative_alt;                   // offset: 16
+	int16_t vx;                             // offset: 20
+	int16_t vy;                             // offset: 22
+	int16_t vz;                             // offset: 24
+	uint16_t hdg;                           // offset: 26
+});
+static_assert(sizeof(GLOBAL_POSITION_INT) == GLOBAL_POSITION_INT::LENGTH, "GLOBAL_POSITION_INT wire layout");
+
+/**
+ * @brief RC_CHANNELS_SCALED wire layout
+ */
+MAVPACKED(
+struct RC_CHANNELS_SCALED {
+	static constexpr mavlink::msgid_t MSG_ID = 34;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 237;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int16_t chan1_scaled;                   // offset: 4
+	int16_t chan2_scaled;                   // offset: 6
+	int16_t chan3_scaled;                   // offset: 8
+	int16_t chan4_scaled;                   // offset: 10
+	int16_t chan5_scaled;                   // offset: 12
+	int16_t chan6_scaled;                   // offset: 14
+	int16_t chan7_scaled;                   // offset: 16
+	int16_t chan8_scaled;                   // offset: 18
+	uint8_t port;                           // offset: 20
+	uint8_t rssi;                           // offset: 21
+});
+static_assert(sizeof(RC_CHANNELS_SCALED) == RC_CHANNELS_SCALED::LENGTH, "RC_CHANNELS_SCALED wire layout");
+
+/**
+ * @brief RC_CHANNELS_RAW wire layout
+ */
+MAVPACKED(
+struct RC_CHANNELS_RAW {
+	static constexpr mavlink::msgid_t MSG_ID = 35;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 244;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint16_t chan1_raw;                     // offset: 4
+	uint16_t chan2_raw;                     // offset: 6
+	uint16_t chan3_raw;                     // offset: 8
+	uint16_t chan4_raw;                     // offset: 10
+	uint16_t chan5_raw;                     // offset: 12
+	uint16_t chan6_raw;                     // offset: 14
+	uint16_t chan7_raw;                     // offset: 16
+	uint16_t chan8_raw;                     // offset: 18
+	uint8_t port;                           // offset: 20
+	uint8_t rssi;                           // offset: 21
+});
+static_assert(sizeof(RC_CHANNELS_RAW) == RC_CHANNELS_RAW::LENGTH, "RC_CHANNELS_RAW wire layout");
+
+/**
+ * @brief SERVO_OUTPUT_RAW wire layout
+ */
+MAVPACKED(
+struct SERVO_OUTPUT_RAW {
+	static constexpr mavlink::msgid_t MSG_ID = 36;
+	static constexpr size_t LENGTH = 37;
+	static constexpr size_t MIN_LENGTH = 21;
+	static constexpr uint8_t CRC_EXTRA = 222;
+
+	uint32_t time_usec;                     // offset: 0
+	uint16_t servo1_raw;                    // offset: 4
+	uint16_t servo2_raw;                    // offset: 6
+	uint16_t servo3_raw;                    // offset: 8
+	uint16_t servo4_raw;                    // offset: 10
+	uint16_t servo5_raw;                    // offset: 12
+	uint16_t servo6_raw;                    // offset: 14
+	uint16_t servo7_raw;                    // offset: 16
+	uint16_t servo8_raw;                    // offset: 18
+	uint8_t port;                           // offset: 20
+	uint16_t servo9_raw;                    // offset: 21
+	uint16_t servo10_raw;                   // offset: 23
+	uint16_t servo11_raw;                   // offset: 25
+	uint16_t servo12_raw;                   // offset: 27
+	uint16_t servo13_raw;                   // offset: 29
+	uint16_t servo14_raw;                   // offset: 31
+	uint16_t servo15_raw;                   // offset: 33
+	uint16_t servo16_raw;                   // offset: 35
+});
+static_assert(sizeof(SERVO_OUTPUT_RAW) == SERVO_OUTPUT_RAW::LENGTH, "SERVO_OUTPUT_RAW wire layout");
+
+/**
+ * @brief MISSION_REQUEST_PARTIAL_LIST wire layout
+ */
+MAVPACKED(
+struct MISSION_REQUEST_PARTIAL_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 37;
+	static constexpr size_t LENGTH = 7;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 212;
+
+	int16_t start_index;                    // offset: 0
+	int16_t end_index;                      // offset: 2
+	uint8_t target_system;                  // offset: 4
+	uint8_t target_component;               // offset: 5
+	uint8_t mission_type;                   // offset: 6
+});
+static_assert(sizeof(MISSION_REQUEST_PARTIAL_LIST) == MISSION_REQUEST_PARTIAL_LIST::LENGTH, "MISSION_REQUEST_PARTIAL_LIST wire layout");
+
+/**
+ * @brief MISSION_WRITE_PARTIAL_LIST wire layout
+ */
+MAVPACKED(
+struct MISSION_WRITE_PARTIAL_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 38;
+	static constexpr size_t LENGTH = 7;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 9;
+
+	int16_t start_index;                    // offset: 0
+	int16_t end_index;                      // offset: 2
+	uint8_t target_system;                  // offset: 4
+	uint8_t target_component;               // offset: 5
+	uint8_t mission_type;                   // offset: 6
+});
+static_assert(sizeof(MISSION_WRITE_PARTIAL_LIST) == MISSION_WRITE_PARTIAL_LIST::LENGTH, "MISSION_WRITE_PARTIAL_LIST wire layout");
+
+/**
+ * @brief MISSION_ITEM wire layout
+ */
+MAVPACKED(
+struct MISSION_ITEM {
+	static constexpr mavlink::msgid_t MSG_ID = 39;
+	static constexpr size_t LENGTH = 38;
+	static constexpr size_t MIN_LENGTH = 37;
+	static constexpr uint8_t CRC_EXTRA = 254;
+
+	float param1;                           // offset: 0
+	float param2;                           // offset: 4
+	float param3;                           // offset: 8
+	float param4;                           // offset: 12
+	float x;                                // offset: 16
+	float y;                                // offset: 20
+	float z;                                // offset: 24
+	uint16_t seq;                           // offset: 28
+	uint16_t command;                       // offset: 30
+	uint8_t target_system;                  // offset: 32
+	uint8_t target_component;               // offset: 33
+	uint8_t frame;                          // offset: 34
+	uint8_t current;                        // offset: 35
+	uint8_t autocontinue;                   // offset: 36
+	uint8_t mission_type;                   // offset: 37
+});
+static_assert(sizeof(MISSION_ITEM) == MISSION_ITEM::LENGTH, "MISSION_ITEM wire layout");
+
+/**
+ * @brief MISSION_REQUEST wire layout
+ */
+MAVPACKED(
+struct MISSION_REQUEST {
+	static constexpr mavlink::msgid_t MSG_ID = 40;
+	static constexpr size_t LENGTH = 5;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 230;
+
+	uint16_t seq;                           // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t mission_type;                   // offset: 4
+});
+static_assert(sizeof(MISSION_REQUEST) == MISSION_REQUEST::LENGTH, "MISSION_REQUEST wire layout");
+
+/**
+ * @brief MISSION_SET_CURRENT wire layout
+ */
+MAVPACKED(
+struct MISSION_SET_CURRENT {
+	static constexpr mavlink::msgid_t MSG_ID = 41;
+	static constexpr size_t LENGTH = 4;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 28;
+
+	uint16_t seq;                           // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+});
+static_assert(sizeof(MISSION_SET_CURRENT) == MISSION_SET_CURRENT::LENGTH, "MISSION_SET_CURRENT wire layout");
+
+/**
+ * @brief MISSION_CURRENT wire layout
+ */
+MAVPACKED(
+struct MISSION_CURRENT {
+	static constexpr mavlink::msgid_t MSG_ID = 42;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 28;
+
+	uint16_t seq;                           // offset: 0
+});
+static_assert(sizeof(MISSION_CURRENT) == MISSION_CURRENT::LENGTH, "MISSION_CURRENT wire layout");
+
+/**
+ * @brief MISSION_REQUEST_LIST wire layout
+ */
+MAVPACKED(
+struct MISSION_REQUEST_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 43;
+	static constexpr size_t LENGTH = 3;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 132;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	uint8_t mission_type;                   // offset: 2
+});
+static_assert(sizeof(MISSION_REQUEST_LIST) == MISSION_REQUEST_LIST::LENGTH, "MISSION_REQUEST_LIST wire layout");
+
+/**
+ * @brief MISSION_COUNT wire layout
+ */
+MAVPACKED(
+struct MISSION_COUNT {
+	static constexpr mavlink::msgid_t MSG_ID = 44;
+	static constexpr size_t LENGTH = 5;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 221;
+
+	uint16_t count;                         // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t mission_type;                   // offset: 4
+});
+static_assert(sizeof(MISSION_COUNT) == MISSION_COUNT::LENGTH, "MISSION_COUNT wire layout");
+
+/**
+ * @brief MISSION_CLEAR_ALL wire layout
+ */
+MAVPACKED(
+struct MISSION_CLEAR_ALL {
+	static constexpr mavlink::msgid_t MSG_ID = 45;
+	static constexpr size_t LENGTH = 3;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 232;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	uint8_t mission_type;                   // offset: 2
+});
+static_assert(sizeof(MISSION_CLEAR_ALL) == MISSION_CLEAR_ALL::LENGTH, "MISSION_CLEAR_ALL wire layout");
+
+/**
+ * @brief MISSION_ITEM_REACHED wire layout
+ */
+MAVPACKED(
+struct MISSION_ITEM_REACHED {
+	static constexpr mavlink::msgid_t MSG_ID = 46;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 11;
+
+	uint16_t seq;                           // offset: 0
+});
+static_assert(sizeof(MISSION_ITEM_REACHED) == MISSION_ITEM_REACHED::LENGTH, "MISSION_ITEM_REACHED wire layout");
+
+/**
+ * @brief MISSION_ACK wire layout
+ */
+MAVPACKED(
+struct MISSION_ACK {
+	static constexpr mavlink::msgid_t MSG_ID = 47;
+	static constexpr size_t LENGTH = 4;
+	static constexpr size_t MIN_LENGTH = 3;
+	static constexpr uint8_t CRC_EXTRA = 153;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	uint8_t type;                           // offset: 2
+	uint8_t mission_type;                   // offset: 3
+});
+static_assert(sizeof(MISSION_ACK) == MISSION_ACK::LENGTH, "MISSION_ACK wire layout");
+
+/**
+ * @brief SET_GPS_GLOBAL_ORIGIN wire layout
+ */
+MAVPACKED(
+struct SET_GPS_GLOBAL_ORIGIN {
+	static constexpr mavlink::msgid_t MSG_ID = 48;
+	static constexpr size_t LENGTH = 21;
+	static constexpr size_t MIN_LENGTH = 13;
+	static constexpr uint8_t CRC_EXTRA = 41;
+
+	int32_t latitude;                       // offset: 0
+	int32_t longitude;                      // offset: 4
+	int32_t altitude;                       // offset: 8
+	uint8_t target_system;                  // offset: 12
+	uint64_t time_usec;                     // offset: 13
+});
+static_assert(sizeof(SET_GPS_GLOBAL_ORIGIN) == SET_GPS_GLOBAL_ORIGIN::LENGTH, "SET_GPS_GLOBAL_ORIGIN wire layout");
+
+/**
+ * @brief GPS_GLOBAL_ORIGIN wire layout
+ */
+MAVPACKED(
+struct GPS_GLOBAL_ORIGIN {
+	static constexpr mavlink::msgid_t MSG_ID = 49;
+	static constexpr size_t LENGTH = 20;
+	static constexpr size_t MIN_LENGTH = 12;
+	static constexpr uint8_t CRC_EXTRA = 39;
+
+	int32_t latitude;                       // offset: 0
+	int32_t longitude;                      // offset: 4
+	int32_t altitude;                       // offset: 8
+	uint64_t time_usec;                     // offset: 12
+});
+static_assert(sizeof(GPS_GLOBAL_ORIGIN) == GPS_GLOBAL_ORIGIN::LENGTH, "GPS_GLOBAL_ORIGIN wire layout");
+
+/**
+ * @brief PARAM_MAP_RC wire layout
+ */
+MAVPACKED(
+struct PARAM_MAP_RC {
+	static constexpr mavlink::msgid_t MSG_ID = 50;
+	static constexpr size_t LENGTH = 37;
+	static constexpr size_t MIN_LENGTH = 37;
+	static constexpr uint8_t CRC_EXTRA = 78;
+
+	float param_value0;                     // offset: 0
+	float scale;                            // offset: 4
+	float param_value_min;                  // offset: 8
+	float param_value_max;                  // offset: 12
+	int16_t param_index;                    // offset: 16
+	uint8_t target_system;                  // offset: 18
+	uint8_t target_component;               // offset: 19
+	char param_id[16];                      // offset: 20
+	uint8_t parameter_rc_channel_index;     // offset: 36
+});
+static_assert(sizeof(PARAM_MAP_RC) == PARAM_MAP_RC::LENGTH, "PARAM_MAP_RC wire layout");
+
+/**
+ * @brief MISSION_REQUEST_INT wire layout
+ */
+MAVPACKED(
+struct MISSION_REQUEST_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 51;
+	static constexpr size_t LENGTH = 5;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 196;
+
+	uint16_t seq;                           // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t mission_type;                   // offset: 4
+});
+static_assert(sizeof(MISSION_REQUEST_INT) == MISSION_REQUEST_INT::LENGTH, "MISSION_REQUEST_INT wire layout");
+
+/**
+ * @brief SAFETY_SET_ALLOWED_AREA wire layout
+ */
+MAVPACKED(
+struct SAFETY_SET_ALLOWED_AREA {
+	static constexpr mavlink::msgid_t MSG_ID = 54;
+	static constexpr size_t LENGTH = 27;
+	static constexpr size_t MIN_LENGTH = 27;
+	static constexpr uint8_t CRC_EXTRA = 15;
+
+	float p1x;                              // offset: 0
+	float p1y;                              // offset: 4
+	float p1z;                              // offset: 8
+	float p2x;                              // offset: 12
+	float p2y;                              // offset: 16
+	float p2z;                              // offset: 20
+	uint8_t target_system;                  // offset: 24
+	uint8_t target_component;               // offset: 25
+	uint8_t frame;                          // offset: 26
+});
+static_assert(sizeof(SAFETY_SET_ALLOWED_AREA) == SAFETY_SET_ALLOWED_AREA::LENGTH, "SAFETY_SET_ALLOWED_AREA wire layout");
+
+/**
+ * @brief SAFETY_ALLOWED_AREA wire layout
+ */
+MAVPACKED(
+struct SAFETY_ALLOWED_AREA {
+	static constexpr mavlink::msgid_t MSG_ID = 55;
+	static constexpr size_t LENGTH = 25;
+	static constexpr size_t MIN_LENGTH = 25;
+	static constexpr uint8_t CRC_EXTRA = 3;
+
+	float p1x;                              // offset: 0
+	float p1y;                              // offset: 4
+	float p1z;                              // offset: 8
+	float p2x;                              // offset: 12
+	float p2y;                              // offset: 16
+	float p2z;                              // offset: 20
+	uint8_t frame;                          // offset: 24
+});
+static_assert(sizeof(SAFETY_ALLOWED_AREA) == SAFETY_ALLOWED_AREA::LENGTH, "SAFETY_ALLOWED_AREA wire layout");
+
+/**
+ * @brief ATTITUDE_QUATERNION_COV wire layout
+ */
+MAVPACKED(
+struct ATTITUDE_QUATERNION_COV {
+	static constexpr mavlink::msgid_t MSG_ID = 61;
+	static constexpr size_t LENGTH = 72;
+	static constexpr size_t MIN_LENGTH = 72;
+	static constexpr uint8_t CRC_EXTRA = 167;
+
+	uint64_t time_usec;                     // offset: 0
+	float q[4];                             // offset: 8
+	float rollspeed;                        // offset: 24
+	float pitchspeed;                       // offset: 28
+	float yawspeed;                         // offset: 32
+	float covariance[9];                    // offset: 36
+});
+static_assert(sizeof(ATTITUDE_QUATERNION_COV) == ATTITUDE_QUATERNION_COV::LENGTH, "ATTITUDE_QUATERNION_COV wire layout");
+
+/**
+ * @brief NAV_CONTROLLER_OUTPUT wire layout
+ */
+MAVPACKED(
+struct NAV_CONTROLLER_OUTPUT {
+	static constexpr mavlink::msgid_t MSG_ID = 62;
+	static constexpr size_t LENGTH = 26;
+	static constexpr size_t MIN_LENGTH = 26;
+	static constexpr uint8_t CRC_EXTRA = 183;
+
+	float nav_roll;                         // offset: 0
+	float nav_pitch;                        // offset: 4
+	float alt_error;                        // offset: 8
+	float aspd_error;                       // offset: 12
+	float xtrack_error;                     // offset: 16
+	int16_t nav_bearing;                    // offset: 20
+	int16_t target_bearing;                 // offset: 22
+	uint16_t wp_dist;                       // offset: 24
+});
+static_assert(sizeof(NAV_CONTROLLER_OUTPUT) == NAV_CONTROLLER_OUTPUT::LENGTH, "NAV_CONTROLLER_OUTPUT wire layout");
+
+/**
+ * @brief GLOBAL_POSITION_INT_COV wire layout
+ */
+MAVPACKED(
+struct GLOBAL_POSITION_INT_COV {
+	static constexpr mavlink::msgid_t MSG_ID = 63;
+	static constexpr size_t LENGTH = 181;
+	static constexpr size_t MIN_LENGTH = 181;
+	static constexpr uint8_t CRC_EXTRA = 119;
+
+	uint64_t time_usec;                     // offset: 0
+	int32_t lat;                            // offset: 8
+	int32_t lon;                            // offset: 12
+	int32_t alt;                            // offset: 16
+	int32_t relative_alt;                   // offset: 20
+	float vx;                               // offset: 24
+	float vy;                               // offset: 28
+	float vz;                               // offset: 32
+	float covariance[36];                   // offset: 36
+	uint8_t estimator_type;                 // offset: 180
+});
+static_assert(sizeof(GLOBAL_POSITION_INT_COV) == GLOBAL_POSITION_INT_COV::LENGTH, "GLOBAL_POSITION_INT_COV wire layout");
+
+/**
+ * @brief LOCAL_POSITION_NED_COV wire layout
+ */
+MAVPACKED(
+struct LOCAL_POSITION_NED_COV {
+	static constexpr mavlink::msgid_t MSG_ID = 64;
+	static constexpr size_t LENGTH = 225;
+	static constexpr size_t MIN_LENGTH = 225;
+	static constexpr uint8_t CRC_EXTRA = 191;
+
+	uint64_t time_usec;                     // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+	float vx;                               // offset: 20
+	float vy;                               // offset: 24
+	float vz;                               // offset: 28
+	float ax;                               // offset: 32
+	float ay;                               // offset: 36
+	float az;                               // offset: 40
+	float covariance[45];                   // offset: 44
+	uint8_t estimator_type;                 // offset: 224
+});
+static_assert(sizeof(LOCAL_POSITION_NED_COV) == LOCAL_POSITION_NED_COV::LENGTH, "LOCAL_POSITION_NED_COV wire layout");
+
+/**
+ * @brief RC_CHANNELS wire layout
+ */
+MAVPACKED(
+struct RC_CHANNELS {
+	static constexpr mavlink::msgid_t MSG_ID = 65;
+	static constexpr size_t LENGTH = 42;
+	static constexpr size_t MIN_LENGTH = 42;
+	static constexpr uint8_t CRC_EXTRA = 118;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint16_t chan1_raw;                     // offset: 4
+	uint16_t chan2_raw;                     // offset: 6
+	uint16_t chan3_raw;                     // offset: 8
+	uint16_t chan4_raw;                     // offset: 10
+	uint16_t chan5_raw;                     // offset: 12
+	uint16_t chan6_raw;                     // offset: 14
+	uint16_t chan7_raw;                     // offset: 16
+	uint16_t chan8_raw;                     // offset: 18
+	uint16_t chan9_raw;                     // offset: 20
+	uint16_t chan10_raw;                    // offset: 22
+	uint16_t chan11_raw;                    // offset: 24
+	uint16_t chan12_raw;                    // offset: 26
+	uint16_t chan13_raw;                    // offset: 28
+	uint16_t chan14_raw;                    // offset: 30
+	uint16_t chan15_raw;                    // offset: 32
+	uint16_t chan16_raw;                    // offset: 34
+	uint16_t chan17_raw;                    // offset: 36
+	uint16_t chan18_raw;                    // offset: 38
+	uint8_t chancount;                      // offset: 40
+	uint8_t rssi;                           // offset: 41
+});
+static_assert(sizeof(RC_CHANNELS) == RC_CHANNELS::LENGTH, "RC_CHANNELS wire layout");
+
+/**
+ * @brief REQUEST_DATA_STREAM wire layout
+ */
+MAVPACKED(
+struct REQUEST_DATA_STREAM {
+	static constexpr mavlink::msgid_t MSG_ID = 66;
+	static constexpr size_t LENGTH = 6;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 148;
+
+	uint16_t req_message_rate;              // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t req_stream_id;                  // offset: 4
+	uint8_t start_stop;                     // offset: 5
+});
+static_assert(sizeof(REQUEST_DATA_STREAM) == REQUEST_DATA_STREAM::LENGTH, "REQUEST_DATA_STREAM wire layout");
+
+/**
+ * @brief DATA_STREAM wire layout
+ */
+MAVPACKED(
+struct DATA_STREAM {
+	static constexpr mavlink::msgid_t MSG_ID = 67;
+	static constexpr size_t LENGTH = 4;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 21;
+
+	uint16_t message_rate;                  // offset: 0
+	uint8_t stream_id;                      // offset: 2
+	uint8_t on_off;                         // offset: 3
+});
+static_assert(sizeof(DATA_STREAM) == DATA_STREAM::LENGTH, "DATA_STREAM wire layout");
+
+/**
+ * @brief MANUAL_CONTROL wire layout
+ */
+MAVPACKED(
+struct MANUAL_CONTROL {
+	static constexpr mavlink::msgid_t MSG_ID = 69;
+	static constexpr size_t LENGTH = 11;
+	static constexpr size_t MIN_LENGTH = 11;
+	static constexpr uint8_t CRC_EXTRA = 243;
+
+	int16_t x;                              // offset: 0
+	int16_t y;                              // offset: 2
+	int16_t z;                              // offset: 4
+	int16_t r;                              // offset: 6
+	uint16_t buttons;                       // offset: 8
+	uint8_t target;                         // offset: 10
+});
+static_assert(sizeof(MANUAL_CONTROL) == MANUAL_CONTROL::LENGTH, "MANUAL_CONTROL wire layout");
+
+/**
+ * @brief RC_CHANNELS_OVERRIDE wire layout
+ */
+MAVPACKED(
+struct RC_CHANNELS_OVERRIDE {
+	static constexpr mavlink::msgid_t MSG_ID = 70;
+	static constexpr size_t LENGTH = 18;
+	static constexpr size_t MIN_LENGTH = 18;
+	static constexpr uint8_t CRC_EXTRA = 124;
+
+	uint16_t chan1_raw;                     // offset: 0
+	uint16_t chan2_raw;                     // offset: 2
+	uint16_t chan3_raw;                     // offset: 4
+	uint16_t chan4_raw;                     // offset: 6
+	uint16_t chan5_raw;                     // offset: 8
+	uint16_t chan6_raw;                     // offset: 10
+	uint16_t chan7_raw;                     // offset: 12
+	uint16_t chan8_raw;                     // offset: 14
+	uint8_t target_system;                  // offset: 16
+	uint8_t target_component;               // offset: 17
+});
+static_assert(sizeof(RC_CHANNELS_OVERRIDE) == RC_CHANNELS_OVERRIDE::LENGTH, "RC_CHANNELS_OVERRIDE wire layout");
+
+/**
+ * @brief MISSION_ITEM_INT wire layout
+ */
+MAVPACKED(
+struct MISSION_ITEM_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 73;
+	static constexpr size_t LENGTH = 38;
+	static constexpr size_t MIN_LENGTH = 37;
+	static constexpr uint8_t CRC_EXTRA = 38;
+
+	float param1;                           // offset: 0
+	float param2;                           // offset: 4
+	float param3;                           // offset: 8
+	float param4;                           // offset: 12
+	int32_t x;                              // offset: 16
+	int32_t y;                              // offset: 20
+	float z;                                // offset: 24
+	uint16_t seq;                           // offset: 28
+	uint16_t command;                       // offset: 30
+	uint8_t target_system;                  // offset: 32
+	uint8_t target_component;               // offset: 33
+	uint8_t frame;                          // offset: 34
+	uint8_t current;                        // offset: 35
+	uint8_t autocontinue;                   // offset: 36
+	uint8_t mission_type;                   // offset: 37
+});
+static_assert(sizeof(MISSION_ITEM_INT) == MISSION_ITEM_INT::LENGTH, "MISSION_ITEM_INT wire layout");
+
+/**
+ * @brief VFR_HUD wire layout
+ */
+MAVPACKED(
+struct VFR_HUD {
+	static constexpr mavlink::msgid_t MSG_ID = 74;
+	static constexpr size_t LENGTH = 20;
+	static constexpr size_t MIN_LENGTH = 20;
+	static constexpr uint8_t CRC_EXTRA = 20;
+
+	float airspeed;                         // offset: 0
+	float groundspeed;                      // offset: 4
+	float alt;                              // offset: 8
+	float climb;                            // offset: 12
+	int16_t heading;                        // offset: 16
+	uint16_t throttle;                      // offset: 18
+});
+static_assert(sizeof(VFR_HUD) == VFR_HUD::LENGTH, "VFR_HUD wire layout");
+
+/**
+ * @brief COMMAND_INT wire layout
+ */
+MAVPACKED(
+struct COMMAND_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 75;
+	static constexpr size_t LENGTH = 35;
+	static constexpr size_t MIN_LENGTH = 35;
+	static constexpr uint8_t CRC_EXTRA = 158;
+
+	float param1;                           // offset: 0
+	float param2;                           // offset: 4
+	float param3;                           // offset: 8
+	float param4;                           // offset: 12
+	int32_t x;                              // offset: 16
+	int32_t y;                              // offset: 20
+	float z;                                // offset: 24
+	uint16_t command;                       // offset: 28
+	uint8_t target_system;                  // offset: 30
+	uint8_t target_component;               // offset: 31
+	uint8_t frame;                          // offset: 32
+	uint8_t current;                        // offset: 33
+	uint8_t autocontinue;                   // offset: 34
+});
+static_assert(sizeof(COMMAND_INT) == COMMAND_INT::LENGTH, "COMMAND_INT wire layout");
+
+/**
+ * @brief COMMAND_LONG wire layout
+ */
+MAVPACKED(
+struct COMMAND_LONG {
+	static constexpr mavlink::msgid_t MSG_ID = 76;
+	static constexpr size_t LENGTH = 33;
+	static constexpr size_t MIN_LENGTH = 33;
+	static constexpr uint8_t CRC_EXTRA = 152;
+
+	float param1;                           // offset: 0
+	float param2;                           // offset: 4
+	float param3;                           // offset: 8
+	float param4;                           // offset: 12
+	float param5;                           // offset: 16
+	float param6;                           // offset: 20
+	float param7;                           // offset: 24
+	uint16_t command;                       // offset: 28
+	uint8_t target_system;                  // offset: 30
+	uint8_t target_component;               // offset: 31
+	uint8_t confirmation;                   // offset: 32
+});
+static_assert(sizeof(COMMAND_LONG) == COMMAND_LONG::LENGTH, "COMMAND_LONG wire layout");
+
+/**
+ * @brief COMMAND_ACK wire layout
+ */
+MAVPACKED(
+struct COMMAND_ACK {
+	static constexpr mavlink::msgid_t MSG_ID = 77;
+	static constexpr size_t LENGTH = 4;
+	static constexpr size_t MIN_LENGTH = 3;
+	static constexpr uint8_t CRC_EXTRA = 143;
+
+	uint16_t command;                       // offset: 0
+	uint8_t result;                         // offset: 2
+	uint8_t progress;                       // offset: 3
+});
+static_assert(sizeof(COMMAND_ACK) == COMMAND_ACK::LENGTH, "COMMAND_ACK wire layout");
+
+/**
+ * @brief MANUAL_SETPOINT wire layout
+ */
+MAVPACKED(
+struct MANUAL_SETPOINT {
+	static constexpr mavlink::msgid_t MSG_ID = 81;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 106;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float roll;                             // offset: 4
+	float pitch;                            // offset: 8
+	float yaw;                              // offset: 12
+	float thrust;                           // offset: 16
+	uint8_t mode_switch;                    // offset: 20
+	uint8_t manual_override_switch;         // offset: 21
+});
+static_assert(sizeof(MANUAL_SETPOINT) == MANUAL_SETPOINT::LENGTH, "MANUAL_SETPOINT wire layout");
+
+/**
+ * @brief SET_ATTITUDE_TARGET wire layout
+ */
+MAVPACKED(
+struct SET_ATTITUDE_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 82;
+	static constexpr size_t LENGTH = 39;
+	static constexpr size_t MIN_LENGTH = 39;
+	static constexpr uint8_t CRC_EXTRA = 49;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float q[4];                             // offset: 4
+	float body_roll_rate;                   // offset: 20
+	float body_pitch_rate;                  // offset: 24
+	float body_yaw_rate;                    // offset: 28
+	float thrust;                           // offset: 32
+	uint8_t target_system;                  // offset: 36
+	uint8_t target_component;               // offset: 37
+	uint8_t type_mask;                      // offset: 38
+});
+static_assert(sizeof(SET_ATTITUDE_TARGET) == SET_ATTITUDE_TARGET::LENGTH, "SET_ATTITUDE_TARGET wire layout");
+
+/**
+ * @brief ATTITUDE_TARGET wire layout
+ */
+MAVPACKED(
+struct ATTITUDE_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 83;
+	static constexpr size_t LENGTH = 37;
+	static constexpr size_t MIN_LENGTH = 37;
+	static constexpr uint8_t CRC_EXTRA = 22;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float q[4];                             // offset: 4
+	float body_roll_rate;                   // offset: 20
+	float body_pitch_rate;                  // offset: 24
+	float body_yaw_rate;                    // offset: 28
+	float thrust;                           // offset: 32
+	uint8_t type_mask;                      // offset: 36
+});
+static_assert(sizeof(ATTITUDE_TARGET) == ATTITUDE_TARGET::LENGTH, "ATTITUDE_TARGET wire layout");
+
+/**
+ * @brief SET_POSITION_TARGET_LOCAL_NED wire layout
+ */
+MAVPACKED(
+struct SET_POSITION_TARGET_LOCAL_NED {
+	static constexpr mavlink::msgid_t MSG_ID = 84;
+	static constexpr size_t LENGTH = 53;
+	static constexpr size_t MIN_LENGTH = 53;
+	static constexpr uint8_t CRC_EXTRA = 143;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float x;                                // offset: 4
+	float y;                                // offset: 8
+	float z;                                // offset: 12
+	float vx;                               // offset: 16
+	float vy;                               // offset: 20
+	float vz;                               // offset: 24
+	float afx;                              // offset: 28
+	float afy;                              // offset: 32
+	float afz;                              // offset: 36
+	float yaw;                              // offset: 40
+	float yaw_rate;                         // offset: 44
+	uint16_t type_mask;                     // offset: 48
+	uint8_t target_system;                  // offset: 50
+	uint8_t target_component;               // offset: 51
+	uint8_t coordinate_frame;               // offset: 52
+});
+static_assert(sizeof(SET_POSITION_TARGET_LOCAL_NED) == SET_POSITION_TARGET_LOCAL_NED::LENGTH, "SET_POSITION_TARGET_LOCAL_NED wire layout");
+
+/**
+ * @brief POSITION_TARGET_LOCAL_NED wire layout
+ */
+MAVPACKED(
+struct POSITION_TARGET_LOCAL_NED {
+	static constexpr mavlink::msgid_t MSG_ID = 85;
+	static constexpr size_t LENGTH = 51;
+	static constexpr size_t MIN_LENGTH = 51;
+	static constexpr uint8_t CRC_EXTRA = 140;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float x;                                // offset: 4
+	float y;                                // offset: 8
+	float z;                                // offset: 12
+	float vx;                               // offset: 16
+	float vy;                               // offset: 20
+	float vz;                               // offset: 24
+	float afx;                              // offset: 28
+	float afy;                              // offset: 32
+	float afz;                              // offset: 36
+	float yaw;                              // offset: 40
+	float yaw_rate;                         // offset: 44
+	uint16_t type_mask;                     // offset: 48
+	uint8_t coordinate_frame;               // offset: 50
+});
+static_assert(sizeof(POSITION_TARGET_LOCAL_NED) == POSITION_TARGET_LOCAL_NED::LENGTH, "POSITION_TARGET_LOCAL_NED wire layout");
+
+/**
+ * @brief SET_POSITION_TARGET_GLOBAL_INT wire layout
+ */
+MAVPACKED(
+struct SET_POSITION_TARGET_GLOBAL_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 86;
+	static constexpr size_t LENGTH = 53;
+	static constexpr size_t MIN_LENGTH = 53;
+	static constexpr uint8_t CRC_EXTRA = 5;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int32_t lat_int;                        // offset: 4
+	int32_t lon_int;                        // offset: 8
+	float alt;                              // offset: 12
+	float vx;                               // offset: 16
+	float vy;                               // offset: 20
+	float vz;                               // offset: 24
+	float afx;                              // offset: 28
+	float afy;                              // offset: 32
+	float afz;                              // offset: 36
+	float yaw;                              // offset: 40
+	float yaw_rate;                         // offset: 44
+	uint16_t type_mask;                     // offset: 48
+	uint8_t target_system;                  // offset: 50
+	uint8_t target_component;               // offset: 51
+	uint8_t coordinate_frame;               // offset: 52
+});
+static_assert(sizeof(SET_POSITION_TARGET_GLOBAL_INT) == SET_POSITION_TARGET_GLOBAL_INT::LENGTH, "SET_POSITION_TARGET_GLOBAL_INT wire layout");
+
+/**
+ * @brief POSITION_TARGET_GLOBAL_INT wire layout
+ */
+MAVPACKED(
+struct POSITION_TARGET_GLOBAL_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 87;
+	static constexpr size_t LENGTH = 51;
+	static constexpr size_t MIN_LENGTH = 51;
+	static constexpr uint8_t CRC_EXTRA = 150;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int32_t lat_int;                        // offset: 4
+	int32_t lon_int;                        // offset: 8
+	float alt;                              // offset: 12
+	float vx;                               // offset: 16
+	float vy;                               // offset: 20
+	float vz;                               // offset: 24
+	float afx;                              // offset: 28
+	float afy;                              // offset: 32
+	float afz;                              // offset: 36
+	float yaw;                              // offset: 40
+	float yaw_rate;                         // offset: 44
+	uint16_t type_mask;                     // offset: 48
+	uint8_t coordinate_frame;               // offset: 50
+});
+static_assert(sizeof(POSITION_TARGET_GLOBAL_INT) == POSITION_TARGET_GLOBAL_INT::LENGTH, "POSITION_TARGET_GLOBAL_INT wire layout");
+
+/**
+ * @brief LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET wire layout
+ */
+MAVPACKED(
+struct LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET {
+	static constexpr mavlink::msgid_t MSG_ID = 89;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 231;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float x;                                // offset: 4
+	float y;                                // offset: 8
+	float z;                                // offset: 12
+	float roll;                             // offset: 16
+	float pitch;                            // offset: 20
+	float yaw;                              // offset: 24
+});
+static_assert(sizeof(LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET) == LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET::LENGTH, "LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET wire layout");
+
+/**
+ * @brief HIL_STATE wire layout
+ */
+MAVPACKED(
+struct HIL_STATE {
+	static constexpr mavlink::msgid_t MSG_ID = 90;
+	static constexpr size_t LENGTH = 56;
+	static constexpr size_t MIN_LENGTH = 56;
+	static constexpr uint8_t CRC_EXTRA = 183;
+
+	uint64_t time_usec;                     // offset: 0
+	float roll;                             // offset: 8
+	float pitch;                            // offset: 12
+	float yaw;                              // offset: 16
+	float rollspeed;                        // offset: 20
+	float pitchspeed;                       // offset: 24
+	float yawspeed;                         // offset: 28
+	int32_t lat;                            // offset: 32
+	int32_t lon;                            // offset: 36
+	int32_t alt;                            // offset: 40
+	int16_t vx;                             // offset: 44
+	int16_t vy;                             // offset: 46
+	int16_t vz;                             // offset: 48
+	int16_t xacc;                           // offset: 50
+	int16_t yacc;                           // offset: 52
+	int16_t zacc;                           // offset: 54
+});
+static_assert(sizeof(HIL_STATE) == HIL_STATE::LENGTH, "HIL_STATE wire layout");
+
+/**
+ * @brief HIL_CONTROLS wire layout
+ */
+MAVPACKED(
+struct HIL_CONTROLS {
+	static constexpr mavlink::msgid_t MSG_ID = 91;
+	static constexpr size_t LENGTH = 42;
+	static constexpr size_t MIN_LENGTH = 42;
+	static constexpr uint8_t CRC_EXTRA = 63;
+
+	uint64_t time_usec;                     // offset: 0
+	float roll_ailerons;                    // offset: 8
+	float pitch_elevator;                   // offset: 12
+	float yaw_rudder;                       // offset: 16
+	float throttle;                         // offset: 20
+	float aux1;                             // offset: 24
+	float aux2;                             // offset: 28
+	float aux3;                             // offset: 32
+	float aux4;                             // offset: 36
+	uint8_t mode;                           // offset: 40
+	uint8_t nav_mode;                       // offset: 41
+});
+static_assert(sizeof(HIL_CONTROLS) == HIL_CONTROLS::LENGTH, "HIL_CONTROLS wire layout");
+
+/**
+ * @brief HIL_RC_INPUTS_RAW wire layout
+ */
+MAVPACKED(
+struct HIL_RC_INPUTS_RAW {
+	static constexpr mavlink::msgid_t MSG_ID = 92;
+	static constexpr size_t LENGTH = 33;
+	static constexpr size_t MIN_LENGTH = 33;
+	static constexpr uint8_t CRC_EXTRA = 54;
+
+	uint64_t time_usec;                     // offset: 0
+	uint16_t chan1_raw;                     // offset: 8
+	uint16_t chan2_raw;                     // offset: 10
+	uint16_t chan3_raw;                     // offset: 12
+	uint16_t chan4_raw;                     // offset: 14
+	uint16_t chan5_raw;                     // offset: 16
+	uint16_t chan6_raw;                     // offset: 18
+	uint16_t chan7_raw;                     // offset: 20
+	uint16_t chan8_raw;                     // offset: 22
+	uint16_t chan9_raw;                     // offset: 24
+	uint16_t chan10_raw;                    // offset: 26
+	uint16_t chan11_raw;                    // offset: 28
+	uint16_t chan12_raw;                    // offset: 30
+	uint8_t rssi;                           // offset: 32
+});
+static_assert(sizeof(HIL_RC_INPUTS_RAW) == HIL_RC_INPUTS_RAW::LENGTH, "HIL_RC_INPUTS_RAW wire layout");
+
+/**
+ * @brief HIL_ACTUATOR_CONTROLS wire layout
+ */
+MAVPACKED(
+struct HIL_ACTUATOR_CONTROLS {
+	static constexpr mavlink::msgid_t MSG_ID = 93;
+	static constexpr size_t LENGTH = 81;
+	static constexpr size_t MIN_LENGTH = 81;
+	static constexpr uint8_t CRC_EXTRA = 47;
+
+	uint64_t time_usec;                     // offset: 0
+	uint64_t flags;                         // offset: 8
+	float controls[16];                     // offset: 16
+	uint8_t mode;                           // offset: 80
+});
+static_assert(sizeof(HIL_ACTUATOR_CONTROLS) == HIL_ACTUATOR_CONTROLS::LENGTH, "HIL_ACTUATOR_CONTROLS wire layout");
+
+/**
+ * @brief OPTICAL_FLOW wire layout
+ */
+MAVPACKED(
+struct OPTICAL_FLOW {
+	static constexpr mavlink::msgid_t MSG_ID = 100;
+	static constexpr size_t LENGTH = 34;
+	static constexpr size_t MIN_LENGTH = 26;
+	static constexpr uint8_t CRC_EXTRA = 175;
+
+	uint64_t time_usec;                     // offset: 0
+	float flow_comp_m_x;                    // offset: 8
+	float flow_comp_m_y;                    // offset: 12
+	float ground_distance;                  // offset: 16
+	int16_t flow_x;                         // offset: 20
+	int16_t flow_y;                         // offset: 22
+	uint8_t sensor_id;                      // offset: 24
+	uint8_t quality;                        // offset: 25
+	float flow_rate_x;                      // offset: 26
+	float flow_rate_y;                      // offset: 30
+});
+static_assert(sizeof(OPTICAL_FLOW) == OPTICAL_FLOW::LENGTH, "OPTICAL_FLOW wire layout");
+
+/**
+ * @brief GLOBAL_VISION_POSITION_ESTIMATE wire layout
+ */
+MAVPACKED(
+struct GLOBAL_VISION_POSITION_ESTIMATE {
+	static constexpr mavlink::msgid_t MSG_ID = 101;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 102;
+
+	uint64_t usec;                          // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+	float roll;                             // offset: 20
+	float pitch;                            // offset: 24
+	float yaw;                              // offset: 28
+});
+static_assert(sizeof(GLOBAL_VISION_POSITION_ESTIMATE) == GLOBAL_VISION_POSITION_ESTIMATE::LENGTH, "GLOBAL_VISION_POSITION_ESTIMATE wire layout");
+
+/**
+ * @brief VISION_POSITION_ESTIMATE wire layout
+ */
+MAVPACKED(
+struct VISION_POSITION_ESTIMATE {
+	static constexpr mavlink::msgid_t MSG_ID = 102;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 158;
+
+	uint64_t usec;                          // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+	float roll;                             // offset: 20
+	float pitch;                            // offset: 24
+	float yaw;                              // offset: 28
+});
+static_assert(sizeof(VISION_POSITION_ESTIMATE) == VISION_POSITION_ESTIMATE::LENGTH, "VISION_POSITION_ESTIMATE wire layout");
+
+/**
+ * @brief VISION_SPEED_ESTIMATE wire layout
+ */
+MAVPACKED(
+struct VISION_SPEED_ESTIMATE {
+	static constexpr mavlink::msgid_t MSG_ID = 103;
+	static constexpr size_t LENGTH = 20;
+	static constexpr size_t MIN_LENGTH = 20;
+	static constexpr uint8_t CRC_EXTRA = 208;
+
+	uint64_t usec;                          // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+});
+static_assert(sizeof(VISION_SPEED_ESTIMATE) == VISION_SPEED_ESTIMATE::LENGTH, "VISION_SPEED_ESTIMATE wire layout");
+
+/**
+ * @brief VICON_POSITION_ESTIMATE wire layout
+ */
+MAVPACKED(
+struct VICON_POSITION_ESTIMATE {
+	static constexpr mavlink::msgid_t MSG_ID = 104;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 56;
+
+	uint64_t usec;                          // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+	float roll;                             // offset: 20
+	float pitch;                            // offset: 24
+	float yaw;                              // offset: 28
+});
+static_assert(sizeof(VICON_POSITION_ESTIMATE) == VICON_POSITION_ESTIMATE::LENGTH, "VICON_POSITION_ESTIMATE wire layout");
+
+/**
+ * @brief HIGHRES_IMU wire layout
+ */
+MAVPACKED(
+struct HIGHRES_IMU {
+	static constexpr mavlink::msgid_t MSG_ID = 105;
+	static constexpr size_t LENGTH = 62;
+	static constexpr size_t MIN_LENGTH = 62;
+	static constexpr uint8_t CRC_EXTRA = 93;
+
+	uint64_t time_usec;                     // offset: 0
+	float xacc;                             // offset: 8
+	float yacc;                             // offset: 12
+	float zacc;                             // offset: 16
+	float xgyro;                            // offset: 20
+	float ygyro;                            // offset: 24
+	float zgyro;                            // offset: 28
+	float xmag;                             // offset: 32
+	float ymag;                             // offset: 36
+	float zmag;                             // offset: 40
+	float abs_pressure;                     // offset: 44
+	float diff_pressure;                    // offset: 48
+	float pressure_alt;                     // offset: 52
+	float temperature;                      // offset: 56
+	uint16_t fields_updated;                // offset: 60
+});
+static_assert(sizeof(HIGHRES_IMU) == HIGHRES_IMU::LENGTH, "HIGHRES_IMU wire layout");
+
+/**
+ * @brief OPTICAL_FLOW_RAD wire layout
+ */
+MAVPACKED(
+struct OPTICAL_FLOW_RAD {
+	static constexpr mavlink::msgid_t MSG_ID = 106;
+	static constexpr size_t LENGTH = 44;
+	static constexpr size_t MIN_LENGTH = 44;
+	static constexpr uint8_t CRC_EXTRA = 138;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t integration_time_us;           // offset: 8
+	float integrated_x;                     // offset: 12
+	float integrated_y;                     // offset: 16
+	float integrated_xgyro;                 // offset: 20
+	float integrated_ygyro;                 // offset: 24
+	float integrated_zgyro;                 // offset: 28
+	uint32_t time_delta_distance_us;        // offset: 32
+	float distance;                         // offset: 36
+	int16_t temperature;                    // offset: 40
+	uint8_t sensor_id;                      // offset: 42
+	uint8_t quality;                        // offset: 43
+});
+static_assert(sizeof(OPTICAL_FLOW_RAD) == OPTICAL_FLOW_RAD::LENGTH, "OPTICAL_FLOW_RAD wire layout");
+
+/**
+ * @brief HIL_SENSOR wire layout
+ */
+MAVPACKED(
+struct HIL_SENSOR {
+	static constexpr mavlink::msgid_t MSG_ID = 107;
+	static constexpr size_t LENGTH = 64;
+	static constexpr size_t MIN_LENGTH = 64;
+	static constexpr uint8_t CRC_EXTRA = 108;
+
+	uint64_t time_usec;                     // offset: 0
+	float xacc;                             // offset: 8
+	float yacc;                             // offset: 12
+	float zacc;                             // offset: 16
+	float xgyro;                            // offset: 20
+	float ygyro;                            // offset: 24
+	float zgyro;                            // offset: 28
+	float xmag;                             // offset: 32
+	float ymag;                             // offset: 36
+	float zmag;                             // offset: 40
+	float abs_pressure;                     // offset: 44
+	float diff_pressure;                    // offset: 48
+	float pressure_alt;                     // offset: 52
+	float temperature;                      // offset: 56
+	uint32_t fields_updated;                // offset: 60
+});
+static_assert(sizeof(HIL_SENSOR) == HIL_SENSOR::LENGTH, "HIL_SENSOR wire layout");
+
+/**
+ * @brief SIM_STATE wire layout
+ */
+MAVPACKED(
+struct SIM_STATE {
+	static constexpr mavlink::msgid_t MSG_ID = 108;
+	static constexpr size_t LENGTH = 84;
+	static constexpr size_t MIN_LENGTH = 84;
+	static constexpr uint8_t CRC_EXTRA = 32;
+
+	float q1;                               // offset: 0
+	float q2;                               // offset: 4
+	float q3;                               // offset: 8
+	float q4;                               // offset: 12
+	float roll;                             // offset: 16
+	float pitch;                            // offset: 20
+	float yaw;                              // offset: 24
+	float xacc;                             // offset: 28
+	float yacc;                             // offset: 32
+	float zacc;                             // offset: 36
+	float xgyro;                            // offset: 40
+	float ygyro;                            // offset: 44
+	float zgyro;                            // offset: 48
+	float lat;                              // offset: 52
+	float lon;                              // offset: 56
+	float alt;                              // offset: 60
+	float std_dev_horz;                     // offset: 64
+	float std_dev_vert;                     // offset: 68
+	float vn;                               // offset: 72
+	float ve;                               // offset: 76
+	float vd;                               // offset: 80
+});
+static_assert(sizeof(SIM_STATE) == SIM_STATE::LENGTH, "SIM_STATE wire layout");
+
+/**
+ * @brief RADIO_STATUS wire layout
+ */
+MAVPACKED(
+struct RADIO_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 109;
+	static constexpr size_t LENGTH = 9;
+	static constexpr size_t MIN_LENGTH = 9;
+	static constexpr uint8_t CRC_EXTRA = 185;
+
+	uint16_t rxerrors;                      // offset: 0
+	uint16_t fixed;                         // offset: 2
+	uint8_t rssi;                           // offset: 4
+	uint8_t remrssi;                        // offset: 5
+	uint8_t txbuf;                          // offset: 6
+	uint8_t noise;                          // offset: 7
+	uint8_t remnoise;                       // offset: 8
+});
+static_assert(sizeof(RADIO_STATUS) == RADIO_STATUS::LENGTH, "RADIO_STATUS wire layout");
+
+/**
+ * @brief FILE_TRANSFER_PROTOCOL wire layout
+ */
+MAVPACKED(
+struct FILE_TRANSFER_PROTOCOL {
+	static constexpr mavlink::msgid_t MSG_ID = 110;
+	static constexpr size_t LENGTH = 254;
+	static constexpr size_t MIN_LENGTH = 254;
+	static constexpr uint8_t CRC_EXTRA = 84;
+
+	uint8_t target_network;                 // offset: 0
+	uint8_t target_system;                  // offset: 1
+	uint8_t target_component;               // offset: 2
+	uint8_t payload[251];                   // offset: 3
+});
+static_assert(sizeof(FILE_TRANSFER_PROTOCOL) == FILE_TRANSFER_PROTOCOL::LENGTH, "FILE_TRANSFER_PROTOCOL wire layout");
+
+/**
+ * @brief TIMESYNC wire layout
+ */
+MAVPACKED(
+struct TIMESYNC {
+	static constexpr mavlink::msgid_t MSG_ID = 111;
+	static constexpr size_t LENGTH = 16;
+	static constexpr size_t MIN_LENGTH = 16;
+	static constexpr uint8_t CRC_EXTRA = 34;
+
+	int64_t tc1;                            // offset: 0
+	int64_t ts1;                            // offset: 8
+});
+static_assert(sizeof(TIMESYNC) == TIMESYNC::LENGTH, "TIMESYNC wire layout");
+
+/**
+ * @brief CAMERA_TRIGGER wire layout
+ */
+MAVPACKED(
+struct CAMERA_TRIGGER {
+	static constexpr mavlink::msgid_t MSG_ID = 112;
+	static constexpr size_t LENGTH = 12;
+	static constexpr size_t MIN_LENGTH = 12;
+	static constexpr uint8_t CRC_EXTRA = 174;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t seq;                           // offset: 8
+});
+static_assert(sizeof(CAMERA_TRIGGER) == CAMERA_TRIGGER::LENGTH, "CAMERA_TRIGGER wire layout");
+
+/**
+ * @brief HIL_GPS wire layout
+ */
+MAVPACKED(
+struct HIL_GPS {
+	static constexpr mavlink::msgid_t MSG_ID = 113;
+	static constexpr size_t LENGTH = 36;
+	static constexpr size_t MIN_LENGTH = 36;
+	static constexpr uint8_t CRC_EXTRA = 124;
+
+	uint64_t time_usec;                     // offset: 0
+	int32_t lat;                            // offset: 8
+	int32_t lon;                            // offset: 12
+	int32_t alt;                            // offset: 16
+	uint16_t eph;                           // offset: 20
+	uint16_t epv;                           // offset: 22
+	uint16_t vel;                           // offset: 24
+	int16_t vn;                             // offset: 26
+	int16_t ve;                             // offset: 28
+	int16_t vd;                             // offset: 30
+	uint16_t cog;                           // offset: 32
+	uint8_t fix_type;                       // offset: 34
+	uint8_t satellites_visible;             // offset: 35
+});
+static_assert(sizeof(HIL_GPS) == HIL_GPS::LENGTH, "HIL_GPS wire layout");
+
+/**
+ * @brief HIL_OPTICAL_FLOW wire layout
+ */
+MAVPACKED(
+struct HIL_OPTICAL_FLOW {
+	static constexpr mavlink::msgid_t MSG_ID = 114;
+	static constexpr size_t LENGTH = 44;
+	static constexpr size_t MIN_LENGTH = 44;
+	static constexpr uint8_t CRC_EXTRA = 237;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t integration_time_us;           // offset: 8
+	float integrated_x;                     // offset: 12
+	float integrated_y;                     // offset: 16
+	float integrated_xgyro;                 // offset: 20
+	float integrated_ygyro;                 // offset: 24
+	float integrated_zgyro;                 // offset: 28
+	uint32_t time_delta_distance_us;        // offset: 32
+	float distance;                         // offset: 36
+	int16_t temperature;                    // offset: 40
+	uint8_t sensor_id;                      // offset: 42
+	uint8_t quality;                        // offset: 43
+});
+static_assert(sizeof(HIL_OPTICAL_FLOW) == HIL_OPTICAL_FLOW::LENGTH, "HIL_OPTICAL_FLOW wire layout");
+
+/**
+ * @brief HIL_STATE_QUATERNION wire layout
+ */
+MAVPACKED(
+struct HIL_STATE_QUATERNION {
+	static constexpr mavlink::msgid_t MSG_ID = 115;
+	static constexpr size_t LENGTH = 64;
+	static constexpr size_t MIN_LENGTH = 64;
+	static constexpr uint8_t CRC_EXTRA = 4;
+
+	uint64_t time_usec;                     // offset: 0
+	float attitude_quaternion[4];           // offset: 8
+	float rollspeed;                        // offset: 24
+	float pitchspeed;                       // offset: 28
+	float yawspeed;                         // offset: 32
+	int32_t lat;                            // offset: 36
+	int32_t lon;                            // offset: 40
+	int32_t alt;                            // offset: 44
+	int16_t vx;                             // offset: 48
+	int16_t vy;                             // offset: 50
+	int16_t vz;                             // offset: 52
+	uint16_t ind_airspeed;                  // offset: 54
+	uint16_t true_airspeed;                 // offset: 56
+	int16_t xacc;                           // offset: 58
+	int16_t yacc;                           // offset: 60
+	int16_t zacc;                           // offset: 62
+});
+static_assert(sizeof(HIL_STATE_QUATERNION) == HIL_STATE_QUATERNION::LENGTH, "HIL_STATE_QUATERNION wire layout");
+
+/**
+ * @brief SCALED_IMU2 wire layout
+ */
+MAVPACKED(
+struct SCALED_IMU2 {
+	static constexpr mavlink::msgid_t MSG_ID = 116;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 76;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int16_t xacc;                           // offset: 4
+	int16_t yacc;                           // offset: 6
+	int16_t zacc;                           // offset: 8
+	int16_t xgyro;                          // offset: 10
+	int16_t ygyro;                          // offset: 12
+	int16_t zgyro;                          // offset: 14
+	int16_t xmag;                           // offset: 16
+	int16_t ymag;                           // offset: 18
+	int16_t zmag;                           // offset: 20
+});
+static_assert(sizeof(SCALED_IMU2) == SCALED_IMU2::LENGTH, "SCALED_IMU2 wire layout");
+
+/**
+ * @brief LOG_REQUEST_LIST wire layout
+ */
+MAVPACKED(
+struct LOG_REQUEST_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 117;
+	static constexpr size_t LENGTH = 6;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 128;
+
+	uint16_t start;                         // offset: 0
+	uint16_t end;                           // offset: 2
+	uint8_t target_system;                  // offset: 4
+	uint8_t target_component;               // offset: 5
+});
+static_assert(sizeof(LOG_REQUEST_LIST) == LOG_REQUEST_LIST::LENGTH, "LOG_REQUEST_LIST wire layout");
+
+/**
+ * @brief LOG_ENTRY wire layout
+ */
+MAVPACKED(
+struct LOG_ENTRY {
+	static constexpr mavlink::msgid_t MSG_ID = 118;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 56;
+
+	uint32_t time_utc;                      // offset: 0
+	uint32_t size;                          // offset: 4
+	uint16_t id;                            // offset: 8
+	uint16_t num_logs;                      // offset: 10
+	uint16_t last_log_num;                  // offset: 12
+});
+static_assert(sizeof(LOG_ENTRY) == LOG_ENTRY::LENGTH, "LOG_ENTRY wire layout");
+
+/**
+ * @brief LOG_REQUEST_DATA wire layout
+ */
+MAVPACKED(
+struct LOG_REQUEST_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 119;
+	static constexpr size_t LENGTH = 12;
+	static constexpr size_t MIN_LENGTH = 12;
+	static constexpr uint8_t CRC_EXTRA = 116;
+
+	uint32_t ofs;                           // offset: 0
+	uint32_t count;                         // offset: 4
+	uint16_t id;                            // offset: 8
+	uint8_t target_system;                  // offset: 10
+	uint8_t target_component;               // offset: 11
+});
+static_assert(sizeof(LOG_REQUEST_DATA) == LOG_REQUEST_DATA::LENGTH, "LOG_REQUEST_DATA wire layout");
+
+/**
+ * @brief LOG_DATA wire layout
+ */
+MAVPACKED(
+struct LOG_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 120;
+	static constexpr size_t LENGTH = 97;
+	static constexpr size_t MIN_LENGTH = 97;
+	static constexpr uint8_t CRC_EXTRA = 134;
+
+	uint32_t ofs;                           // offset: 0
+	uint16_t id;                            // offset: 4
+	uint8_t count;                          // offset: 6
+	uint8_t data[90];                       // offset: 7
+});
+static_assert(sizeof(LOG_DATA) == LOG_DATA::LENGTH, "LOG_DATA wire layout");
+
+/**
+ * @brief LOG_ERASE wire layout
+ */
+MAVPACKED(
+struct LOG_ERASE {
+	static constexpr mavlink::msgid_t MSG_ID = 121;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 237;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+});
+static_assert(sizeof(LOG_ERASE) == LOG_ERASE::LENGTH, "LOG_ERASE wire layout");
+
+/**
+ * @brief LOG_REQUEST_END wire layout
+ */
+MAVPACKED(
+struct LOG_REQUEST_END {
+	static constexpr mavlink::msgid_t MSG_ID = 122;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 203;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+});
+static_assert(sizeof(LOG_REQUEST_END) == LOG_REQUEST_END::LENGTH, "LOG_REQUEST_END wire layout");
+
+/**
+ * @brief GPS_INJECT_DATA wire layout
+ */
+MAVPACKED(
+struct GPS_INJECT_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 123;
+	static constexpr size_t LENGTH = 113;
+	static constexpr size_t MIN_LENGTH = 113;
+	static constexpr uint8_t CRC_EXTRA = 250;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	uint8_t len;                            // offset: 2
+	uint8_t data[110];                      // offset: 3
+});
+static_assert(sizeof(GPS_INJECT_DATA) == GPS_INJECT_DATA::LENGTH, "GPS_INJECT_DATA wire layout");
+
+/**
+ * @brief GPS2_RAW wire layout
+ */
+MAVPACKED(
+struct GPS2_RAW {
+	static constexpr mavlink::msgid_t MSG_ID = 124;
+	static constexpr size_t LENGTH = 35;
+	static constexpr size_t MIN_LENGTH = 35;
+	static constexpr uint8_t CRC_EXTRA = 87;
+
+	uint64_t time_usec;                     // offset: 0
+	int32_t lat;                            // offset: 8
+	int32_t lon;                            // offset: 12
+	int32_t alt;                            // offset: 16
+	uint32_t dgps_age;                      // offset: 20
+	uint16_t eph;                           // offset: 24
+	uint16_t epv;                           // offset: 26
+	uint16_t vel;                           // offset: 28
+	uint16_t cog;                           // offset: 30
+	uint8_t fix_type;                       // offset: 32
+	uint8_t satellites_visible;             // offset: 33
+	uint8_t dgps_numch;                     // offset: 34
+});
+static_assert(sizeof(GPS2_RAW) == GPS2_RAW::LENGTH, "GPS2_RAW wire layout");
+
+/**
+ * @brief POWER_STATUS wire layout
+ */
+MAVPACKED(
+struct POWER_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 125;
+	static constexpr size_t LENGTH = 6;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 203;
+
+	uint16_t Vcc;                           // offset: 0
+	uint16_t Vservo;                        // offset: 2
+	uint16_t flags;                         // offset: 4
+});
+static_assert(sizeof(POWER_STATUS) == POWER_STATUS::LENGTH, "POWER_STATUS wire layout");
+
+/**
+ * @brief SERIAL_CONTROL wire layout
+ */
+MAVPACKED(
+struct SERIAL_CONTROL {
+	static constexpr mavlink::msgid_t MSG_ID = 126;
+	static constexpr size_t LENGTH = 79;
+	static constexpr size_t MIN_LENGTH = 79;
+	static constexpr uint8_t CRC_EXTRA = 220;
+
+	uint32_t baudrate;                      // offset: 0
+	uint16_t timeout;                       // offset: 4
+	uint8_t device;                         // offset: 6
+	uint8_t flags;                          // offset: 7
+	uint8_t count;                          // offset: 8
+	uint8_t data[70];                       // offset: 9
+});
+static_assert(sizeof(SERIAL_CONTROL) == SERIAL_CONTROL::LENGTH, "SERIAL_CONTROL wire layout");
+
+/**
+ * @brief GPS_RTK wire layout
+ */
+MAVPACKED(
+struct GPS_RTK {
+	static constexpr mavlink::msgid_t MSG_ID = 127;
+	static constexpr size_t LENGTH = 35;
+	static constexpr size_t MIN_LENGTH = 35;
+	static constexpr uint8_t CRC_EXTRA = 25;
+
+	uint32_t time_last_baseline_ms;         // offset: 0
+	uint32_t tow;                           // offset: 4
+	int32_t baseline_a_mm;                  // offset: 8
+	int32_t baseline_b_mm;                  // offset: 12
+	int32_t baseline_c_mm;                  // offset: 16
+	uint32_t accuracy;                      // offset: 20
+	int32_t iar_num_hypotheses;             // offset: 24
+	uint16_t wn;                            // offset: 28
+	uint8_t rtk_receiver_id;                // offset: 30
+	uint8_t rtk_health;                     // offset: 31
+	uint8_t rtk_rate;                       // offset: 32
+	uint8_t nsats;                          // offset: 33
+	uint8_t baseline_coords_type;           // offset: 34
+});
+static_assert(sizeof(GPS_RTK) == GPS_RTK::LENGTH, "GPS_RTK wire layout");
+
+/**
+ * @brief GPS2_RTK wire layout
+ */
+MAVPACKED(
+struct GPS2_RTK {
+	static constexpr mavlink::msgid_t MSG_ID = 128;
+	static constexpr size_t LENGTH = 35;
+	static constexpr size_t MIN_LENGTH = 35;
+	static constexpr uint8_t CRC_EXTRA = 226;
+
+	uint32_t time_last_baseline_ms;         // offset: 0
+	uint32_t tow;                           // offset: 4
+	int32_t baseline_a_mm;                  // offset: 8
+	int32_t baseline_b_mm;                  // offset: 12
+	int32_t baseline_c_mm;                  // offset: 16
+	uint32_t accuracy;                      // offset: 20
+	int32_t iar_num_hypotheses;             // offset: 24
+	uint16_t wn;                            // offset: 28
+	uint8_t rtk_receiver_id;                // offset: 30
+	uint8_t rtk_health;                     // offset: 31
+	uint8_t rtk_rate;                       // offset: 32
+	uint8_t nsats;                          // offset: 33
+	uint8_t baseline_coords_type;           // offset: 34
+});
+static_assert(sizeof(GPS2_RTK) == GPS2_RTK::LENGTH, "GPS2_RTK wire layout");
+
+/**
+ * @brief SCALED_IMU3 wire layout
+ */
+MAVPACKED(
+struct SCALED_IMU3 {
+	static constexpr mavlink::msgid_t MSG_ID = 129;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 46;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int16_t xacc;                           // offset: 4
+	int16_t yacc;                           // offset: 6
+	int16_t zacc;                           // offset: 8
+	int16_t xgyro;                          // offset: 10
+	int16_t ygyro;                          // offset: 12
+	int16_t zgyro;                          // offset: 14
+	int16_t xmag;                           // offset: 16
+	int16_t ymag;                           // offset: 18
+	int16_t zmag;                           // offset: 20
+});
+static_assert(sizeof(SCALED_IMU3) == SCALED_IMU3::LENGTH, "SCALED_IMU3 wire layout");
+
+/**
+ * @brief DATA_TRANSMISSION_HANDSHAKE wire layout
+ */
+MAVPACKED(
+struct DATA_TRANSMISSION_HANDSHAKE {
+	static constexpr mavlink::msgid_t MSG_ID = 130;
+	static constexpr size_t LENGTH = 13;
+	static constexpr size_t MIN_LENGTH = 13;
+	static constexpr uint8_t CRC_EXTRA = 29;
+
+	uint32_t size;                          // offset: 0
+	uint16_t width;                         // offset: 4
+	uint16_t height;                        // offset: 6
+	uint16_t packets;                       // offset: 8
+	uint8_t type;                           // offset: 10
+	uint8_t payload;                        // offset: 11
+	uint8_t jpg_quality;                    // offset: 12
+});
+static_assert(sizeof(DATA_TRANSMISSION_HANDSHAKE) == DATA_TRANSMISSION_HANDSHAKE::LENGTH, "DATA_TRANSMISSION_HANDSHAKE wire layout");
+
+/**
+ * @brief ENCAPSULATED_DATA wire layout
+ */
+MAVPACKED(
+struct ENCAPSULATED_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 131;
+	static constexpr size_t LENGTH = 255;
+	static constexpr size_t MIN_LENGTH = 255;
+	static constexpr uint8_t CRC_EXTRA = 223;
+
+	uint16_t seqnr;                         // offset: 0
+	uint8_t data[253];                      // offset: 2
+});
+static_assert(sizeof(ENCAPSULATED_DATA) == ENCAPSULATED_DATA::LENGTH, "ENCAPSULATED_DATA wire layout");
+
+/**
+ * @brief DISTANCE_SENSOR wire layout
+ */
+MAVPACKED(
+struct DISTANCE_SENSOR {
+	static constexpr mavlink::msgid_t MSG_ID = 132;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 85;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint16_t min_distance;                  // offset: 4
+	uint16_t max_distance;                  // offset: 6
+	uint16_t current_distance;              // offset: 8
+	uint8_t type;                           // offset: 10
+	uint8_t id;                             // offset: 11
+	uint8_t orientation;                    // offset: 12
+	uint8_t covariance;                     // offset: 13
+});
+static_assert(sizeof(DISTANCE_SENSOR) == DISTANCE_SENSOR::LENGTH, "DISTANCE_SENSOR wire layout");
+
+/**
+ * @brief TERRAIN_REQUEST wire layout
+ */
+MAVPACKED(
+struct TERRAIN_REQUEST {
+	static constexpr mavlink::msgid_t MSG_ID = 133;
+	static constexpr size_t LENGTH = 18;
+	static constexpr size_t MIN_LENGTH = 18;
+	static constexpr uint8_t CRC_EXTRA = 6;
+
+	uint64_t mask;                          // offset: 0
+	int32_t lat;                            // offset: 8
+	int32_t lon;                            // offset: 12
+	uint16_t grid_spacing;                  // offset: 16
+});
+static_assert(sizeof(TERRAIN_REQUEST) == TERRAIN_REQUEST::LENGTH, "TERRAIN_REQUEST wire layout");
+
+/**
+ * @brief TERRAIN_DATA wire layout
+ */
+MAVPACKED(
+struct TERRAIN_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 134;
+	static constexpr size_t LENGTH = 43;
+	static constexpr size_t MIN_LENGTH = 43;
+	static constexpr uint8_t CRC_EXTRA = 229;
+
+	int32_t lat;                            // offset: 0
+	int32_t lon;                            // offset: 4
+	uint16_t grid_spacing;                  // offset: 8
+	int16_t data[16];                       // offset: 10
+	uint8_t gridbit;                        // offset: 42
+});
+static_assert(sizeof(TERRAIN_DATA) == TERRAIN_DATA::LENGTH, "TERRAIN_DATA wire layout");
+
+/**
+ * @brief TERRAIN_CHECK wire layout
+ */
+MAVPACKED(
+struct TERRAIN_CHECK {
+	static constexpr mavlink::msgid_t MSG_ID = 135;
+	static constexpr size_t LENGTH = 8;
+	static constexpr size_t MIN_LENGTH = 8;
+	static constexpr uint8_t CRC_EXTRA = 203;
+
+	int32_t lat;                            // offset: 0
+	int32_t lon;                            // offset: 4
+});
+static_assert(sizeof(TERRAIN_CHECK) == TERRAIN_CHECK::LENGTH, "TERRAIN_CHECK wire layout");
+
+/**
+ * @brief TERRAIN_REPORT wire layout
+ */
+MAVPACKED(
+struct TERRAIN_REPORT {
+	static constexpr mavlink::msgid_t MSG_ID = 136;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 1;
+
+	int32_t lat;                            // offset: 0
+	int32_t lon;                            // offset: 4
+	float terrain_height;                   // offset: 8
+	float current_height;                   // offset: 12
+	uint16_t spacing;                       // offset: 16
+	uint16_t pending;                       // offset: 18
+	uint16_t loaded;                        // offset: 20
+});
+static_assert(sizeof(TERRAIN_REPORT) == TERRAIN_REPORT::LENGTH, "TERRAIN_REPORT wire layout");
+
+/**
+ * @brief SCALED_PRESSURE2 wire layout
+ */
+MAVPACKED(
+struct SCALED_PRESSURE2 {
+	static constexpr mavlink::msgid_t MSG_ID = 137;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 195;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float press_abs;                        // offset: 4
+	float press_diff;                       // offset: 8
+	int16_t temperature;                    // offset: 12
+});
+static_assert(sizeof(SCALED_PRESSURE2) == SCALED_PRESSURE2::LENGTH, "SCALED_PRESSURE2 wire layout");
+
+/**
+ * @brief ATT_POS_MOCAP wire layout
+ */
+MAVPACKED(
+struct ATT_POS_MOCAP {
+	static constexpr mavlink::msgid_t MSG_ID = 138;
+	static constexpr size_t LENGTH = 36;
+	static constexpr size_t MIN_LENGTH = 36;
+	static constexpr uint8_t CRC_EXTRA = 109;
+
+	uint64_t time_usec;                     // offset: 0
+	float q[4];                             // offset: 8
+	float x;                                // offset: 24
+	float y;                                // offset: 28
+	float z;                                // offset: 32
+});
+static_assert(sizeof(ATT_POS_MOCAP) == ATT_POS_MOCAP::LENGTH, "ATT_POS_MOCAP wire layout");
+
+/**
+ * @brief SET_ACTUATOR_CONTROL_TARGET wire layout
+ */
+MAVPACKED(
+struct SET_ACTUATOR_CONTROL_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 139;
+	static constexpr size_t LENGTH = 43;
+	static constexpr size_t MIN_LENGTH = 43;
+	static constexpr uint8_t CRC_EXTRA = 168;
+
+	uint64_t time_usec;                     // offset: 0
+	float controls[8];                      // offset: 8
+	uint8_t group_mlx;                      // offset: 40
+	uint8_t target_system;                  // offset: 41
+	uint8_t target_component;               // offset: 42
+});
+static_assert(sizeof(SET_ACTUATOR_CONTROL_TARGET) == SET_ACTUATOR_CONTROL_TARGET::LENGTH, "SET_ACTUATOR_CONTROL_TARGET wire layout");
+
+/**
+ * @brief ACTUATOR_CONTROL_TARGET wire layout
+ */
+MAVPACKED(
+struct ACTUATOR_CONTROL_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 140;
+	static constexpr size_t LENGTH = 41;
+	static constexpr size_t MIN_LENGTH = 41;
+	static constexpr uint8_t CRC_EXTRA = 181;
+
+	uint64_t time_usec;                     // offset: 0
+	float controls[8];                      // offset: 8
+	uint8_t group_mlx;                      // offset: 40
+});
+static_assert(sizeof(ACTUATOR_CONTROL_TARGET) == ACTUATOR_CONTROL_TARGET::LENGTH, "ACTUATOR_CONTROL_TARGET wire layout");
+
+/**
+ * @brief ALTITUDE wire layout
+ */
+MAVPACKED(
+struct ALTITUDE {
+	static constexpr mavlink::msgid_t MSG_ID = 141;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 47;
+
+	uint64_t time_usec;                     // offset: 0
+	float altitude_monotonic;               // offset: 8
+	float altitude_amsl;                    // offset: 12
+	float altitude_local;                   // offset: 16
+	float altitude_relative;                // offset: 20
+	float altitude_terrain;                 // offset: 24
+	float bottom_clearance;                 // offset: 28
+});
+static_assert(sizeof(ALTITUDE) == ALTITUDE::LENGTH, "ALTITUDE wire layout");
+
+/**
+ * @brief RESOURCE_REQUEST wire layout
+ */
+MAVPACKED(
+struct RESOURCE_REQUEST {
+	static constexpr mavlink::msgid_t MSG_ID = 142;
+	static constexpr size_t LENGTH = 243;
+	static constexpr size_t MIN_LENGTH = 243;
+	static constexpr uint8_t CRC_EXTRA = 72;
+
+	uint8_t request_id;                     // offset: 0
+	uint8_t uri_type;                       // offset: 1
+	uint8_t uri[120];                       // offset: 2
+	uint8_t transfer_type;                  // offset: 122
+	uint8_t storage[120];                   // offset: 123
+});
+static_assert(sizeof(RESOURCE_REQUEST) == RESOURCE_REQUEST::LENGTH, "RESOURCE_REQUEST wire layout");
+
+/**
+ * @brief SCALED_PRESSURE3 wire layout
+ */
+MAVPACKED(
+struct SCALED_PRESSURE3 {
+	static constexpr mavlink::msgid_t MSG_ID = 143;
+	static constexpr size_t LENGTH = 14;
+	static constexpr size_t MIN_LENGTH = 14;
+	static constexpr uint8_t CRC_EXTRA = 131;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float press_abs;                        // offset: 4
+	float press_diff;                       // offset: 8
+	int16_t temperature;                    // offset: 12
+});
+static_assert(sizeof(SCALED_PRESSURE3) == SCALED_PRESSURE3::LENGTH, "SCALED_PRESSURE3 wire layout");
+
+/**
+ * @brief FOLLOW_TARGET wire layout
+ */
+MAVPACKED(
+struct FOLLOW_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 144;
+	static constexpr size_t LENGTH = 93;
+	static constexpr size_t MIN_LENGTH = 93;
+	static constexpr uint8_t CRC_EXTRA = 127;
+
+	uint64_t timestamp;                     // offset: 0
+	uint64_t custom_state;                  // offset: 8
+	int32_t lat;                            // offset: 16
+	int32_t lon;                            // offset: 20
+	float alt;                              // offset: 24
+	float vel[3];                           // offset: 28
+	float acc[3];                           // offset: 40
+	float attitude_q[4];                    // offset: 52
+	float rates[3];                         // offset: 68
+	float position_cov[3];                  // offset: 80
+	uint8_t est_capabilities;               // offset: 92
+});
+static_assert(sizeof(FOLLOW_TARGET) == FOLLOW_TARGET::LENGTH, "FOLLOW_TARGET wire layout");
+
+/**
+ * @brief CONTROL_SYSTEM_STATE wire layout
+ */
+MAVPACKED(
+struct CONTROL_SYSTEM_STATE {
+	static constexpr mavlink::msgid_t MSG_ID = 146;
+	static constexpr size_t LENGTH = 100;
+	static constexpr size_t MIN_LENGTH = 100;
+	static constexpr uint8_t CRC_EXTRA = 103;
+
+	uint64_t time_usec;                     // offset: 0
+	float x_acc;                            // offset: 8
+	float y_acc;                            // offset: 12
+	float z_acc;                            // offset: 16
+	float x_vel;                            // offset: 20
+	float y_vel;                            // offset: 24
+	float z_vel;                            // offset: 28
+	float x_pos;                            // offset: 32
+	float y_pos;                            // offset: 36
+	float z_pos;                            // offset: 40
+	float airspeed;                         // offset: 44
+	float vel_variance[3];                  // offset: 48
+	float pos_variance[3];                  // offset: 60
+	float q[4];                             // offset: 72
+	float roll_rate;                        // offset: 88
+	float pitch_rate;                       // offset: 92
+	float yaw_rate;                         // offset: 96
+});
+static_assert(sizeof(CONTROL_SYSTEM_STATE) == CONTROL_SYSTEM_STATE::LENGTH, "CONTROL_SYSTEM_STATE wire layout");
+
+/**
+ * @brief BATTERY_STATUS wire layout
+ */
+MAVPACKED(
+struct BATTERY_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 147;
+	static constexpr size_t LENGTH = 36;
+	static constexpr size_t MIN_LENGTH = 36;
+	static constexpr uint8_t CRC_EXTRA = 154;
+
+	int32_t current_consumed;               // offset: 0
+	int32_t energy_consumed;                // offset: 4
+	int16_t temperature;                    // offset: 8
+	uint16_t voltages[10];                  // offset: 10
+	int16_t current_battery;                // offset: 30
+	uint8_t id;                             // offset: 32
+	uint8_t battery_function;               // offset: 33
+	uint8_t type;                           // offset: 34
+	int8_t battery_remaining;               // offset: 35
+});
+static_assert(sizeof(BATTERY_STATUS) == BATTERY_STATUS::LENGTH, "BATTERY_STATUS wire layout");
+
+/**
+ * @brief AUTOPILOT_VERSION wire layout
+ */
+MAVPACKED(
+struct AUTOPILOT_VERSION {
+	static constexpr mavlink::msgid_t MSG_ID = 148;
+	static constexpr size_t LENGTH = 60;
+	static constexpr size_t MIN_LENGTH = 60;
+	static constexpr uint8_t CRC_EXTRA = 178;
+
+	uint64_t capabilities;                  // offset: 0
+	uint64_t uid;                           // offset: 8
+	uint32_t flight_sw_version;             // offset: 16
+	uint32_t middleware_sw_version;         // offset: 20
+	uint32_t os_sw_version;                 // offset: 24
+	uint32_t board_version;                 // offset: 28
+	uint16_t vendor_id;                     // offset: 32
+	uint16_t product_id;                    // offset: 34
+	uint8_t flight_custom_version[8];       // offset: 36
+	uint8_t middleware_custom_version[8];   // offset: 44
+	uint8_t os_custom_version[8];           // offset: 52
+});
+static_assert(sizeof(AUTOPILOT_VERSION) == AUTOPILOT_VERSION::LENGTH, "AUTOPILOT_VERSION wire layout");
+
+/**
+ * @brief LANDING_TARGET wire layout
+ */
+MAVPACKED(
+struct LANDING_TARGET {
+	static constexpr mavlink::msgid_t MSG_ID = 149;
+	static constexpr size_t LENGTH = 60;
+	static constexpr size_t MIN_LENGTH = 30;
+	static constexpr uint8_t CRC_EXTRA = 200;
+
+	uint64_t time_usec;                     // offset: 0
+	float angle_x;                          // offset: 8
+	float angle_y;                          // offset: 12
+	float distance;                         // offset: 16
+	float size_x;                           // offset: 20
+	float size_y;                           // offset: 24
+	uint8_t target_num;                     // offset: 28
+	uint8_t frame;                          // offset: 29
+	float x;                                // offset: 30
+	float y;                                // offset: 34
+	float z;                                // offset: 38
+	float q[4];                             // offset: 42
+	uint8_t type;                           // offset: 58
+	uint8_t position_valid;                 // offset: 59
+});
+static_assert(sizeof(LANDING_TARGET) == LANDING_TARGET::LENGTH, "LANDING_TARGET wire layout");
+
+/**
+ * @brief ESTIMATOR_STATUS wire layout
+ */
+MAVPACKED(
+struct ESTIMATOR_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 230;
+	static constexpr size_t LENGTH = 42;
+	static constexpr size_t MIN_LENGTH = 42;
+	static constexpr uint8_t CRC_EXTRA = 163;
+
+	uint64_t time_usec;                     // offset: 0
+	float vel_ratio;                        // offset: 8
+	float pos_horiz_ratio;                  // offset: 12
+	float pos_vert_ratio;                   // offset: 16
+	float mag_ratio;                        // offset: 20
+	float hagl_ratio;                       // offset: 24
+	float tas_ratio;                        // offset: 28
+	float pos_horiz_accuracy;               // offset: 32
+	float pos_vert_accuracy;                // offset: 36
+	uint16_t flags;                         // offset: 40
+});
+static_assert(sizeof(ESTIMATOR_STATUS) == ESTIMATOR_STATUS::LENGTH, "ESTIMATOR_STATUS wire layout");
+
+/**
+ * @brief WIND_COV wire layout
+ */
+MAVPACKED(
+struct WIND_COV {
+	static constexpr mavlink::msgid_t MSG_ID = 231;
+	static constexpr size_t LENGTH = 40;
+	static constexpr size_t MIN_LENGTH = 40;
+	static constexpr uint8_t CRC_EXTRA = 105;
+
+	uint64_t time_usec;                     // offset: 0
+	float wind_x;                           // offset: 8
+	float wind_y;                           // offset: 12
+	float wind_z;                           // offset: 16
+	float var_horiz;                        // offset: 20
+	float var_vert;                         // offset: 24
+	float wind_alt;                         // offset: 28
+	float horiz_accuracy;                   // offset: 32
+	float vert_accuracy;                    // offset: 36
+});
+static_assert(sizeof(WIND_COV) == WIND_COV::LENGTH, "WIND_COV wire layout");
+
+/**
+ * @brief GPS_INPUT wire layout
+ */
+MAVPACKED(
+struct GPS_INPUT {
+	static constexpr mavlink::msgid_t MSG_ID = 232;
+	static constexpr size_t LENGTH = 63;
+	static constexpr size_t MIN_LENGTH = 63;
+	static constexpr uint8_t CRC_EXTRA = 151;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t time_week_ms;                  // offset: 8
+	int32_t lat;                            // offset: 12
+	int32_t lon;                            // offset: 16
+	float alt;                              // offset: 20
+	float hdop;                             // offset: 24
+	float vdop;                             // offset: 28
+	float vn;                               // offset: 32
+	float ve;                               // offset: 36
+	float vd;                               // offset: 40
+	float speed_accuracy;                   // offset: 44
+	float horiz_accuracy;                   // offset: 48
+	float vert_accuracy;                    // offset: 52
+	uint16_t ignore_flags;                  // offset: 56
+	uint16_t time_week;                     // offset: 58
+	uint8_t gps_id;                         // offset: 60
+	uint8_t fix_type;                       // offset: 61
+	uint8_t satellites_visible;             // offset: 62
+});
+static_assert(sizeof(GPS_INPUT) == GPS_INPUT::LENGTH, "GPS_INPUT wire layout");
+
+/**
+ * @brief GPS_RTCM_DATA wire layout
+ */
+MAVPACKED(
+struct GPS_RTCM_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 233;
+	static constexpr size_t LENGTH = 182;
+	static constexpr size_t MIN_LENGTH = 182;
+	static constexpr uint8_t CRC_EXTRA = 35;
+
+	uint8_t flags;                          // offset: 0
+	uint8_t len;                            // offset: 1
+	uint8_t data[180];                      // offset: 2
+});
+static_assert(sizeof(GPS_RTCM_DATA) == GPS_RTCM_DATA::LENGTH, "GPS_RTCM_DATA wire layout");
+
+/**
+ * @brief HIGH_LATENCY wire layout
+ */
+MAVPACKED(
+struct HIGH_LATENCY {
+	static constexpr mavlink::msgid_t MSG_ID = 234;
+	static constexpr size_t LENGTH = 40;
+	static constexpr size_t MIN_LENGTH = 40;
+	static constexpr uint8_t CRC_EXTRA = 150;
+
+	uint32_t custom_mode;                   // offset: 0
+	int32_t latitude;                       // offset: 4
+	int32_t longitude;                      // offset: 8
+	int16_t roll;                           // offset: 12
+	int16_t pitch;                          // offset: 14
+	uint16_t heading;                       // offset: 16
+	int16_t heading_sp;                     // offset: 18
+	int16_t altitude_amsl;                  // offset: 20
+	int16_t altitude_sp;                    // offset: 22
+	uint16_t wp_distance;                   // offset: 24
+	uint8_t base_mode;                      // offset: 26
+	uint8_t landed_state;                   // offset: 27
+	int8_t throttle;                        // offset: 28
+	uint8_t airspeed;                       // offset: 29
+	uint8_t airspeed_sp;                    // offset: 30
+	uint8_t groundspeed;                    // offset: 31
+	int8_t climb_rate;                      // offset: 32
+	uint8_t gps_nsat;                       // offset: 33
+	uint8_t gps_fix_type;                   // offset: 34
+	uint8_t battery_remaining;              // offset: 35
+	int8_t temperature;                     // offset: 36
+	int8_t temperature_air;                 // offset: 37
+	uint8_t failsafe;                       // offset: 38
+	uint8_t wp_num;                         // offset: 39
+});
+static_assert(sizeof(HIGH_LATENCY) == HIGH_LATENCY::LENGTH, "HIGH_LATENCY wire layout");
+
+/**
+ * @brief VIBRATION wire layout
+ */
+MAVPACKED(
+struct VIBRATION {
+	static constexpr mavlink::msgid_t MSG_ID = 241;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 90;
+
+	uint64_t time_usec;                     // offset: 0
+	float vibration_x;                      // offset: 8
+	float vibration_y;                      // offset: 12
+	float vibration_z;                      // offset: 16
+	uint32_t clipping_0;                    // offset: 20
+	uint32_t clipping_1;                    // offset: 24
+	uint32_t clipping_2;                    // offset: 28
+});
+static_assert(sizeof(VIBRATION) == VIBRATION::LENGTH, "VIBRATION wire layout");
+
+/**
+ * @brief HOME_POSITION wire layout
+ */
+MAVPACKED(
+struct HOME_POSITION {
+	static constexpr mavlink::msgid_t MSG_ID = 242;
+	static constexpr size_t LENGTH = 60;
+	static constexpr size_t MIN_LENGTH = 52;
+	static constexpr uint8_t CRC_EXTRA = 104;
+
+	int32_t latitude;                       // offset: 0
+	int32_t longitude;                      // offset: 4
+	int32_t altitude;                       // offset: 8
+	float x;                                // offset: 12
+	float y;                                // offset: 16
+	float z;                                // offset: 20
+	float q[4];                             // offset: 24
+	float approach_x;                       // offset: 40
+	float approach_y;                       // offset: 44
+	float approach_z;                       // offset: 48
+	uint64_t time_usec;                     // offset: 52
+});
+static_assert(sizeof(HOME_POSITION) == HOME_POSITION::LENGTH, "HOME_POSITION wire layout");
+
+/**
+ * @brief SET_HOME_POSITION wire layout
+ */
+MAVPACKED(
+struct SET_HOME_POSITION {
+	static constexpr mavlink::msgid_t MSG_ID = 243;
+	static constexpr size_t LENGTH = 61;
+	static constexpr size_t MIN_LENGTH = 53;
+	static constexpr uint8_t CRC_EXTRA = 85;
+
+	int32_t latitude;                       // offset: 0
+	int32_t longitude;                      // offset: 4
+	int32_t altitude;                       // offset: 8
+	float x;                                // offset: 12
+	float y;                                // offset: 16
+	float z;                                // offset: 20
+	float q[4];                             // offset: 24
+	float approach_x;                       // offset: 40
+	float approach_y;                       // offset: 44
+	float approach_z;                       // offset: 48
+	uint8_t target_system;                  // offset: 52
+	uint64_t time_usec;                     // offset: 53
+});
+static_assert(sizeof(SET_HOME_POSITION) == SET_HOME_POSITION::LENGTH, "SET_HOME_POSITION wire layout");
+
+/**
+ * @brief MESSAGE_INTERVAL wire layout
+ */
+MAVPACKED(
+struct MESSAGE_INTERVAL {
+	static constexpr mavlink::msgid_t MSG_ID = 244;
+	static constexpr size_t LENGTH = 6;
+	static constexpr size_t MIN_LENGTH = 6;
+	static constexpr uint8_t CRC_EXTRA = 95;
+
+	int32_t interval_us;                    // offset: 0
+	uint16_t message_id;                    // offset: 4
+});
+static_assert(sizeof(MESSAGE_INTERVAL) == MESSAGE_INTERVAL::LENGTH, "MESSAGE_INTERVAL wire layout");
+
+/**
+ * @brief EXTENDED_SYS_STATE wire layout
+ */
+MAVPACKED(
+struct EXTENDED_SYS_STATE {
+	static constexpr mavlink::msgid_t MSG_ID = 245;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 130;
+
+	uint8_t vtol_state;                     // offset: 0
+	uint8_t landed_state;                   // offset: 1
+});
+static_assert(sizeof(EXTENDED_SYS_STATE) == EXTENDED_SYS_STATE::LENGTH, "EXTENDED_SYS_STATE wire layout");
+
+/**
+ * @brief ADSB_VEHICLE wire layout
+ */
+MAVPACKED(
+struct ADSB_VEHICLE {
+	static constexpr mavlink::msgid_t MSG_ID = 246;
+	static constexpr size_t LENGTH = 38;
+	static constexpr size_t MIN_LENGTH = 38;
+	static constexpr uint8_t CRC_EXTRA = 184;
+
+	uint32_t ICAO_address;                  // offset: 0
+	int32_t lat;                            // offset: 4
+	int32_t lon;                            // offset: 8
+	int32_t altitude;                       // offset: 12
+	uint16_t heading;                       // offset: 16
+	uint16_t hor_velocity;                  // offset: 18
+	int16_t ver_velocity;                   // offset: 20
+	uint16_t flags;                         // offset: 22
+	uint16_t squawk;                        // offset: 24
+	uint8_t altitude_type;                  // offset: 26
+	char callsign[9];                       // offset: 27
+	uint8_t emitter_type;                   // offset: 36
+	uint8_t tslc;                           // offset: 37
+});
+static_assert(sizeof(ADSB_VEHICLE) == ADSB_VEHICLE::LENGTH, "ADSB_VEHICLE wire layout");
+
+/**
+ * @brief COLLISION wire layout
+ */
+MAVPACKED(
+struct COLLISION {
+	static constexpr mavlink::msgid_t MSG_ID = 247;
+	static constexpr size_t LENGTH = 19;
+	static constexpr size_t MIN_LENGTH = 19;
+	static constexpr uint8_t CRC_EXTRA = 81;
+
+	uint32_t id;                            // offset: 0
+	float time_to_minimum_delta;            // offset: 4
+	float altitude_minimum_delta;           // offset: 8
+	float horizontal_minimum_delta;         // offset: 12
+	uint8_t src;                            // offset: 16
+	uint8_t action;                         // offset: 17
+	uint8_t threat_level;                   // offset: 18
+});
+static_assert(sizeof(COLLISION) == COLLISION::LENGTH, "COLLISION wire layout");
+
+/**
+ * @brief V2_EXTENSION wire layout
+ */
+MAVPACKED(
+struct V2_EXTENSION {
+	static constexpr mavlink::msgid_t MSG_ID = 248;
+	static constexpr size_t LENGTH = 254;
+	static constexpr size_t MIN_LENGTH = 254;
+	static constexpr uint8_t CRC_EXTRA = 8;
+
+	uint16_t message_type;                  // offset: 0
+	uint8_t target_network;                 // offset: 2
+	uint8_t target_system;                  // offset: 3
+	uint8_t target_component;               // offset: 4
+	uint8_t payload[249];                   // offset: 5
+});
+static_assert(sizeof(V2_EXTENSION) == V2_EXTENSION::LENGTH, "V2_EXTENSION wire layout");
+
+/**
+ * @brief MEMORY_VECT wire layout
+ */
+MAVPACKED(
+struct MEMORY_VECT {
+	static constexpr mavlink::msgid_t MSG_ID = 249;
+	static constexpr size_t LENGTH = 36;
+	static constexpr size_t MIN_LENGTH = 36;
+	static constexpr uint8_t CRC_EXTRA = 204;
+
+	uint16_t address;                       // offset: 0
+	uint8_t ver;                            // offset: 2
+	uint8_t type;                           // offset: 3
+	int8_t value[32];                       // offset: 4
+});
+static_assert(sizeof(MEMORY_VECT) == MEMORY_VECT::LENGTH, "MEMORY_VECT wire layout");
+
+/**
+ * @brief DEBUG_VECT wire layout
+ */
+MAVPACKED(
+struct DEBUG_VECT {
+	static constexpr mavlink::msgid_t MSG_ID = 250;
+	static constexpr size_t LENGTH = 30;
+	static constexpr size_t MIN_LENGTH = 30;
+	static constexpr uint8_t CRC_EXTRA = 49;
+
+	uint64_t time_usec;                     // offset: 0
+	float x;                                // offset: 8
+	float y;                                // offset: 12
+	float z;                                // offset: 16
+	char name[10];                          // offset: 20
+});
+static_assert(sizeof(DEBUG_VECT) == DEBUG_VECT::LENGTH, "DEBUG_VECT wire layout");
+
+/**
+ * @brief NAMED_VALUE_FLOAT wire layout
+ */
+MAVPACKED(
+struct NAMED_VALUE_FLOAT {
+	static constexpr mavlink::msgid_t MSG_ID = 251;
+	static constexpr size_t LENGTH = 18;
+	static constexpr size_t MIN_LENGTH = 18;
+	static constexpr uint8_t CRC_EXTRA = 170;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float value;                            // offset: 4
+	char name[10];                          // offset: 8
+});
+static_assert(sizeof(NAMED_VALUE_FLOAT) == NAMED_VALUE_FLOAT::LENGTH, "NAMED_VALUE_FLOAT wire layout");
+
+/**
+ * @brief NAMED_VALUE_INT wire layout
+ */
+MAVPACKED(
+struct NAMED_VALUE_INT {
+	static constexpr mavlink::msgid_t MSG_ID = 252;
+	static constexpr size_t LENGTH = 18;
+	static constexpr size_t MIN_LENGTH = 18;
+	static constexpr uint8_t CRC_EXTRA = 44;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	int32_t value;                          // offset: 4
+	char name[10];                          // offset: 8
+});
+static_assert(sizeof(NAMED_VALUE_INT) == NAMED_VALUE_INT::LENGTH, "NAMED_VALUE_INT wire layout");
+
+/**
+ * @brief STATUSTEXT wire layout
+ */
+MAVPACKED(
+struct STATUSTEXT {
+	static constexpr mavlink::msgid_t MSG_ID = 253;
+	static constexpr size_t LENGTH = 51;
+	static constexpr size_t MIN_LENGTH = 51;
+	static constexpr uint8_t CRC_EXTRA = 83;
+
+	uint8_t severity;                       // offset: 0
+	char text[50];                          // offset: 1
+});
+static_assert(sizeof(STATUSTEXT) == STATUSTEXT::LENGTH, "STATUSTEXT wire layout");
+
+/**
+ * @brief DEBUG wire layout
+ */
+MAVPACKED(
+struct DEBUG {
+	static constexpr mavlink::msgid_t MSG_ID = 254;
+	static constexpr size_t LENGTH = 9;
+	static constexpr size_t MIN_LENGTH = 9;
+	static constexpr uint8_t CRC_EXTRA = 46;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float value;                            // offset: 4
+	uint8_t ind;                            // offset: 8
+});
+static_assert(sizeof(DEBUG) == DEBUG::LENGTH, "DEBUG wire layout");
+
+/**
+ * @brief SETUP_SIGNING wire layout
+ */
+MAVPACKED(
+struct SETUP_SIGNING {
+	static constexpr mavlink::msgid_t MSG_ID = 256;
+	static constexpr size_t LENGTH = 42;
+	static constexpr size_t MIN_LENGTH = 42;
+	static constexpr uint8_t CRC_EXTRA = 71;
+
+	uint64_t initial_timestamp;             // offset: 0
+	uint8_t target_system;                  // offset: 8
+	uint8_t target_component;               // offset: 9
+	uint8_t secret_key[32];                 // offset: 10
+});
+static_assert(sizeof(SETUP_SIGNING) == SETUP_SIGNING::LENGTH, "SETUP_SIGNING wire layout");
+
+/**
+ * @brief BUTTON_CHANGE wire layout
+ */
+MAVPACKED(
+struct BUTTON_CHANGE {
+	static constexpr mavlink::msgid_t MSG_ID = 257;
+	static constexpr size_t LENGTH = 9;
+	static constexpr size_t MIN_LENGTH = 9;
+	static constexpr uint8_t CRC_EXTRA = 131;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint32_t last_change_ms;                // offset: 4
+	uint8_t state;                          // offset: 8
+});
+static_assert(sizeof(BUTTON_CHANGE) == BUTTON_CHANGE::LENGTH, "BUTTON_CHANGE wire layout");
+
+/**
+ * @brief PLAY_TUNE wire layout
+ */
+MAVPACKED(
+struct PLAY_TUNE {
+	static constexpr mavlink::msgid_t MSG_ID = 258;
+	static constexpr size_t LENGTH = 32;
+	static constexpr size_t MIN_LENGTH = 32;
+	static constexpr uint8_t CRC_EXTRA = 187;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	char tune[30];                          // offset: 2
+});
+static_assert(sizeof(PLAY_TUNE) == PLAY_TUNE::LENGTH, "PLAY_TUNE wire layout");
+
+/**
+ * @brief CAMERA_INFORMATION wire layout
+ */
+MAVPACKED(
+struct CAMERA_INFORMATION {
+	static constexpr mavlink::msgid_t MSG_ID = 259;
+	static constexpr size_t LENGTH = 235;
+	static constexpr size_t MIN_LENGTH = 235;
+	static constexpr uint8_t CRC_EXTRA = 92;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint32_t firmware_version;              // offset: 4
+	float focal_length;                     // offset: 8
+	float sensor_size_h;                    // offset: 12
+	float sensor_size_v;                    // offset: 16
+	uint32_t flags;                         // offset: 20
+	uint16_t resolution_h;                  // offset: 24
+	uint16_t resolution_v;                  // offset: 26
+	uint16_t cam_definition_version;        // offset: 28
+	uint8_t vendor_name[32];                // offset: 30
+	uint8_t model_name[32];                 // offset: 62
+	uint8_t lens_id;                        // offset: 94
+	char cam_definition_uri[140];           // offset: 95
+});
+static_assert(sizeof(CAMERA_INFORMATION) == CAMERA_INFORMATION::LENGTH, "CAMERA_INFORMATION wire layout");
+
+/**
+ * @brief CAMERA_SETTINGS wire layout
+ */
+MAVPACKED(
+struct CAMERA_SETTINGS {
+	static constexpr mavlink::msgid_t MSG_ID = 260;
+	static constexpr size_t LENGTH = 5;
+	static constexpr size_t MIN_LENGTH = 5;
+	static constexpr uint8_t CRC_EXTRA = 146;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	uint8_t mode_id;                        // offset: 4
+});
+static_assert(sizeof(CAMERA_SETTINGS) == CAMERA_SETTINGS::LENGTH, "CAMERA_SETTINGS wire layout");
+
+/**
+ * @brief STORAGE_INFORMATION wire layout
+ */
+MAVPACKED(
+struct STORAGE_INFORMATION {
+	static constexpr mavlink::msgid_t MSG_ID = 261;
+	static constexpr size_t LENGTH = 27;
+	static constexpr size_t MIN_LENGTH = 27;
+	static constexpr uint8_t CRC_EXTRA = 179;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float total_capacity;                   // offset: 4
+	float used_capacity;                    // offset: 8
+	float available_capacity;               // offset: 12
+	float read_speed;                       // offset: 16
+	float write_speed;                      // offset: 20
+	uint8_t storage_id;                     // offset: 24
+	uint8_t storage_count;                  // offset: 25
+	uint8_t status;                         // offset: 26
+});
+static_assert(sizeof(STORAGE_INFORMATION) == STORAGE_INFORMATION::LENGTH, "STORAGE_INFORMATION wire layout");
+
+/**
+ * @brief CAMERA_CAPTURE_STATUS wire layout
+ */
+MAVPACKED(
+struct CAMERA_CAPTURE_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 262;
+	static constexpr size_t LENGTH = 18;
+	static constexpr size_t MIN_LENGTH = 18;
+	static constexpr uint8_t CRC_EXTRA = 12;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float image_interval;                   // offset: 4
+	uint32_t recording_time_ms;             // offset: 8
+	float available_capacity;               // offset: 12
+	uint8_t image_status;                   // offset: 16
+	uint8_t video_status;                   // offset: 17
+});
+static_assert(sizeof(CAMERA_CAPTURE_STATUS) == CAMERA_CAPTURE_STATUS::LENGTH, "CAMERA_CAPTURE_STATUS wire layout");
+
+/**
+ * @brief CAMERA_IMAGE_CAPTURED wire layout
+ */
+MAVPACKED(
+struct CAMERA_IMAGE_CAPTURED {
+	static constexpr mavlink::msgid_t MSG_ID = 263;
+	static constexpr size_t LENGTH = 255;
+	static constexpr size_t MIN_LENGTH = 255;
+	static constexpr uint8_t CRC_EXTRA = 133;
+
+	uint64_t time_utc;                      // offset: 0
+	uint32_t time_boot_ms;                  // offset: 8
+	int32_t lat;                            // offset: 12
+	int32_t lon;                            // offset: 16
+	int32_t alt;                            // offset: 20
+	int32_t relative_alt;                   // offset: 24
+	float q[4];                             // offset: 28
+	int32_t image_index;                    // offset: 44
+	uint8_t camera_id;                      // offset: 48
+	int8_t capture_result;                  // offset: 49
+	char file_url[205];                     // offset: 50
+});
+static_assert(sizeof(CAMERA_IMAGE_CAPTURED) == CAMERA_IMAGE_CAPTURED::LENGTH, "CAMERA_IMAGE_CAPTURED wire layout");
+
+/**
+ * @brief FLIGHT_INFORMATION wire layout
+ */
+MAVPACKED(
+struct FLIGHT_INFORMATION {
+	static constexpr mavlink::msgid_t MSG_ID = 264;
+	static constexpr size_t LENGTH = 28;
+	static constexpr size_t MIN_LENGTH = 28;
+	static constexpr uint8_t CRC_EXTRA = 49;
+
+	uint64_t arming_time_utc;               // offset: 0
+	uint64_t takeoff_time_utc;              // offset: 8
+	uint64_t flight_uuid;                   // offset: 16
+	uint32_t time_boot_ms;                  // offset: 24
+});
+static_assert(sizeof(FLIGHT_INFORMATION) == FLIGHT_INFORMATION::LENGTH, "FLIGHT_INFORMATION wire layout");
+
+/**
+ * @brief MOUNT_ORIENTATION wire layout
+ */
+MAVPACKED(
+struct MOUNT_ORIENTATION {
+	static constexpr mavlink::msgid_t MSG_ID = 265;
+	static constexpr size_t LENGTH = 16;
+	static constexpr size_t MIN_LENGTH = 16;
+	static constexpr uint8_t CRC_EXTRA = 26;
+
+	uint32_t time_boot_ms;                  // offset: 0
+	float roll;                             // offset: 4
+	float pitch;                            // offset: 8
+	float yaw;                              // offset: 12
+});
+static_assert(sizeof(MOUNT_ORIENTATION) == MOUNT_ORIENTATION::LENGTH, "MOUNT_ORIENTATION wire layout");
+
+/**
+ * @brief LOGGING_DATA wire layout
+ */
+MAVPACKED(
+struct LOGGING_DATA {
+	static constexpr mavlink::msgid_t MSG_ID = 266;
+	static constexpr size_t LENGTH = 255;
+	static constexpr size_t MIN_LENGTH = 255;
+	static constexpr uint8_t CRC_EXTRA = 193;
+
+	uint16_t sequence;                      // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t length;                         // offset: 4
+	uint8_t first_message_offset;           // offset: 5
+	uint8_t data[249];                      // offset: 6
+});
+static_assert(sizeof(LOGGING_DATA) == LOGGING_DATA::LENGTH, "LOGGING_DATA wire layout");
+
+/**
+ * @brief LOGGING_DATA_ACKED wire layout
+ */
+MAVPACKED(
+struct LOGGING_DATA_ACKED {
+	static constexpr mavlink::msgid_t MSG_ID = 267;
+	static constexpr size_t LENGTH = 255;
+	static constexpr size_t MIN_LENGTH = 255;
+	static constexpr uint8_t CRC_EXTRA = 35;
+
+	uint16_t sequence;                      // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	uint8_t length;                         // offset: 4
+	uint8_t first_message_offset;           // offset: 5
+	uint8_t data[249];                      // offset: 6
+});
+static_assert(sizeof(LOGGING_DATA_ACKED) == LOGGING_DATA_ACKED::LENGTH, "LOGGING_DATA_ACKED wire layout");
+
+/**
+ * @brief LOGGING_ACK wire layout
+ */
+MAVPACKED(
+struct LOGGING_ACK {
+	static constexpr mavlink::msgid_t MSG_ID = 268;
+	static constexpr size_t LENGTH = 4;
+	static constexpr size_t MIN_LENGTH = 4;
+	static constexpr uint8_t CRC_EXTRA = 14;
+
+	uint16_t sequence;                      // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+});
+static_assert(sizeof(LOGGING_ACK) == LOGGING_ACK::LENGTH, "LOGGING_ACK wire layout");
+
+/**
+ * @brief VIDEO_STREAM_INFORMATION wire layout
+ */
+MAVPACKED(
+struct VIDEO_STREAM_INFORMATION {
+	static constexpr mavlink::msgid_t MSG_ID = 269;
+	static constexpr size_t LENGTH = 246;
+	static constexpr size_t MIN_LENGTH = 246;
+	static constexpr uint8_t CRC_EXTRA = 58;
+
+	float framerate;                        // offset: 0
+	uint32_t bitrate;                       // offset: 4
+	uint16_t resolution_h;                  // offset: 8
+	uint16_t resolution_v;                  // offset: 10
+	uint16_t rotation;                      // offset: 12
+	uint8_t camera_id;                      // offset: 14
+	uint8_t status;                         // offset: 15
+	char uri[230];                          // offset: 16
+});
+static_assert(sizeof(VIDEO_STREAM_INFORMATION) == VIDEO_STREAM_INFORMATION::LENGTH, "VIDEO_STREAM_INFORMATION wire layout");
+
+/**
+ * @brief SET_VIDEO_STREAM_SETTINGS wire layout
+ */
+MAVPACKED(
+struct SET_VIDEO_STREAM_SETTINGS {
+	static constexpr mavlink::msgid_t MSG_ID = 270;
+	static constexpr size_t LENGTH = 247;
+	static constexpr size_t MIN_LENGTH = 247;
+	static constexpr uint8_t CRC_EXTRA = 232;
+
+	float framerate;                        // offset: 0
+	uint32_t bitrate;                       // offset: 4
+	uint16_t resolution_h;                  // offset: 8
+	uint16_t resolution_v;                  // offset: 10
+	uint16_t rotation;                      // offset: 12
+	uint8_t target_system;                  // offset: 14
+	uint8_t target_component;               // offset: 15
+	uint8_t camera_id;                      // offset: 16
+	char uri[230];                          // offset: 17
+});
+static_assert(sizeof(SET_VIDEO_STREAM_SETTINGS) == SET_VIDEO_STREAM_SETTINGS::LENGTH, "SET_VIDEO_STREAM_SETTINGS wire layout");
+
+/**
+ * @brief WIFI_CONFIG_AP wire layout
+ */
+MAVPACKED(
+struct WIFI_CONFIG_AP {
+	static constexpr mavlink::msgid_t MSG_ID = 299;
+	static constexpr size_t LENGTH = 96;
+	static constexpr size_t MIN_LENGTH = 96;
+	static constexpr uint8_t CRC_EXTRA = 19;
+
+	char ssid[32];                          // offset: 0
+	char password[64];                      // offset: 32
+});
+static_assert(sizeof(WIFI_CONFIG_AP) == WIFI_CONFIG_AP::LENGTH, "WIFI_CONFIG_AP wire layout");
+
+/**
+ * @brief PROTOCOL_VERSION wire layout
+ */
+MAVPACKED(
+struct PROTOCOL_VERSION {
+	static constexpr mavlink::msgid_t MSG_ID = 300;
+	static constexpr size_t LENGTH = 22;
+	static constexpr size_t MIN_LENGTH = 22;
+	static constexpr uint8_t CRC_EXTRA = 217;
+
+	uint16_t version;                       // offset: 0
+	uint16_t min_version;                   // offset: 2
+	uint16_t max_version;                   // offset: 4
+	uint8_t spec_version_hash[8];           // offset: 6
+	uint8_t library_version_hash[8];        // offset: 14
+});
+static_assert(sizeof(PROTOCOL_VERSION) == PROTOCOL_VERSION::LENGTH, "PROTOCOL_VERSION wire layout");
+
+/**
+ * @brief UAVCAN_NODE_STATUS wire layout
+ */
+MAVPACKED(
+struct UAVCAN_NODE_STATUS {
+	static constexpr mavlink::msgid_t MSG_ID = 310;
+	static constexpr size_t LENGTH = 17;
+	static constexpr size_t MIN_LENGTH = 17;
+	static constexpr uint8_t CRC_EXTRA = 28;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t uptime_sec;                    // offset: 8
+	uint16_t vendor_specific_status_code;   // offset: 12
+	uint8_t health;                         // offset: 14
+	uint8_t mode;                           // offset: 15
+	uint8_t sub_mode;                       // offset: 16
+});
+static_assert(sizeof(UAVCAN_NODE_STATUS) == UAVCAN_NODE_STATUS::LENGTH, "UAVCAN_NODE_STATUS wire layout");
+
+/**
+ * @brief UAVCAN_NODE_INFO wire layout
+ */
+MAVPACKED(
+struct UAVCAN_NODE_INFO {
+	static constexpr mavlink::msgid_t MSG_ID = 311;
+	static constexpr size_t LENGTH = 116;
+	static constexpr size_t MIN_LENGTH = 116;
+	static constexpr uint8_t CRC_EXTRA = 95;
+
+	uint64_t time_usec;                     // offset: 0
+	uint32_t uptime_sec;                    // offset: 8
+	uint32_t sw_vcs_commit;                 // offset: 12
+	char name[80];                          // offset: 16
+	uint8_t hw_version_major;               // offset: 96
+	uint8_t hw_version_minor;               // offset: 97
+	uint8_t hw_unique_id[16];               // offset: 98
+	uint8_t sw_version_major;               // offset: 114
+	uint8_t sw_version_minor;               // offset: 115
+});
+static_assert(sizeof(UAVCAN_NODE_INFO) == UAVCAN_NODE_INFO::LENGTH, "UAVCAN_NODE_INFO wire layout");
+
+/**
+ * @brief PARAM_EXT_REQUEST_READ wire layout
+ */
+MAVPACKED(
+struct PARAM_EXT_REQUEST_READ {
+	static constexpr mavlink::msgid_t MSG_ID = 320;
+	static constexpr size_t LENGTH = 20;
+	static constexpr size_t MIN_LENGTH = 20;
+	static constexpr uint8_t CRC_EXTRA = 243;
+
+	int16_t param_index;                    // offset: 0
+	uint8_t target_system;                  // offset: 2
+	uint8_t target_component;               // offset: 3
+	char param_id[16];                      // offset: 4
+});
+static_assert(sizeof(PARAM_EXT_REQUEST_READ) == PARAM_EXT_REQUEST_READ::LENGTH, "PARAM_EXT_REQUEST_READ wire layout");
+
+/**
+ * @brief PARAM_EXT_REQUEST_LIST wire layout
+ */
+MAVPACKED(
+struct PARAM_EXT_REQUEST_LIST {
+	static constexpr mavlink::msgid_t MSG_ID = 321;
+	static constexpr size_t LENGTH = 2;
+	static constexpr size_t MIN_LENGTH = 2;
+	static constexpr uint8_t CRC_EXTRA = 88;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+});
+static_assert(sizeof(PARAM_EXT_REQUEST_LIST) == PARAM_EXT_REQUEST_LIST::LENGTH, "PARAM_EXT_REQUEST_LIST wire layout");
+
+/**
+ * @brief PARAM_EXT_VALUE wire layout
+ */
+MAVPACKED(
+struct PARAM_EXT_VALUE {
+	static constexpr mavlink::msgid_t MSG_ID = 322;
+	static constexpr size_t LENGTH = 149;
+	static constexpr size_t MIN_LENGTH = 149;
+	static constexpr uint8_t CRC_EXTRA = 243;
+
+	uint16_t param_count;                   // offset: 0
+	uint16_t param_index;                   // offset: 2
+	char param_id[16];                      // offset: 4
+	char param_value[128];                  // offset: 20
+	uint8_t param_type;                     // offset: 148
+});
+static_assert(sizeof(PARAM_EXT_VALUE) == PARAM_EXT_VALUE::LENGTH, "PARAM_EXT_VALUE wire layout");
+
+/**
+ * @brief PARAM_EXT_SET wire layout
+ */
+MAVPACKED(
+struct PARAM_EXT_SET {
+	static constexpr mavlink::msgid_t MSG_ID = 323;
+	static constexpr size_t LENGTH = 147;
+	static constexpr size_t MIN_LENGTH = 147;
+	static constexpr uint8_t CRC_EXTRA = 78;
+
+	uint8_t target_system;                  // offset: 0
+	uint8_t target_component;               // offset: 1
+	char param_id[16];                      // offset: 2
+	char param_value[128];                  // offset: 18
+	uint8_t param_type;                     // offset: 146
+});
+static_assert(sizeof(PARAM_EXT_SET) == PARAM_EXT_SET::LENGTH, "PARAM_EXT_SET wire layout");
+
+/**
+ * @brief PARAM_EXT_ACK wire layout
+ */
+MAVPACKED(
+struct PARAM_EXT_ACK {
+	static constexpr mavlink::msgid_t MSG_ID = 324;
+	static constexpr size_t LENGTH = 146;
+	static constexpr size_t MIN_LENGTH = 146;
+	static constexpr uint8_t CRC_EXTRA = 132;
+
+	char param_id[16];                      // offset: 0
+	char param_value[128];                  // offset: 16
+	uint8_t param_type;                     // offset: 144
+	uint8_t param_result;                   // offset: 145
+});
+static_assert(sizeof(PARAM_EXT_ACK) == PARAM_EXT_ACK::LENGTH, "PARAM_EXT_ACK wire layout");
+
+namespace view {
+
+/**
+ * @brief HEARTBEAT lazy view, fields are read from the payload on access
+ */
+class HEARTBEAT : public View {
+public:
+	using Layout = wire::common::HEARTBEAT;
+	static constexpr mavlink::msgid_t MSG_ID = 0;
+
+	explicit HEARTBEAT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t custom_mode() const { return load_field<uint32_t>(0); }
+	uint8_t type() const { return load_field<uint8_t>(4); }
+	uint8_t autopilot() const { return load_field<uint8_t>(5); }
+	uint8_t base_mode() const { return load_field<uint8_t>(6); }
+	uint8_t system_status() const { return load_field<uint8_t>(7); }
+	uint8_t mavlink_version() const { return load_field<uint8_t>(8); }
+};
+
+/**
+ * @brief SYS_STATUS lazy view, fields are read from the payload on access
+ */
+class SYS_STATUS : public View {
+public:
+	using Layout = wire::common::SYS_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 1;
+
+	explicit SYS_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t onboard_control_sensors_present() const { return load_field<uint32_t>(0); }
+	uint32_t onboard_control_sensors_enabled() const { return load_field<uint32_t>(4); }
+	uint32_t onboard_control_sensors_health() const { return load_field<uint32_t>(8); }
+	uint16_t load() const { return load_field<uint16_t>(12); }
+	uint16_t voltage_battery() const { return load_field<uint16_t>(14); }
+	int16_t current_battery() const { return load_field<int16_t>(16); }
+	uint16_t drop_rate_comm() const { return load_field<uint16_t>(18); }
+	uint16_t errors_comm() const { return load_field<uint16_t>(20); }
+	uint16_t errors_count1() const { return load_field<uint16_t>(22); }
+	uint16_t errors_count2() const { return load_field<uint16_t>(24); }
+	uint16_t errors_count3() const { return load_field<uint16_t>(26); }
+	uint16_t errors_count4() const { return load_field<uint16_t>(28); }
+	int8_t battery_remaining() const { return load_field<int8_t>(30); }
+};
+
+/**
+ * @brief SYSTEM_TIME lazy view, fields are read from the payload on access
+ */
+class SYSTEM_TIME : public View {
+public:
+	using Layout = wire::common::SYSTEM_TIME;
+	static constexpr mavlink::msgid_t MSG_ID = 2;
+
+	explicit SYSTEM_TIME(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_unix_usec() const { return load_field<uint64_t>(0); }
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(8); }
+};
+
+/**
+ * @brief PING lazy view, fields are read from the payload on access
+ */
+class PING : public View {
+public:
+	using Layout = wire::common::PING;
+	static constexpr mavlink::msgid_t MSG_ID = 4;
+
+	explicit PING(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t seq() const { return load_field<uint32_t>(8); }
+	uint8_t target_system() const { return load_field<uint8_t>(12); }
+	uint8_t target_component() const { return load_field<uint8_t>(13); }
+};
+
+/**
+ * @brief CHANGE_OPERATOR_CONTROL lazy view, fields are read from the payload on access
+ */
+class CHANGE_OPERATOR_CONTROL : public View {
+public:
+	using Layout = wire::common::CHANGE_OPERATOR_CONTROL;
+	static constexpr mavlink::msgid_t MSG_ID = 5;
+
+	explicit CHANGE_OPERATOR_CONTROL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t control_request() const { return load_field<uint8_t>(1); }
+	uint8_t version() const { return load_field<uint8_t>(2); }
+	std::string passkey() const { return load_string(3, 25); }
+	char passkey(size_t i) const { return load_field<char>(3 + i * 1); }
+};
+
+/**
+ * @brief CHANGE_OPERATOR_CONTROL_ACK lazy view, fields are read from the payload on access
+ */
+class CHANGE_OPERATOR_CONTROL_ACK : public View {
+public:
+	using Layout = wire::common::CHANGE_OPERATOR_CONTROL_ACK;
+	static constexpr mavlink::msgid_t MSG_ID = 6;
+
+	explicit CHANGE_OPERATOR_CONTROL_ACK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t gcs_system_id() const { return load_field<uint8_t>(0); }
+	uint8_t control_request() const { return load_field<uint8_t>(1); }
+	uint8_t ack() const { return load_field<uint8_t>(2); }
+};
+
+/**
+ * @brief AUTH_KEY lazy view, fields are read from the payload on access
+ */
+class AUTH_KEY : public View {
+public:
+	using Layout = wire::common::AUTH_KEY;
+	static constexpr mavlink::msgid_t MSG_ID = 7;
+
+	explicit AUTH_KEY(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	std::string key() const { return load_string(0, 32); }
+	char key(size_t i) const { return load_field<char>(0 + i * 1); }
+};
+
+/**
+ * @brief SET_MODE lazy view, fields are read from the payload on access
+ */
+class SET_MODE : public View {
+public:
+	using Layout = wire::common::SET_MODE;
+	static constexpr mavlink::msgid_t MSG_ID = 11;
+
+	explicit SET_MODE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t custom_mode() const { return load_field<uint32_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(4); }
+	uint8_t base_mode() const { return load_field<uint8_t>(5); }
+};
+
+/**
+ * @brief PARAM_REQUEST_READ lazy view, fields are read from the payload on access
+ */
+class PARAM_REQUEST_READ : public View {
+public:
+	using Layout = wire::common::PARAM_REQUEST_READ;
+	static constexpr mavlink::msgid_t MSG_ID = 20;
+
+	explicit PARAM_REQUEST_READ(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int16_t param_index() const { return load_field<int16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	std::string param_id() const { return load_string(4, 16); }
+	char param_id(size_t i) const { return load_field<char>(4 + i * 1); }
+};
+
+/**
+ * @brief PARAM_REQUEST_LIST lazy view, fields are read from the payload on access
+ */
+class PARAM_REQUEST_LIST : public View {
+public:
+	using Layout = wire::common::PARAM_REQUEST_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 21;
+
+	explicit PARAM_REQUEST_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+};
+
+/**
+ * @brief PARAM_VALUE lazy view, fields are read from the payload on access
+ */
+class PARAM_VALUE : public View {
+public:
+	using Layout = wire::common::PARAM_VALUE;
+	static constexpr mavlink::msgid_t MSG_ID = 22;
+
+	explicit PARAM_VALUE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param_value() const { return load_field<float>(0); }
+	uint16_t param_count() const { return load_field<uint16_t>(4); }
+	uint16_t param_index() const { return load_field<uint16_t>(6); }
+	std::string param_id() const { return load_string(8, 16); }
+	char param_id(size_t i) const { return load_field<char>(8 + i * 1); }
+	uint8_t param_type() const { return load_field<uint8_t>(24); }
+};
+
+/**
+ * @brief PARAM_SET lazy view, fields are read from the payload on access
+ */
+class PARAM_SET : public View {
+public:
+	using Layout = wire::common::PARAM_SET;
+	static constexpr mavlink::msgid_t MSG_ID = 23;
+
+	explicit PARAM_SET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param_value() const { return load_field<float>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(4); }
+	uint8_t target_component() const { return load_field<uint8_t>(5); }
+	std::string param_id() const { return load_string(6, 16); }
+	char param_id(size_t i) const { return load_field<char>(6 + i * 1); }
+	uint8_t param_type() const { return load_field<uint8_t>(22); }
+};
+
+/**
+ * @brief GPS_RAW_INT lazy view, fields are read from the payload on access
+ */
+class GPS_RAW_INT : public View {
+public:
+	using Layout = wire::common::GPS_RAW_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 24;
+
+	explicit GPS_RAW_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(8); }
+	int32_t lon() const { return load_field<int32_t>(12); }
+	int32_t alt() const { return load_field<int32_t>(16); }
+	uint16_t eph() const { return load_field<uint16_t>(20); }
+	uint16_t epv() const { return load_field<uint16_t>(22); }
+	uint16_t vel() const { return load_field<uint16_t>(24); }
+	uint16_t cog() const { return load_field<uint16_t>(26); }
+	uint8_t fix_type() const { return load_field<uint8_t>(28); }
+	uint8_t satellites_visible() const { return load_field<uint8_t>(29); }
+	int32_t alt_ellipsoid() const { return load_field<int32_t>(30); }
+	uint32_t h_acc() const { return load_field<uint32_t>(34); }
+	uint32_t v_acc() const { return load_field<uint32_t>(38); }
+	uint32_t vel_acc() const { return load_field<uint32_t>(42); }
+	uint32_t hdg_acc() const { return load_field<uint32_t>(46); }
+};
+
+/**
+ * @brief GPS_STATUS lazy view, fields are read from the payload on access
+ */
+class GPS_STATUS : public View {
+public:
+	using Layout = wire::common::GPS_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 25;
+
+	explicit GPS_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t satellites_visible() const { return load_field<uint8_t>(0); }
+	uint8_t satellite_prn(size_t i) const { return load_field<uint8_t>(1 + i * 1); }
+	uint8_t satellite_used(size_t i) const { return load_field<uint8_t>(21 + i * 1); }
+	uint8_t satellite_elevation(size_t i) const { return load_field<uint8_t>(41 + i * 1); }
+	uint8_t satellite_azimuth(size_t i) const { return load_field<uint8_t>(61 + i * 1); }
+	uint8_t satellite_snr(size_t i) const { return load_field<uint8_t>(81 + i * 1); }
+};
+
+/**
+ * @brief SCALED_IMU lazy view, fields are read from the payload on access
+ */
+class SCALED_IMU : public View {
+public:
+	using Layout = wire::common::SCALED_IMU;
+	static constexpr mavlink::msgid_t MSG_ID = 26;
+
+	explicit SCALED_IMU(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int16_t xacc() const { return load_field<int16_t>(4); }
+	int16_t yacc() const { return load_field<int16_t>(6); }
+	int16_t zacc() const { return load_field<int16_t>(8); }
+	int16_t xgyro() const { return load_field<int16_t>(10); }
+	int16_t ygyro() const { return load_field<int16_t>(12); }
+	int16_t zgyro() const { return load_field<int16_t>(14); }
+	int16_t xmag() const { return load_field<int16_t>(16); }
+	int16_t ymag() const { return load_field<int16_t>(18); }
+	int16_t zmag() const { return load_field<int16_t>(20); }
+};
+
+/**
+ * @brief RAW_IMU lazy view, fields are read from the payload on access
+ */
+class RAW_IMU : public View {
+public:
+	using Layout = wire::common::RAW_IMU;
+	static constexpr mavlink::msgid_t MSG_ID = 27;
+
+	explicit RAW_IMU(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int16_t xacc() const { return load_field<int16_t>(8); }
+	int16_t yacc() const { return load_field<int16_t>(10); }
+	int16_t zacc() const { return load_field<int16_t>(12); }
+	int16_t xgyro() const { return load_field<int16_t>(14); }
+	int16_t ygyro() const { return load_field<int16_t>(16); }
+	int16_t zgyro() const { return load_field<int16_t>(18); }
+	int16_t xmag() const { return load_field<int16_t>(20); }
+	int16_t ymag() const { return load_field<int16_t>(22); }
+	int16_t zmag() const { return load_field<int16_t>(24); }
+};
+
+/**
+ * @brief RAW_PRESSURE lazy view, fields are read from the payload on access
+ */
+class RAW_PRESSURE : public View {
+public:
+	using Layout = wire::common::RAW_PRESSURE;
+	static constexpr mavlink::msgid_t MSG_ID = 28;
+
+	explicit RAW_PRESSURE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int16_t press_abs() const { return load_field<int16_t>(8); }
+	int16_t press_diff1() const { return load_field<int16_t>(10); }
+	int16_t press_diff2() const { return load_field<int16_t>(12); }
+	int16_t temperature() const { return load_field<int16_t>(14); }
+};
+
+/**
+ * @brief SCALED_PRESSURE lazy view, fields are read from the payload on access
+ */
+class SCALED_PRESSURE : public View {
+public:
+	using Layout = wire::common::SCALED_PRESSURE;
+	static constexpr mavlink::msgid_t MSG_ID = 29;
+
+	explicit SCALED_PRESSURE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float press_abs() const { return load_field<float>(4); }
+	float press_diff() const { return load_field<float>(8); }
+	int16_t temperature() const { return load_field<int16_t>(12); }
+};
+
+/**
+ * @brief ATTITUDE lazy view, fields are read from the payload on access
+ */
+class ATTITUDE : public View {
+public:
+	using Layout = wire::common::ATTITUDE;
+	static constexpr mavlink::msgid_t MSG_ID = 30;
+
+	explicit ATTITUDE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float roll() const { return load_field<float>(4); }
+	float pitch() const { return load_field<float>(8); }
+	float yaw() const { return load_field<float>(12); }
+	float rollspeed() const { return load_field<float>(16); }
+	float pitchspeed() const { return load_field<float>(20); }
+	float yawspeed() const { return load_field<float>(24); }
+};
+
+/**
+ * @brief ATTITUDE_QUATERNION lazy view, fields are read from the payload on access
+ */
+class ATTITUDE_QUATERNION : public View {
+public:
+	using Layout = wire::common::ATTITUDE_QUATERNION;
+	static constexpr mavlink::msgid_t MSG_ID = 31;
+
+	explicit ATTITUDE_QUATERNION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float q1() const { return load_field<float>(4); }
+	float q2() const { return load_field<float>(8); }
+	float q3() const { return load_field<float>(12); }
+	float q4() const { return load_field<float>(16); }
+	float rollspeed() const { return load_field<float>(20); }
+	float pitchspeed() const { return load_field<float>(24); }
+	float yawspeed() const { return load_field<float>(28); }
+};
+
+/**
+ * @brief LOCAL_POSITION_NED lazy view, fields are read from the payload on access
+ */
+class LOCAL_POSITION_NED : public View {
+public:
+	using Layout = wire::common::LOCAL_POSITION_NED;
+	static constexpr mavlink::msgid_t MSG_ID = 32;
+
+	explicit LOCAL_POSITION_NED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float x() const { return load_field<float>(4); }
+	float y() const { return load_field<float>(8); }
+	float z() const { return load_field<float>(12); }
+	float vx() const { return load_field<float>(16); }
+	float vy() const { return load_field<float>(20); }
+	float vz() const { return load_field<float>(24); }
+};
+
+/**
+ * @brief GLOBAL_POSITION_INT lazy view, fields are read from the payload on access
+ */
+class GLOBAL_POSITION_INT : public View {
+public:
+	using Layout = wire::common::GLOBAL_POSITION_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 33;
+
+	explicit GLOBAL_POSITION_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(4); }
+	int32_t lon() const { return load_field<int32_t>(8); }
+	int32_t alt() const { return load_field<int32_t>(12); }
+	int32_t relative_alt() const { return load_field<int32_t>(16); }
+	int16_t vx() const { return load_field<int16_t>(20); }
+	int16_t vy() const { return load_field<int16_t>(22); }
+	int16_t vz() const { return load_field<int16_t>(24); }
+	uint16_t hdg() const { return load_field<uint16_t>(26); }
+};
+
+/**
+ * @brief RC_CHANNELS_SCALED lazy view, fields are read from the payload on access
+ */
+class RC_CHANNELS_SCALED : public View {
+public:
+	using Layout = wire::common::RC_CHANNELS_SCALED;
+	static constexpr mavlink::msgid_t MSG_ID = 34;
+
+	explicit RC_CHANNELS_SCALED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int16_t chan1_scaled() const { return load_field<int16_t>(4); }
+	int16_t chan2_scaled() const { return load_field<int16_t>(6); }
+	int16_t chan3_scaled() const { return load_field<int16_t>(8); }
+	int16_t chan4_scaled() const { return load_field<int16_t>(10); }
+	int16_t chan5_scaled() const { return load_field<int16_t>(12); }
+	int16_t chan6_scaled() const { return load_field<int16_t>(14); }
+	int16_t chan7_scaled() const { return load_field<int16_t>(16); }
+	int16_t chan8_scaled() const { return load_field<int16_t>(18); }
+	uint8_t port() const { return load_field<uint8_t>(20); }
+	uint8_t rssi() const { return load_field<uint8_t>(21); }
+};
+
+/**
+ * @brief RC_CHANNELS_RAW lazy view, fields are read from the payload on access
+ */
+class RC_CHANNELS_RAW : public View {
+public:
+	using Layout = wire::common::RC_CHANNELS_RAW;
+	static constexpr mavlink::msgid_t MSG_ID = 35;
+
+	explicit RC_CHANNELS_RAW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint16_t chan1_raw() const { return load_field<uint16_t>(4); }
+	uint16_t chan2_raw() const { return load_field<uint16_t>(6); }
+	uint16_t chan3_raw() const { return load_field<uint16_t>(8); }
+	uint16_t chan4_raw() const { return load_field<uint16_t>(10); }
+	uint16_t chan5_raw() const { return load_field<uint16_t>(12); }
+	uint16_t chan6_raw() const { return load_field<uint16_t>(14); }
+	uint16_t chan7_raw() const { return load_field<uint16_t>(16); }
+	uint16_t chan8_raw() const { return load_field<uint16_t>(18); }
+	uint8_t port() const { return load_field<uint8_t>(20); }
+	uint8_t rssi() const { return load_field<uint8_t>(21); }
+};
+
+/**
+ * @brief SERVO_OUTPUT_RAW lazy view, fields are read from the payload on access
+ */
+class SERVO_OUTPUT_RAW : public View {
+public:
+	using Layout = wire::common::SERVO_OUTPUT_RAW;
+	static constexpr mavlink::msgid_t MSG_ID = 36;
+
+	explicit SERVO_OUTPUT_RAW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_usec() const { return load_field<uint32_t>(0); }
+	uint16_t servo1_raw() const { return load_field<uint16_t>(4); }
+	uint16_t servo2_raw() const { return load_field<uint16_t>(6); }
+	uint16_t servo3_raw() const { return load_field<uint16_t>(8); }
+	uint16_t servo4_raw() const { return load_field<uint16_t>(10); }
+	uint16_t servo5_raw() const { return load_field<uint16_t>(12); }
+	uint16_t servo6_raw() const { return load_field<uint16_t>(14); }
+	uint16_t servo7_raw() const { return load_field<uint16_t>(16); }
+	uint16_t servo8_raw() const { return load_field<uint16_t>(18); }
+	uint8_t port() const { return load_field<uint8_t>(20); }
+	uint16_t servo9_raw() const { return load_field<uint16_t>(21); }
+	uint16_t servo10_raw() const { return load_field<uint16_t>(23); }
+	uint16_t servo11_raw() const { return load_field<uint16_t>(25); }
+	uint16_t servo12_raw() const { return load_field<uint16_t>(27); }
+	uint16_t servo13_raw() const { return load_field<uint16_t>(29); }
+	uint16_t servo14_raw() const { return load_field<uint16_t>(31); }
+	uint16_t servo15_raw() const { return load_field<uint16_t>(33); }
+	uint16_t servo16_raw() const { return load_field<uint16_t>(35); }
+};
+
+/**
+ * @brief MISSION_REQUEST_PARTIAL_LIST lazy view, fields are read from the payload on access
+ */
+class MISSION_REQUEST_PARTIAL_LIST : public View {
+public:
+	using Layout = wire::common::MISSION_REQUEST_PARTIAL_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 37;
+
+	explicit MISSION_REQUEST_PARTIAL_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int16_t start_index() const { return load_field<int16_t>(0); }
+	int16_t end_index() const { return load_field<int16_t>(2); }
+	uint8_t target_system() const { return load_field<uint8_t>(4); }
+	uint8_t target_component() const { return load_field<uint8_t>(5); }
+	uint8_t mission_type() const { return load_field<uint8_t>(6); }
+};
+
+/**
+ * @brief MISSION_WRITE_PARTIAL_LIST lazy view, fields are read from the payload on access
+ */
+class MISSION_WRITE_PARTIAL_LIST : public View {
+public:
+	using Layout = wire::common::MISSION_WRITE_PARTIAL_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 38;
+
+	explicit MISSION_WRITE_PARTIAL_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int16_t start_index() const { return load_field<int16_t>(0); }
+	int16_t end_index() const { return load_field<int16_t>(2); }
+	uint8_t target_system() const { return load_field<uint8_t>(4); }
+	uint8_t target_component() const { return load_field<uint8_t>(5); }
+	uint8_t mission_type() const { return load_field<uint8_t>(6); }
+};
+
+/**
+ * @brief MISSION_ITEM lazy view, fields are read from the payload on access
+ */
+class MISSION_ITEM : public View {
+public:
+	using Layout = wire::common::MISSION_ITEM;
+	static constexpr mavlink::msgid_t MSG_ID = 39;
+
+	explicit MISSION_ITEM(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param1() const { return load_field<float>(0); }
+	float param2() const { return load_field<float>(4); }
+	float param3() const { return load_field<float>(8); }
+	float param4() const { return load_field<float>(12); }
+	float x() const { return load_field<float>(16); }
+	float y() const { return load_field<float>(20); }
+	float z() const { return load_field<float>(24); }
+	uint16_t seq() const { return load_field<uint16_t>(28); }
+	uint16_t command() const { return load_field<uint16_t>(30); }
+	uint8_t target_system() const { return load_field<uint8_t>(32); }
+	uint8_t target_component() const { return load_field<uint8_t>(33); }
+	uint8_t frame() const { return load_field<uint8_t>(34); }
+	uint8_t current() const { return load_field<uint8_t>(35); }
+	uint8_t autocontinue() const { return load_field<uint8_t>(36); }
+	uint8_t mission_type() const { return load_field<uint8_t>(37); }
+};
+
+/**
+ * @brief MISSION_REQUEST lazy view, fields are read from the payload on access
+ */
+class MISSION_REQUEST : public View {
+public:
+	using Layout = wire::common::MISSION_REQUEST;
+	static constexpr mavlink::msgid_t MSG_ID = 40;
+
+	explicit MISSION_REQUEST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seq() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t mission_type() const { return load_field<uint8_t>(4); }
+};
+
+/**
+ * @brief MISSION_SET_CURRENT lazy view, fields are read from the payload on access
+ */
+class MISSION_SET_CURRENT : public View {
+public:
+	using Layout = wire::common::MISSION_SET_CURRENT;
+	static constexpr mavlink::msgid_t MSG_ID = 41;
+
+	explicit MISSION_SET_CURRENT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seq() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+};
+
+/**
+ * @brief MISSION_CURRENT lazy view, fields are read from the payload on access
+ */
+class MISSION_CURRENT : public View {
+public:
+	using Layout = wire::common::MISSION_CURRENT;
+	static constexpr mavlink::msgid_t MSG_ID = 42;
+
+	explicit MISSION_CURRENT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seq() const { return load_field<uint16_t>(0); }
+};
+
+/**
+ * @brief MISSION_REQUEST_LIST lazy view, fields are read from the payload on access
+ */
+class MISSION_REQUEST_LIST : public View {
+public:
+	using Layout = wire::common::MISSION_REQUEST_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 43;
+
+	explicit MISSION_REQUEST_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	uint8_t mission_type() const { return load_field<uint8_t>(2); }
+};
+
+/**
+ * @brief MISSION_COUNT lazy view, fields are read from the payload on access
+ */
+class MISSION_COUNT : public View {
+public:
+	using Layout = wire::common::MISSION_COUNT;
+	static constexpr mavlink::msgid_t MSG_ID = 44;
+
+	explicit MISSION_COUNT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t count() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t mission_type() const { return load_field<uint8_t>(4); }
+};
+
+/**
+ * @brief MISSION_CLEAR_ALL lazy view, fields are read from the payload on access
+ */
+class MISSION_CLEAR_ALL : public View {
+public:
+	using Layout = wire::common::MISSION_CLEAR_ALL;
+	static constexpr mavlink::msgid_t MSG_ID = 45;
+
+	explicit MISSION_CLEAR_ALL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	uint8_t mission_type() const { return load_field<uint8_t>(2); }
+};
+
+/**
+ * @brief MISSION_ITEM_REACHED lazy view, fields are read from the payload on access
+ */
+class MISSION_ITEM_REACHED : public View {
+public:
+	using Layout = wire::common::MISSION_ITEM_REACHED;
+	static constexpr mavlink::msgid_t MSG_ID = 46;
+
+	explicit MISSION_ITEM_REACHED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seq() const { return load_field<uint16_t>(0); }
+};
+
+/**
+ * @brief MISSION_ACK lazy view, fields are read from the payload on access
+ */
+class MISSION_ACK : public View {
+public:
+	using Layout = wire::common::MISSION_ACK;
+	static constexpr mavlink::msgid_t MSG_ID = 47;
+
+	explicit MISSION_ACK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	uint8_t type() const { return load_field<uint8_t>(2); }
+	uint8_t mission_type() const { return load_field<uint8_t>(3); }
+};
+
+/**
+ * @brief SET_GPS_GLOBAL_ORIGIN lazy view, fields are read from the payload on access
+ */
+class SET_GPS_GLOBAL_ORIGIN : public View {
+public:
+	using Layout = wire::common::SET_GPS_GLOBAL_ORIGIN;
+	static constexpr mavlink::msgid_t MSG_ID = 48;
+
+	explicit SET_GPS_GLOBAL_ORIGIN(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t latitude() const { return load_field<int32_t>(0); }
+	int32_t longitude() const { return load_field<int32_t>(4); }
+	int32_t altitude() const { return load_field<int32_t>(8); }
+	uint8_t target_system() const { return load_field<uint8_t>(12); }
+	uint64_t time_usec() const { return load_field<uint64_t>(13); }
+};
+
+/**
+ * @brief GPS_GLOBAL_ORIGIN lazy view, fields are read from the payload on access
+ */
+class GPS_GLOBAL_ORIGIN : public View {
+public:
+	using Layout = wire::common::GPS_GLOBAL_ORIGIN;
+	static constexpr mavlink::msgid_t MSG_ID = 49;
+
+	explicit GPS_GLOBAL_ORIGIN(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t latitude() const { return load_field<int32_t>(0); }
+	int32_t longitude() const { return load_field<int32_t>(4); }
+	int32_t altitude() const { return load_field<int32_t>(8); }
+	uint64_t time_usec() const { return load_field<uint64_t>(12); }
+};
+
+/**
+ * @brief PARAM_MAP_RC lazy view, fields are read from the payload on access
+ */
+class PARAM_MAP_RC : public View {
+public:
+	using Layout = wire::common::PARAM_MAP_RC;
+	static constexpr mavlink::msgid_t MSG_ID = 50;
+
+	explicit PARAM_MAP_RC(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param_value0() const { return load_field<float>(0); }
+	float scale() const { return load_field<float>(4); }
+	float param_value_min() const { return load_field<float>(8); }
+	float param_value_max() const { return load_field<float>(12); }
+	int16_t param_index() const { return load_field<int16_t>(16); }
+	uint8_t target_system() const { return load_field<uint8_t>(18); }
+	uint8_t target_component() const { return load_field<uint8_t>(19); }
+	std::string param_id() const { return load_string(20, 16); }
+	char param_id(size_t i) const { return load_field<char>(20 + i * 1); }
+	uint8_t parameter_rc_channel_index() const { return load_field<uint8_t>(36); }
+};
+
+/**
+ * @brief MISSION_REQUEST_INT lazy view, fields are read from the payload on access
+ */
+class MISSION_REQUEST_INT : public View {
+public:
+	using Layout = wire::common::MISSION_REQUEST_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 51;
+
+	explicit MISSION_REQUEST_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seq() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t mission_type() const { return load_field<uint8_t>(4); }
+};
+
+/**
+ * @brief SAFETY_SET_ALLOWED_AREA lazy view, fields are read from the payload on access
+ */
+class SAFETY_SET_ALLOWED_AREA : public View {
+public:
+	using Layout = wire::common::SAFETY_SET_ALLOWED_AREA;
+	static constexpr mavlink::msgid_t MSG_ID = 54;
+
+	explicit SAFETY_SET_ALLOWED_AREA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float p1x() const { return load_field<float>(0); }
+	float p1y() const { return load_field<float>(4); }
+	float p1z() const { return load_field<float>(8); }
+	float p2x() const { return load_field<float>(12); }
+	float p2y() const { return load_field<float>(16); }
+	float p2z() const { return load_field<float>(20); }
+	uint8_t target_system() const { return load_field<uint8_t>(24); }
+	uint8_t target_component() const { return load_field<uint8_t>(25); }
+	uint8_t frame() const { return load_field<uint8_t>(26); }
+};
+
+/**
+ * @brief SAFETY_ALLOWED_AREA lazy view, fields are read from the payload on access
+ */
+class SAFETY_ALLOWED_AREA : public View {
+public:
+	using Layout = wire::common::SAFETY_ALLOWED_AREA;
+	static constexpr mavlink::msgid_t MSG_ID = 55;
+
+	explicit SAFETY_ALLOWED_AREA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float p1x() const { return load_field<float>(0); }
+	float p1y() const { return load_field<float>(4); }
+	float p1z() const { return load_field<float>(8); }
+	float p2x() const { return load_field<float>(12); }
+	float p2y() const { return load_field<float>(16); }
+	float p2z() const { return load_field<float>(20); }
+	uint8_t frame() const { return load_field<uint8_t>(24); }
+};
+
+/**
+ * @brief ATTITUDE_QUATERNION_COV lazy view, fields are read from the payload on access
+ */
+class ATTITUDE_QUATERNION_COV : public View {
+public:
+	using Layout = wire::common::ATTITUDE_QUATERNION_COV;
+	static constexpr mavlink::msgid_t MSG_ID = 61;
+
+	explicit ATTITUDE_QUATERNION_COV(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float q(size_t i) const { return load_field<float>(8 + i * 4); }
+	float rollspeed() const { return load_field<float>(24); }
+	float pitchspeed() const { return load_field<float>(28); }
+	float yawspeed() const { return load_field<float>(32); }
+	float covariance(size_t i) const { return load_field<float>(36 + i * 4); }
+};
+
+/**
+ * @brief NAV_CONTROLLER_OUTPUT lazy view, fields are read from the payload on access
+ */
+class NAV_CONTROLLER_OUTPUT : public View {
+public:
+	using Layout = wire::common::NAV_CONTROLLER_OUTPUT;
+	static constexpr mavlink::msgid_t MSG_ID = 62;
+
+	explicit NAV_CONTROLLER_OUTPUT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float nav_roll() const { return load_field<float>(0); }
+	float nav_pitch() const { return load_field<float>(4); }
+	float alt_error() const { return load_field<float>(8); }
+	float aspd_error() const { return load_field<float>(12); }
+	float xtrack_error() const { return load_field<float>(16); }
+	int16_t nav_bearing() const { return load_field<int16_t>(20); }
+	int16_t target_bearing() const { return load_field<int16_t>(22); }
+	uint16_t wp_dist() const { return load_field<uint16_t>(24); }
+};
+
+/**
+ * @brief GLOBAL_POSITION_INT_COV lazy view, fields are read from the payload on access
+ */
+class GLOBAL_POSITION_INT_COV : public View {
+public:
+	using Layout = wire::common::GLOBAL_POSITION_INT_COV;
+	static constexpr mavlink::msgid_t MSG_ID = 63;
+
+	explicit GLOBAL_POSITION_INT_COV(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(8); }
+	int32_t lon() const { return load_field<int32_t>(12); }
+	int32_t alt() const { return load_field<int32_t>(16); }
+	int32_t relative_alt() const { return load_field<int32_t>(20); }
+	float vx() const { return load_field<float>(24); }
+	float vy() const { return load_field<float>(28); }
+	float vz() const { return load_field<float>(32); }
+	float covariance(size_t i) const { return load_field<float>(36 + i * 4); }
+	uint8_t estimator_type() const { return load_field<uint8_t>(180); }
+};
+
+/**
+ * @brief LOCAL_POSITION_NED_COV lazy view, fields are read from the payload on access
+ */
+class LOCAL_POSITION_NED_COV : public View {
+public:
+	using Layout = wire::common::LOCAL_POSITION_NED_COV;
+	static constexpr mavlink::msgid_t MSG_ID = 64;
+
+	explicit LOCAL_POSITION_NED_COV(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+	float vx() const { return load_field<float>(20); }
+	float vy() const { return load_field<float>(24); }
+	float vz() const { return load_field<float>(28); }
+	float ax() const { return load_field<float>(32); }
+	float ay() const { return load_field<float>(36); }
+	float az() const { return load_field<float>(40); }
+	float covariance(size_t i) const { return load_field<float>(44 + i * 4); }
+	uint8_t estimator_type() const { return load_field<uint8_t>(224); }
+};
+
+/**
+ * @brief RC_CHANNELS lazy view, fields are read from the payload on access
+ */
+class RC_CHANNELS : public View {
+public:
+	using Layout = wire::common::RC_CHANNELS;
+	static constexpr mavlink::msgid_t MSG_ID = 65;
+
+	explicit RC_CHANNELS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint16_t chan1_raw() const { return load_field<uint16_t>(4); }
+	uint16_t chan2_raw() const { return load_field<uint16_t>(6); }
+	uint16_t chan3_raw() const { return load_field<uint16_t>(8); }
+	uint16_t chan4_raw() const { return load_field<uint16_t>(10); }
+	uint16_t chan5_raw() const { return load_field<uint16_t>(12); }
+	uint16_t chan6_raw() const { return load_field<uint16_t>(14); }
+	uint16_t chan7_raw() const { return load_field<uint16_t>(16); }
+	uint16_t chan8_raw() const { return load_field<uint16_t>(18); }
+	uint16_t chan9_raw() const { return load_field<uint16_t>(20); }
+	uint16_t chan10_raw() const { return load_field<uint16_t>(22); }
+	uint16_t chan11_raw() const { return load_field<uint16_t>(24); }
+	uint16_t chan12_raw() const { return load_field<uint16_t>(26); }
+	uint16_t chan13_raw() const { return load_field<uint16_t>(28); }
+	uint16_t chan14_raw() const { return load_field<uint16_t>(30); }
+	uint16_t chan15_raw() const { return load_field<uint16_t>(32); }
+	uint16_t chan16_raw() const { return load_field<uint16_t>(34); }
+	uint16_t chan17_raw() const { return load_field<uint16_t>(36); }
+	uint16_t chan18_raw() const { return load_field<uint16_t>(38); }
+	uint8_t chancount() const { return load_field<uint8_t>(40); }
+	uint8_t rssi() const { return load_field<uint8_t>(41); }
+};
+
+/**
+ * @brief REQUEST_DATA_STREAM lazy view, fields are read from the payload on access
+ */
+class REQUEST_DATA_STREAM : public View {
+public:
+	using Layout = wire::common::REQUEST_DATA_STREAM;
+	static constexpr mavlink::msgid_t MSG_ID = 66;
+
+	explicit REQUEST_DATA_STREAM(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t req_message_rate() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t req_stream_id() const { return load_field<uint8_t>(4); }
+	uint8_t start_stop() const { return load_field<uint8_t>(5); }
+};
+
+/**
+ * @brief DATA_STREAM lazy view, fields are read from the payload on access
+ */
+class DATA_STREAM : public View {
+public:
+	using Layout = wire::common::DATA_STREAM;
+	static constexpr mavlink::msgid_t MSG_ID = 67;
+
+	explicit DATA_STREAM(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t message_rate() const { return load_field<uint16_t>(0); }
+	uint8_t stream_id() const { return load_field<uint8_t>(2); }
+	uint8_t on_off() const { return load_field<uint8_t>(3); }
+};
+
+/**
+ * @brief MANUAL_CONTROL lazy view, fields are read from the payload on access
+ */
+class MANUAL_CONTROL : public View {
+public:
+	using Layout = wire::common::MANUAL_CONTROL;
+	static constexpr mavlink::msgid_t MSG_ID = 69;
+
+	explicit MANUAL_CONTROL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int16_t x() const { return load_field<int16_t>(0); }
+	int16_t y() const { return load_field<int16_t>(2); }
+	int16_t z() const { return load_field<int16_t>(4); }
+	int16_t r() const { return load_field<int16_t>(6); }
+	uint16_t buttons() const { return load_field<uint16_t>(8); }
+	uint8_t target() const { return load_field<uint8_t>(10); }
+};
+
+/**
+ * @brief RC_CHANNELS_OVERRIDE lazy view, fields are read from the payload on access
+ */
+class RC_CHANNELS_OVERRIDE : public View {
+public:
+	using Layout = wire::common::RC_CHANNELS_OVERRIDE;
+	static constexpr mavlink::msgid_t MSG_ID = 70;
+
+	explicit RC_CHANNELS_OVERRIDE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t chan1_raw() const { return load_field<uint16_t>(0); }
+	uint16_t chan2_raw() const { return load_field<uint16_t>(2); }
+	uint16_t chan3_raw() const { return load_field<uint16_t>(4); }
+	uint16_t chan4_raw() const { return load_field<uint16_t>(6); }
+	uint16_t chan5_raw() const { return load_field<uint16_t>(8); }
+	uint16_t chan6_raw() const { return load_field<uint16_t>(10); }
+	uint16_t chan7_raw() const { return load_field<uint16_t>(12); }
+	uint16_t chan8_raw() const { return load_field<uint16_t>(14); }
+	uint8_t target_system() const { return load_field<uint8_t>(16); }
+	uint8_t target_component() const { return load_field<uint8_t>(17); }
+};
+
+/**
+ * @brief MISSION_ITEM_INT lazy view, fields are read from the payload on access
+ */
+class MISSION_ITEM_INT : public View {
+public:
+	using Layout = wire::common::MISSION_ITEM_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 73;
+
+	explicit MISSION_ITEM_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param1() const { return load_field<float>(0); }
+	float param2() const { return load_field<float>(4); }
+	float param3() const { return load_field<float>(8); }
+	float param4() const { return load_field<float>(12); }
+	int32_t x() const { return load_field<int32_t>(16); }
+	int32_t y() const { return load_field<int32_t>(20); }
+	float z() const { return load_field<float>(24); }
+	uint16_t seq() const { return load_field<uint16_t>(28); }
+	uint16_t command() const { return load_field<uint16_t>(30); }
+	uint8_t target_system() const { return load_field<uint8_t>(32); }
+	uint8_t target_component() const { return load_field<uint8_t>(33); }
+	uint8_t frame() const { return load_field<uint8_t>(34); }
+	uint8_t current() const { return load_field<uint8_t>(35); }
+	uint8_t autocontinue() const { return load_field<uint8_t>(36); }
+	uint8_t mission_type() const { return load_field<uint8_t>(37); }
+};
+
+/**
+ * @brief VFR_HUD lazy view, fields are read from the payload on access
+ */
+class VFR_HUD : public View {
+public:
+	using Layout = wire::common::VFR_HUD;
+	static constexpr mavlink::msgid_t MSG_ID = 74;
+
+	explicit VFR_HUD(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float airspeed() const { return load_field<float>(0); }
+	float groundspeed() const { return load_field<float>(4); }
+	float alt() const { return load_field<float>(8); }
+	float climb() const { return load_field<float>(12); }
+	int16_t heading() const { return load_field<int16_t>(16); }
+	uint16_t throttle() const { return load_field<uint16_t>(18); }
+};
+
+/**
+ * @brief COMMAND_INT lazy view, fields are read from the payload on access
+ */
+class COMMAND_INT : public View {
+public:
+	using Layout = wire::common::COMMAND_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 75;
+
+	explicit COMMAND_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param1() const { return load_field<float>(0); }
+	float param2() const { return load_field<float>(4); }
+	float param3() const { return load_field<float>(8); }
+	float param4() const { return load_field<float>(12); }
+	int32_t x() const { return load_field<int32_t>(16); }
+	int32_t y() const { return load_field<int32_t>(20); }
+	float z() const { return load_field<float>(24); }
+	uint16_t command() const { return load_field<uint16_t>(28); }
+	uint8_t target_system() const { return load_field<uint8_t>(30); }
+	uint8_t target_component() const { return load_field<uint8_t>(31); }
+	uint8_t frame() const { return load_field<uint8_t>(32); }
+	uint8_t current() const { return load_field<uint8_t>(33); }
+	uint8_t autocontinue() const { return load_field<uint8_t>(34); }
+};
+
+/**
+ * @brief COMMAND_LONG lazy view, fields are read from the payload on access
+ */
+class COMMAND_LONG : public View {
+public:
+	using Layout = wire::common::COMMAND_LONG;
+	static constexpr mavlink::msgid_t MSG_ID = 76;
+
+	explicit COMMAND_LONG(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float param1() const { return load_field<float>(0); }
+	float param2() const { return load_field<float>(4); }
+	float param3() const { return load_field<float>(8); }
+	float param4() const { return load_field<float>(12); }
+	float param5() const { return load_field<float>(16); }
+	float param6() const { return load_field<float>(20); }
+	float param7() const { return load_field<float>(24); }
+	uint16_t command() const { return load_field<uint16_t>(28); }
+	uint8_t target_system() const { return load_field<uint8_t>(30); }
+	uint8_t target_component() const { return load_field<uint8_t>(31); }
+	uint8_t confirmation() const { return load_field<uint8_t>(32); }
+};
+
+/**
+ * @brief COMMAND_ACK lazy view, fields are read from the payload on access
+ */
+class COMMAND_ACK : public View {
+public:
+	using Layout = wire::common::COMMAND_ACK;
+	static constexpr mavlink::msgid_t MSG_ID = 77;
+
+	explicit COMMAND_ACK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t command() const { return load_field<uint16_t>(0); }
+	uint8_t result() const { return load_field<uint8_t>(2); }
+	uint8_t progress() const { return load_field<uint8_t>(3); }
+};
+
+/**
+ * @brief MANUAL_SETPOINT lazy view, fields are read from the payload on access
+ */
+class MANUAL_SETPOINT : public View {
+public:
+	using Layout = wire::common::MANUAL_SETPOINT;
+	static constexpr mavlink::msgid_t MSG_ID = 81;
+
+	explicit MANUAL_SETPOINT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float roll() const { return load_field<float>(4); }
+	float pitch() const { return load_field<float>(8); }
+	float yaw() const { return load_field<float>(12); }
+	float thrust() const { return load_field<float>(16); }
+	uint8_t mode_switch() const { return load_field<uint8_t>(20); }
+	uint8_t manual_override_switch() const { return load_field<uint8_t>(21); }
+};
+
+/**
+ * @brief SET_ATTITUDE_TARGET lazy view, fields are read from the payload on access
+ */
+class SET_ATTITUDE_TARGET : public View {
+public:
+	using Layout = wire::common::SET_ATTITUDE_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 82;
+
+	explicit SET_ATTITUDE_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float q(size_t i) const { return load_field<float>(4 + i * 4); }
+	float body_roll_rate() const { return load_field<float>(20); }
+	float body_pitch_rate() const { return load_field<float>(24); }
+	float body_yaw_rate() const { return load_field<float>(28); }
+	float thrust() const { return load_field<float>(32); }
+	uint8_t target_system() const { return load_field<uint8_t>(36); }
+	uint8_t target_component() const { return load_field<uint8_t>(37); }
+	uint8_t type_mask() const { return load_field<uint8_t>(38); }
+};
+
+/**
+ * @brief ATTITUDE_TARGET lazy view, fields are read from the payload on access
+ */
+class ATTITUDE_TARGET : public View {
+public:
+	using Layout = wire::common::ATTITUDE_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 83;
+
+	explicit ATTITUDE_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float q(size_t i) const { return load_field<float>(4 + i * 4); }
+	float body_roll_rate() const { return load_field<float>(20); }
+	float body_pitch_rate() const { return load_field<float>(24); }
+	float body_yaw_rate() const { return load_field<float>(28); }
+	float thrust() const { return load_field<float>(32); }
+	uint8_t type_mask() const { return load_field<uint8_t>(36); }
+};
+
+/**
+ * @brief SET_POSITION_TARGET_LOCAL_NED lazy view, fields are read from the payload on access
+ */
+class SET_POSITION_TARGET_LOCAL_NED : public View {
+public:
+	using Layout = wire::common::SET_POSITION_TARGET_LOCAL_NED;
+	static constexpr mavlink::msgid_t MSG_ID = 84;
+
+	explicit SET_POSITION_TARGET_LOCAL_NED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float x() const { return load_field<float>(4); }
+	float y() const { return load_field<float>(8); }
+	float z() const { return load_field<float>(12); }
+	float vx() const { return load_field<float>(16); }
+	float vy() const { return load_field<float>(20); }
+	float vz() const { return load_field<float>(24); }
+	float afx() const { return load_field<float>(28); }
+	float afy() const { return load_field<float>(32); }
+	float afz() const { return load_field<float>(36); }
+	float yaw() const { return load_field<float>(40); }
+	float yaw_rate() const { return load_field<float>(44); }
+	uint16_t type_mask() const { return load_field<uint16_t>(48); }
+	uint8_t target_system() const { return load_field<uint8_t>(50); }
+	uint8_t target_component() const { return load_field<uint8_t>(51); }
+	uint8_t coordinate_frame() const { return load_field<uint8_t>(52); }
+};
+
+/**
+ * @brief POSITION_TARGET_LOCAL_NED lazy view, fields are read from the payload on access
+ */
+class POSITION_TARGET_LOCAL_NED : public View {
+public:
+	using Layout = wire::common::POSITION_TARGET_LOCAL_NED;
+	static constexpr mavlink::msgid_t MSG_ID = 85;
+
+	explicit POSITION_TARGET_LOCAL_NED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float x() const { return load_field<float>(4); }
+	float y() const { return load_field<float>(8); }
+	float z() const { return load_field<float>(12); }
+	float vx() const { return load_field<float>(16); }
+	float vy() const { return load_field<float>(20); }
+	float vz() const { return load_field<float>(24); }
+	float afx() const { return load_field<float>(28); }
+	float afy() const { return load_field<float>(32); }
+	float afz() const { return load_field<float>(36); }
+	float yaw() const { return load_field<float>(40); }
+	float yaw_rate() const { return load_field<float>(44); }
+	uint16_t type_mask() const { return load_field<uint16_t>(48); }
+	uint8_t coordinate_frame() const { return load_field<uint8_t>(50); }
+};
+
+/**
+ * @brief SET_POSITION_TARGET_GLOBAL_INT lazy view, fields are read from the payload on access
+ */
+class SET_POSITION_TARGET_GLOBAL_INT : public View {
+public:
+	using Layout = wire::common::SET_POSITION_TARGET_GLOBAL_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 86;
+
+	explicit SET_POSITION_TARGET_GLOBAL_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int32_t lat_int() const { return load_field<int32_t>(4); }
+	int32_t lon_int() const { return load_field<int32_t>(8); }
+	float alt() const { return load_field<float>(12); }
+	float vx() const { return load_field<float>(16); }
+	float vy() const { return load_field<float>(20); }
+	float vz() const { return load_field<float>(24); }
+	float afx() const { return load_field<float>(28); }
+	float afy() const { return load_field<float>(32); }
+	float afz() const { return load_field<float>(36); }
+	float yaw() const { return load_field<float>(40); }
+	float yaw_rate() const { return load_field<float>(44); }
+	uint16_t type_mask() const { return load_field<uint16_t>(48); }
+	uint8_t target_system() const { return load_field<uint8_t>(50); }
+	uint8_t target_component() const { return load_field<uint8_t>(51); }
+	uint8_t coordinate_frame() const { return load_field<uint8_t>(52); }
+};
+
+/**
+ * @brief POSITION_TARGET_GLOBAL_INT lazy view, fields are read from the payload on access
+ */
+class POSITION_TARGET_GLOBAL_INT : public View {
+public:
+	using Layout = wire::common::POSITION_TARGET_GLOBAL_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 87;
+
+	explicit POSITION_TARGET_GLOBAL_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int32_t lat_int() const { return load_field<int32_t>(4); }
+	int32_t lon_int() const { return load_field<int32_t>(8); }
+	float alt() const { return load_field<float>(12); }
+	float vx() const { return load_field<float>(16); }
+	float vy() const { return load_field<float>(20); }
+	float vz() const { return load_field<float>(24); }
+	float afx() const { return load_field<float>(28); }
+	float afy() const { return load_field<float>(32); }
+	float afz() const { return load_field<float>(36); }
+	float yaw() const { return load_field<float>(40); }
+	float yaw_rate() const { return load_field<float>(44); }
+	uint16_t type_mask() const { return load_field<uint16_t>(48); }
+	uint8_t coordinate_frame() const { return load_field<uint8_t>(50); }
+};
+
+/**
+ * @brief LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET lazy view, fields are read from the payload on access
+ */
+class LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET : public View {
+public:
+	using Layout = wire::common::LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET;
+	static constexpr mavlink::msgid_t MSG_ID = 89;
+
+	explicit LOCAL_POSITION_NED_SYSTEM_GLOBAL_OFFSET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float x() const { return load_field<float>(4); }
+	float y() const { return load_field<float>(8); }
+	float z() const { return load_field<float>(12); }
+	float roll() const { return load_field<float>(16); }
+	float pitch() const { return load_field<float>(20); }
+	float yaw() const { return load_field<float>(24); }
+};
+
+/**
+ * @brief HIL_STATE lazy view, fields are read from the payload on access
+ */
+class HIL_STATE : public View {
+public:
+	using Layout = wire::common::HIL_STATE;
+	static constexpr mavlink::msgid_t MSG_ID = 90;
+
+	explicit HIL_STATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float roll() const { return load_field<float>(8); }
+	float pitch() const { return load_field<float>(12); }
+	float yaw() const { return load_field<float>(16); }
+	float rollspeed() const { return load_field<float>(20); }
+	float pitchspeed() const { return load_field<float>(24); }
+	float yawspeed() const { return load_field<float>(28); }
+	int32_t lat() const { return load_field<int32_t>(32); }
+	int32_t lon() const { return load_field<int32_t>(36); }
+	int32_t alt() const { return load_field<int32_t>(40); }
+	int16_t vx() const { return load_field<int16_t>(44); }
+	int16_t vy() const { return load_field<int16_t>(46); }
+	int16_t vz() const { return load_field<int16_t>(48); }
+	int16_t xacc() const { return load_field<int16_t>(50); }
+	int16_t yacc() const { return load_field<int16_t>(52); }
+	int16_t zacc() const { return load_field<int16_t>(54); }
+};
+
+/**
+ * @brief HIL_CONTROLS lazy view, fields are read from the payload on access
+ */
+class HIL_CONTROLS : public View {
+public:
+	using Layout = wire::common::HIL_CONTROLS;
+	static constexpr mavlink::msgid_t MSG_ID = 91;
+
+	explicit HIL_CONTROLS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float roll_ailerons() const { return load_field<float>(8); }
+	float pitch_elevator() const { return load_field<float>(12); }
+	float yaw_rudder() const { return load_field<float>(16); }
+	float throttle() const { return load_field<float>(20); }
+	float aux1() const { return load_field<float>(24); }
+	float aux2() const { return load_field<float>(28); }
+	float aux3() const { return load_field<float>(32); }
+	float aux4() const { return load_field<float>(36); }
+	uint8_t mode() const { return load_field<uint8_t>(40); }
+	uint8_t nav_mode() const { return load_field<uint8_t>(41); }
+};
+
+/**
+ * @brief HIL_RC_INPUTS_RAW lazy view, fields are read from the payload on access
+ */
+class HIL_RC_INPUTS_RAW : public View {
+public:
+	using Layout = wire::common::HIL_RC_INPUTS_RAW;
+	static constexpr mavlink::msgid_t MSG_ID = 92;
+
+	explicit HIL_RC_INPUTS_RAW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint16_t chan1_raw() const { return load_field<uint16_t>(8); }
+	uint16_t chan2_raw() const { return load_field<uint16_t>(10); }
+	uint16_t chan3_raw() const { return load_field<uint16_t>(12); }
+	uint16_t chan4_raw() const { return load_field<uint16_t>(14); }
+	uint16_t chan5_raw() const { return load_field<uint16_t>(16); }
+	uint16_t chan6_raw() const { return load_field<uint16_t>(18); }
+	uint16_t chan7_raw() const { return load_field<uint16_t>(20); }
+	uint16_t chan8_raw() const { return load_field<uint16_t>(22); }
+	uint16_t chan9_raw() const { return load_field<uint16_t>(24); }
+	uint16_t chan10_raw() const { return load_field<uint16_t>(26); }
+	uint16_t chan11_raw() const { return load_field<uint16_t>(28); }
+	uint16_t chan12_raw() const { return load_field<uint16_t>(30); }
+	uint8_t rssi() const { return load_field<uint8_t>(32); }
+};
+
+/**
+ * @brief HIL_ACTUATOR_CONTROLS lazy view, fields are read from the payload on access
+ */
+class HIL_ACTUATOR_CONTROLS : public View {
+public:
+	using Layout = wire::common::HIL_ACTUATOR_CONTROLS;
+	static constexpr mavlink::msgid_t MSG_ID = 93;
+
+	explicit HIL_ACTUATOR_CONTROLS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint64_t flags() const { return load_field<uint64_t>(8); }
+	float controls(size_t i) const { return load_field<float>(16 + i * 4); }
+	uint8_t mode() const { return load_field<uint8_t>(80); }
+};
+
+/**
+ * @brief OPTICAL_FLOW lazy view, fields are read from the payload on access
+ */
+class OPTICAL_FLOW : public View {
+public:
+	using Layout = wire::common::OPTICAL_FLOW;
+	static constexpr mavlink::msgid_t MSG_ID = 100;
+
+	explicit OPTICAL_FLOW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float flow_comp_m_x() const { return load_field<float>(8); }
+	float flow_comp_m_y() const { return load_field<float>(12); }
+	float ground_distance() const { return load_field<float>(16); }
+	int16_t flow_x() const { return load_field<int16_t>(20); }
+	int16_t flow_y() const { return load_field<int16_t>(22); }
+	uint8_t sensor_id() const { return load_field<uint8_t>(24); }
+	uint8_t quality() const { return load_field<uint8_t>(25); }
+	float flow_rate_x() const { return load_field<float>(26); }
+	float flow_rate_y() const { return load_field<float>(30); }
+};
+
+/**
+ * @brief GLOBAL_VISION_POSITION_ESTIMATE lazy view, fields are read from the payload on access
+ */
+class GLOBAL_VISION_POSITION_ESTIMATE : public View {
+public:
+	using Layout = wire::common::GLOBAL_VISION_POSITION_ESTIMATE;
+	static constexpr mavlink::msgid_t MSG_ID = 101;
+
+	explicit GLOBAL_VISION_POSITION_ESTIMATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+	float roll() const { return load_field<float>(20); }
+	float pitch() const { return load_field<float>(24); }
+	float yaw() const { return load_field<float>(28); }
+};
+
+/**
+ * @brief VISION_POSITION_ESTIMATE lazy view, fields are read from the payload on access
+ */
+class VISION_POSITION_ESTIMATE : public View {
+public:
+	using Layout = wire::common::VISION_POSITION_ESTIMATE;
+	static constexpr mavlink::msgid_t MSG_ID = 102;
+
+	explicit VISION_POSITION_ESTIMATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+	float roll() const { return load_field<float>(20); }
+	float pitch() const { return load_field<float>(24); }
+	float yaw() const { return load_field<float>(28); }
+};
+
+/**
+ * @brief VISION_SPEED_ESTIMATE lazy view, fields are read from the payload on access
+ */
+class VISION_SPEED_ESTIMATE : public View {
+public:
+	using Layout = wire::common::VISION_SPEED_ESTIMATE;
+	static constexpr mavlink::msgid_t MSG_ID = 103;
+
+	explicit VISION_SPEED_ESTIMATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+};
+
+/**
+ * @brief VICON_POSITION_ESTIMATE lazy view, fields are read from the payload on access
+ */
+class VICON_POSITION_ESTIMATE : public View {
+public:
+	using Layout = wire::common::VICON_POSITION_ESTIMATE;
+	static constexpr mavlink::msgid_t MSG_ID = 104;
+
+	explicit VICON_POSITION_ESTIMATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+	float roll() const { return load_field<float>(20); }
+	float pitch() const { return load_field<float>(24); }
+	float yaw() const { return load_field<float>(28); }
+};
+
+/**
+ * @brief HIGHRES_IMU lazy view, fields are read from the payload on access
+ */
+class HIGHRES_IMU : public View {
+public:
+	using Layout = wire::common::HIGHRES_IMU;
+	static constexpr mavlink::msgid_t MSG_ID = 105;
+
+	explicit HIGHRES_IMU(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float xacc() const { return load_field<float>(8); }
+	float yacc() const { return load_field<float>(12); }
+	float zacc() const { return load_field<float>(16); }
+	float xgyro() const { return load_field<float>(20); }
+	float ygyro() const { return load_field<float>(24); }
+	float zgyro() const { return load_field<float>(28); }
+	float xmag() const { return load_field<float>(32); }
+	float ymag() const { return load_field<float>(36); }
+	float zmag() const { return load_field<float>(40); }
+	float abs_pressure() const { return load_field<float>(44); }
+	float diff_pressure() const { return load_field<float>(48); }
+	float pressure_alt() const { return load_field<float>(52); }
+	float temperature() const { return load_field<float>(56); }
+	uint16_t fields_updated() const { return load_field<uint16_t>(60); }
+};
+
+/**
+ * @brief OPTICAL_FLOW_RAD lazy view, fields are read from the payload on access
+ */
+class OPTICAL_FLOW_RAD : public View {
+public:
+	using Layout = wire::common::OPTICAL_FLOW_RAD;
+	static constexpr mavlink::msgid_t MSG_ID = 106;
+
+	explicit OPTICAL_FLOW_RAD(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t integration_time_us() const { return load_field<uint32_t>(8); }
+	float integrated_x() const { return load_field<float>(12); }
+	float integrated_y() const { return load_field<float>(16); }
+	float integrated_xgyro() const { return load_field<float>(20); }
+	float integrated_ygyro() const { return load_field<float>(24); }
+	float integrated_zgyro() const { return load_field<float>(28); }
+	uint32_t time_delta_distance_us() const { return load_field<uint32_t>(32); }
+	float distance() const { return load_field<float>(36); }
+	int16_t temperature() const { return load_field<int16_t>(40); }
+	uint8_t sensor_id() const { return load_field<uint8_t>(42); }
+	uint8_t quality() const { return load_field<uint8_t>(43); }
+};
+
+/**
+ * @brief HIL_SENSOR lazy view, fields are read from the payload on access
+ */
+class HIL_SENSOR : public View {
+public:
+	using Layout = wire::common::HIL_SENSOR;
+	static constexpr mavlink::msgid_t MSG_ID = 107;
+
+	explicit HIL_SENSOR(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float xacc() const { return load_field<float>(8); }
+	float yacc() const { return load_field<float>(12); }
+	float zacc() const { return load_field<float>(16); }
+	float xgyro() const { return load_field<float>(20); }
+	float ygyro() const { return load_field<float>(24); }
+	float zgyro() const { return load_field<float>(28); }
+	float xmag() const { return load_field<float>(32); }
+	float ymag() const { return load_field<float>(36); }
+	float zmag() const { return load_field<float>(40); }
+	float abs_pressure() const { return load_field<float>(44); }
+	float diff_pressure() const { return load_field<float>(48); }
+	float pressure_alt() const { return load_field<float>(52); }
+	float temperature() const { return load_field<float>(56); }
+	uint32_t fields_updated() const { return load_field<uint32_t>(60); }
+};
+
+/**
+ * @brief SIM_STATE lazy view, fields are read from the payload on access
+ */
+class SIM_STATE : public View {
+public:
+	using Layout = wire::common::SIM_STATE;
+	static constexpr mavlink::msgid_t MSG_ID = 108;
+
+	explicit SIM_STATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float q1() const { return load_field<float>(0); }
+	float q2() const { return load_field<float>(4); }
+	float q3() const { return load_field<float>(8); }
+	float q4() const { return load_field<float>(12); }
+	float roll() const { return load_field<float>(16); }
+	float pitch() const { return load_field<float>(20); }
+	float yaw() const { return load_field<float>(24); }
+	float xacc() const { return load_field<float>(28); }
+	float yacc() const { return load_field<float>(32); }
+	float zacc() const { return load_field<float>(36); }
+	float xgyro() const { return load_field<float>(40); }
+	float ygyro() const { return load_field<float>(44); }
+	float zgyro() const { return load_field<float>(48); }
+	float lat() const { return load_field<float>(52); }
+	float lon() const { return load_field<float>(56); }
+	float alt() const { return load_field<float>(60); }
+	float std_dev_horz() const { return load_field<float>(64); }
+	float std_dev_vert() const { return load_field<float>(68); }
+	float vn() const { return load_field<float>(72); }
+	float ve() const { return load_field<float>(76); }
+	float vd() const { return load_field<float>(80); }
+};
+
+/**
+ * @brief RADIO_STATUS lazy view, fields are read from the payload on access
+ */
+class RADIO_STATUS : public View {
+public:
+	using Layout = wire::common::RADIO_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 109;
+
+	explicit RADIO_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t rxerrors() const { return load_field<uint16_t>(0); }
+	uint16_t fixed() const { return load_field<uint16_t>(2); }
+	uint8_t rssi() const { return load_field<uint8_t>(4); }
+	uint8_t remrssi() const { return load_field<uint8_t>(5); }
+	uint8_t txbuf() const { return load_field<uint8_t>(6); }
+	uint8_t noise() const { return load_field<uint8_t>(7); }
+	uint8_t remnoise() const { return load_field<uint8_t>(8); }
+};
+
+/**
+ * @brief FILE_TRANSFER_PROTOCOL lazy view, fields are read from the payload on access
+ */
+class FILE_TRANSFER_PROTOCOL : public View {
+public:
+	using Layout = wire::common::FILE_TRANSFER_PROTOCOL;
+	static constexpr mavlink::msgid_t MSG_ID = 110;
+
+	explicit FILE_TRANSFER_PROTOCOL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_network() const { return load_field<uint8_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(1); }
+	uint8_t target_component() const { return load_field<uint8_t>(2); }
+	uint8_t payload(size_t i) const { return load_field<uint8_t>(3 + i * 1); }
+};
+
+/**
+ * @brief TIMESYNC lazy view, fields are read from the payload on access
+ */
+class TIMESYNC : public View {
+public:
+	using Layout = wire::common::TIMESYNC;
+	static constexpr mavlink::msgid_t MSG_ID = 111;
+
+	explicit TIMESYNC(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int64_t tc1() const { return load_field<int64_t>(0); }
+	int64_t ts1() const { return load_field<int64_t>(8); }
+};
+
+/**
+ * @brief CAMERA_TRIGGER lazy view, fields are read from the payload on access
+ */
+class CAMERA_TRIGGER : public View {
+public:
+	using Layout = wire::common::CAMERA_TRIGGER;
+	static constexpr mavlink::msgid_t MSG_ID = 112;
+
+	explicit CAMERA_TRIGGER(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t seq() const { return load_field<uint32_t>(8); }
+};
+
+/**
+ * @brief HIL_GPS lazy view, fields are read from the payload on access
+ */
+class HIL_GPS : public View {
+public:
+	using Layout = wire::common::HIL_GPS;
+	static constexpr mavlink::msgid_t MSG_ID = 113;
+
+	explicit HIL_GPS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(8); }
+	int32_t lon() const { return load_field<int32_t>(12); }
+	int32_t alt() const { return load_field<int32_t>(16); }
+	uint16_t eph() const { return load_field<uint16_t>(20); }
+	uint16_t epv() const { return load_field<uint16_t>(22); }
+	uint16_t vel() const { return load_field<uint16_t>(24); }
+	int16_t vn() const { return load_field<int16_t>(26); }
+	int16_t ve() const { return load_field<int16_t>(28); }
+	int16_t vd() const { return load_field<int16_t>(30); }
+	uint16_t cog() const { return load_field<uint16_t>(32); }
+	uint8_t fix_type() const { return load_field<uint8_t>(34); }
+	uint8_t satellites_visible() const { return load_field<uint8_t>(35); }
+};
+
+/**
+ * @brief HIL_OPTICAL_FLOW lazy view, fields are read from the payload on access
+ */
+class HIL_OPTICAL_FLOW : public View {
+public:
+	using Layout = wire::common::HIL_OPTICAL_FLOW;
+	static constexpr mavlink::msgid_t MSG_ID = 114;
+
+	explicit HIL_OPTICAL_FLOW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t integration_time_us() const { return load_field<uint32_t>(8); }
+	float integrated_x() const { return load_field<float>(12); }
+	float integrated_y() const { return load_field<float>(16); }
+	float integrated_xgyro() const { return load_field<float>(20); }
+	float integrated_ygyro() const { return load_field<float>(24); }
+	float integrated_zgyro() const { return load_field<float>(28); }
+	uint32_t time_delta_distance_us() const { return load_field<uint32_t>(32); }
+	float distance() const { return load_field<float>(36); }
+	int16_t temperature() const { return load_field<int16_t>(40); }
+	uint8_t sensor_id() const { return load_field<uint8_t>(42); }
+	uint8_t quality() const { return load_field<uint8_t>(43); }
+};
+
+/**
+ * @brief HIL_STATE_QUATERNION lazy view, fields are read from the payload on access
+ */
+class HIL_STATE_QUATERNION : public View {
+public:
+	using Layout = wire::common::HIL_STATE_QUATERNION;
+	static constexpr mavlink::msgid_t MSG_ID = 115;
+
+	explicit HIL_STATE_QUATERNION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float attitude_quaternion(size_t i) const { return load_field<float>(8 + i * 4); }
+	float rollspeed() const { return load_field<float>(24); }
+	float pitchspeed() const { return load_field<float>(28); }
+	float yawspeed() const { return load_field<float>(32); }
+	int32_t lat() const { return load_field<int32_t>(36); }
+	int32_t lon() const { return load_field<int32_t>(40); }
+	int32_t alt() const { return load_field<int32_t>(44); }
+	int16_t vx() const { return load_field<int16_t>(48); }
+	int16_t vy() const { return load_field<int16_t>(50); }
+	int16_t vz() const { return load_field<int16_t>(52); }
+	uint16_t ind_airspeed() const { return load_field<uint16_t>(54); }
+	uint16_t true_airspeed() const { return load_field<uint16_t>(56); }
+	int16_t xacc() const { return load_field<int16_t>(58); }
+	int16_t yacc() const { return load_field<int16_t>(60); }
+	int16_t zacc() const { return load_field<int16_t>(62); }
+};
+
+/**
+ * @brief SCALED_IMU2 lazy view, fields are read from the payload on access
+ */
+class SCALED_IMU2 : public View {
+public:
+	using Layout = wire::common::SCALED_IMU2;
+	static constexpr mavlink::msgid_t MSG_ID = 116;
+
+	explicit SCALED_IMU2(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int16_t xacc() const { return load_field<int16_t>(4); }
+	int16_t yacc() const { return load_field<int16_t>(6); }
+	int16_t zacc() const { return load_field<int16_t>(8); }
+	int16_t xgyro() const { return load_field<int16_t>(10); }
+	int16_t ygyro() const { return load_field<int16_t>(12); }
+	int16_t zgyro() const { return load_field<int16_t>(14); }
+	int16_t xmag() const { return load_field<int16_t>(16); }
+	int16_t ymag() const { return load_field<int16_t>(18); }
+	int16_t zmag() const { return load_field<int16_t>(20); }
+};
+
+/**
+ * @brief LOG_REQUEST_LIST lazy view, fields are read from the payload on access
+ */
+class LOG_REQUEST_LIST : public View {
+public:
+	using Layout = wire::common::LOG_REQUEST_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 117;
+
+	explicit LOG_REQUEST_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t start() const { return load_field<uint16_t>(0); }
+	uint16_t end() const { return load_field<uint16_t>(2); }
+	uint8_t target_system() const { return load_field<uint8_t>(4); }
+	uint8_t target_component() const { return load_field<uint8_t>(5); }
+};
+
+/**
+ * @brief LOG_ENTRY lazy view, fields are read from the payload on access
+ */
+class LOG_ENTRY : public View {
+public:
+	using Layout = wire::common::LOG_ENTRY;
+	static constexpr mavlink::msgid_t MSG_ID = 118;
+
+	explicit LOG_ENTRY(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_utc() const { return load_field<uint32_t>(0); }
+	uint32_t size() const { return load_field<uint32_t>(4); }
+	uint16_t id() const { return load_field<uint16_t>(8); }
+	uint16_t num_logs() const { return load_field<uint16_t>(10); }
+	uint16_t last_log_num() const { return load_field<uint16_t>(12); }
+};
+
+/**
+ * @brief LOG_REQUEST_DATA lazy view, fields are read from the payload on access
+ */
+class LOG_REQUEST_DATA : public View {
+public:
+	using Layout = wire::common::LOG_REQUEST_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 119;
+
+	explicit LOG_REQUEST_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t ofs() const { return load_field<uint32_t>(0); }
+	uint32_t count() const { return load_field<uint32_t>(4); }
+	uint16_t id() const { return load_field<uint16_t>(8); }
+	uint8_t target_system() const { return load_field<uint8_t>(10); }
+	uint8_t target_component() const { return load_field<uint8_t>(11); }
+};
+
+/**
+ * @brief LOG_DATA lazy view, fields are read from the payload on access
+ */
+class LOG_DATA : public View {
+public:
+	using Layout = wire::common::LOG_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 120;
+
+	explicit LOG_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t ofs() const { return load_field<uint32_t>(0); }
+	uint16_t id() const { return load_field<uint16_t>(4); }
+	uint8_t count() const { return load_field<uint8_t>(6); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(7 + i * 1); }
+};
+
+/**
+ * @brief LOG_ERASE lazy view, fields are read from the payload on access
+ */
+class LOG_ERASE : public View {
+public:
+	using Layout = wire::common::LOG_ERASE;
+	static constexpr mavlink::msgid_t MSG_ID = 121;
+
+	explicit LOG_ERASE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+};
+
+/**
+ * @brief LOG_REQUEST_END lazy view, fields are read from the payload on access
+ */
+class LOG_REQUEST_END : public View {
+public:
+	using Layout = wire::common::LOG_REQUEST_END;
+	static constexpr mavlink::msgid_t MSG_ID = 122;
+
+	explicit LOG_REQUEST_END(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+};
+
+/**
+ * @brief GPS_INJECT_DATA lazy view, fields are read from the payload on access
+ */
+class GPS_INJECT_DATA : public View {
+public:
+	using Layout = wire::common::GPS_INJECT_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 123;
+
+	explicit GPS_INJECT_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	uint8_t len() const { return load_field<uint8_t>(2); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(3 + i * 1); }
+};
+
+/**
+ * @brief GPS2_RAW lazy view, fields are read from the payload on access
+ */
+class GPS2_RAW : public View {
+public:
+	using Layout = wire::common::GPS2_RAW;
+	static constexpr mavlink::msgid_t MSG_ID = 124;
+
+	explicit GPS2_RAW(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(8); }
+	int32_t lon() const { return load_field<int32_t>(12); }
+	int32_t alt() const { return load_field<int32_t>(16); }
+	uint32_t dgps_age() const { return load_field<uint32_t>(20); }
+	uint16_t eph() const { return load_field<uint16_t>(24); }
+	uint16_t epv() const { return load_field<uint16_t>(26); }
+	uint16_t vel() const { return load_field<uint16_t>(28); }
+	uint16_t cog() const { return load_field<uint16_t>(30); }
+	uint8_t fix_type() const { return load_field<uint8_t>(32); }
+	uint8_t satellites_visible() const { return load_field<uint8_t>(33); }
+	uint8_t dgps_numch() const { return load_field<uint8_t>(34); }
+};
+
+/**
+ * @brief POWER_STATUS lazy view, fields are read from the payload on access
+ */
+class POWER_STATUS : public View {
+public:
+	using Layout = wire::common::POWER_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 125;
+
+	explicit POWER_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t Vcc() const { return load_field<uint16_t>(0); }
+	uint16_t Vservo() const { return load_field<uint16_t>(2); }
+	uint16_t flags() const { return load_field<uint16_t>(4); }
+};
+
+/**
+ * @brief SERIAL_CONTROL lazy view, fields are read from the payload on access
+ */
+class SERIAL_CONTROL : public View {
+public:
+	using Layout = wire::common::SERIAL_CONTROL;
+	static constexpr mavlink::msgid_t MSG_ID = 126;
+
+	explicit SERIAL_CONTROL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t baudrate() const { return load_field<uint32_t>(0); }
+	uint16_t timeout() const { return load_field<uint16_t>(4); }
+	uint8_t device() const { return load_field<uint8_t>(6); }
+	uint8_t flags() const { return load_field<uint8_t>(7); }
+	uint8_t count() const { return load_field<uint8_t>(8); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(9 + i * 1); }
+};
+
+/**
+ * @brief GPS_RTK lazy view, fields are read from the payload on access
+ */
+class GPS_RTK : public View {
+public:
+	using Layout = wire::common::GPS_RTK;
+	static constexpr mavlink::msgid_t MSG_ID = 127;
+
+	explicit GPS_RTK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_last_baseline_ms() const { return load_field<uint32_t>(0); }
+	uint32_t tow() const { return load_field<uint32_t>(4); }
+	int32_t baseline_a_mm() const { return load_field<int32_t>(8); }
+	int32_t baseline_b_mm() const { return load_field<int32_t>(12); }
+	int32_t baseline_c_mm() const { return load_field<int32_t>(16); }
+	uint32_t accuracy() const { return load_field<uint32_t>(20); }
+	int32_t iar_num_hypotheses() const { return load_field<int32_t>(24); }
+	uint16_t wn() const { return load_field<uint16_t>(28); }
+	uint8_t rtk_receiver_id() const { return load_field<uint8_t>(30); }
+	uint8_t rtk_health() const { return load_field<uint8_t>(31); }
+	uint8_t rtk_rate() const { return load_field<uint8_t>(32); }
+	uint8_t nsats() const { return load_field<uint8_t>(33); }
+	uint8_t baseline_coords_type() const { return load_field<uint8_t>(34); }
+};
+
+/**
+ * @brief GPS2_RTK lazy view, fields are read from the payload on access
+ */
+class GPS2_RTK : public View {
+public:
+	using Layout = wire::common::GPS2_RTK;
+	static constexpr mavlink::msgid_t MSG_ID = 128;
+
+	explicit GPS2_RTK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_last_baseline_ms() const { return load_field<uint32_t>(0); }
+	uint32_t tow() const { return load_field<uint32_t>(4); }
+	int32_t baseline_a_mm() const { return load_field<int32_t>(8); }
+	int32_t baseline_b_mm() const { return load_field<int32_t>(12); }
+	int32_t baseline_c_mm() const { return load_field<int32_t>(16); }
+	uint32_t accuracy() const { return load_field<uint32_t>(20); }
+	int32_t iar_num_hypotheses() const { return load_field<int32_t>(24); }
+	uint16_t wn() const { return load_field<uint16_t>(28); }
+	uint8_t rtk_receiver_id() const { return load_field<uint8_t>(30); }
+	uint8_t rtk_health() const { return load_field<uint8_t>(31); }
+	uint8_t rtk_rate() const { return load_field<uint8_t>(32); }
+	uint8_t nsats() const { return load_field<uint8_t>(33); }
+	uint8_t baseline_coords_type() const { return load_field<uint8_t>(34); }
+};
+
+/**
+ * @brief SCALED_IMU3 lazy view, fields are read from the payload on access
+ */
+class SCALED_IMU3 : public View {
+public:
+	using Layout = wire::common::SCALED_IMU3;
+	static constexpr mavlink::msgid_t MSG_ID = 129;
+
+	explicit SCALED_IMU3(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int16_t xacc() const { return load_field<int16_t>(4); }
+	int16_t yacc() const { return load_field<int16_t>(6); }
+	int16_t zacc() const { return load_field<int16_t>(8); }
+	int16_t xgyro() const { return load_field<int16_t>(10); }
+	int16_t ygyro() const { return load_field<int16_t>(12); }
+	int16_t zgyro() const { return load_field<int16_t>(14); }
+	int16_t xmag() const { return load_field<int16_t>(16); }
+	int16_t ymag() const { return load_field<int16_t>(18); }
+	int16_t zmag() const { return load_field<int16_t>(20); }
+};
+
+/**
+ * @brief DATA_TRANSMISSION_HANDSHAKE lazy view, fields are read from the payload on access
+ */
+class DATA_TRANSMISSION_HANDSHAKE : public View {
+public:
+	using Layout = wire::common::DATA_TRANSMISSION_HANDSHAKE;
+	static constexpr mavlink::msgid_t MSG_ID = 130;
+
+	explicit DATA_TRANSMISSION_HANDSHAKE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t size() const { return load_field<uint32_t>(0); }
+	uint16_t width() const { return load_field<uint16_t>(4); }
+	uint16_t height() const { return load_field<uint16_t>(6); }
+	uint16_t packets() const { return load_field<uint16_t>(8); }
+	uint8_t type() const { return load_field<uint8_t>(10); }
+	uint8_t payload() const { return load_field<uint8_t>(11); }
+	uint8_t jpg_quality() const { return load_field<uint8_t>(12); }
+};
+
+/**
+ * @brief ENCAPSULATED_DATA lazy view, fields are read from the payload on access
+ */
+class ENCAPSULATED_DATA : public View {
+public:
+	using Layout = wire::common::ENCAPSULATED_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 131;
+
+	explicit ENCAPSULATED_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t seqnr() const { return load_field<uint16_t>(0); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(2 + i * 1); }
+};
+
+/**
+ * @brief DISTANCE_SENSOR lazy view, fields are read from the payload on access
+ */
+class DISTANCE_SENSOR : public View {
+public:
+	using Layout = wire::common::DISTANCE_SENSOR;
+	static constexpr mavlink::msgid_t MSG_ID = 132;
+
+	explicit DISTANCE_SENSOR(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint16_t min_distance() const { return load_field<uint16_t>(4); }
+	uint16_t max_distance() const { return load_field<uint16_t>(6); }
+	uint16_t current_distance() const { return load_field<uint16_t>(8); }
+	uint8_t type() const { return load_field<uint8_t>(10); }
+	uint8_t id() const { return load_field<uint8_t>(11); }
+	uint8_t orientation() const { return load_field<uint8_t>(12); }
+	uint8_t covariance() const { return load_field<uint8_t>(13); }
+};
+
+/**
+ * @brief TERRAIN_REQUEST lazy view, fields are read from the payload on access
+ */
+class TERRAIN_REQUEST : public View {
+public:
+	using Layout = wire::common::TERRAIN_REQUEST;
+	static constexpr mavlink::msgid_t MSG_ID = 133;
+
+	explicit TERRAIN_REQUEST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t mask() const { return load_field<uint64_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(8); }
+	int32_t lon() const { return load_field<int32_t>(12); }
+	uint16_t grid_spacing() const { return load_field<uint16_t>(16); }
+};
+
+/**
+ * @brief TERRAIN_DATA lazy view, fields are read from the payload on access
+ */
+class TERRAIN_DATA : public View {
+public:
+	using Layout = wire::common::TERRAIN_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 134;
+
+	explicit TERRAIN_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t lat() const { return load_field<int32_t>(0); }
+	int32_t lon() const { return load_field<int32_t>(4); }
+	uint16_t grid_spacing() const { return load_field<uint16_t>(8); }
+	int16_t data(size_t i) const { return load_field<int16_t>(10 + i * 2); }
+	uint8_t gridbit() const { return load_field<uint8_t>(42); }
+};
+
+/**
+ * @brief TERRAIN_CHECK lazy view, fields are read from the payload on access
+ */
+class TERRAIN_CHECK : public View {
+public:
+	using Layout = wire::common::TERRAIN_CHECK;
+	static constexpr mavlink::msgid_t MSG_ID = 135;
+
+	explicit TERRAIN_CHECK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t lat() const { return load_field<int32_t>(0); }
+	int32_t lon() const { return load_field<int32_t>(4); }
+};
+
+/**
+ * @brief TERRAIN_REPORT lazy view, fields are read from the payload on access
+ */
+class TERRAIN_REPORT : public View {
+public:
+	using Layout = wire::common::TERRAIN_REPORT;
+	static constexpr mavlink::msgid_t MSG_ID = 136;
+
+	explicit TERRAIN_REPORT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t lat() const { return load_field<int32_t>(0); }
+	int32_t lon() const { return load_field<int32_t>(4); }
+	float terrain_height() const { return load_field<float>(8); }
+	float current_height() const { return load_field<float>(12); }
+	uint16_t spacing() const { return load_field<uint16_t>(16); }
+	uint16_t pending() const { return load_field<uint16_t>(18); }
+	uint16_t loaded() const { return load_field<uint16_t>(20); }
+};
+
+/**
+ * @brief SCALED_PRESSURE2 lazy view, fields are read from the payload on access
+ */
+class SCALED_PRESSURE2 : public View {
+public:
+	using Layout = wire::common::SCALED_PRESSURE2;
+	static constexpr mavlink::msgid_t MSG_ID = 137;
+
+	explicit SCALED_PRESSURE2(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float press_abs() const { return load_field<float>(4); }
+	float press_diff() const { return load_field<float>(8); }
+	int16_t temperature() const { return load_field<int16_t>(12); }
+};
+
+/**
+ * @brief ATT_POS_MOCAP lazy view, fields are read from the payload on access
+ */
+class ATT_POS_MOCAP : public View {
+public:
+	using Layout = wire::common::ATT_POS_MOCAP;
+	static constexpr mavlink::msgid_t MSG_ID = 138;
+
+	explicit ATT_POS_MOCAP(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float q(size_t i) const { return load_field<float>(8 + i * 4); }
+	float x() const { return load_field<float>(24); }
+	float y() const { return load_field<float>(28); }
+	float z() const { return load_field<float>(32); }
+};
+
+/**
+ * @brief SET_ACTUATOR_CONTROL_TARGET lazy view, fields are read from the payload on access
+ */
+class SET_ACTUATOR_CONTROL_TARGET : public View {
+public:
+	using Layout = wire::common::SET_ACTUATOR_CONTROL_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 139;
+
+	explicit SET_ACTUATOR_CONTROL_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float controls(size_t i) const { return load_field<float>(8 + i * 4); }
+	uint8_t group_mlx() const { return load_field<uint8_t>(40); }
+	uint8_t target_system() const { return load_field<uint8_t>(41); }
+	uint8_t target_component() const { return load_field<uint8_t>(42); }
+};
+
+/**
+ * @brief ACTUATOR_CONTROL_TARGET lazy view, fields are read from the payload on access
+ */
+class ACTUATOR_CONTROL_TARGET : public View {
+public:
+	using Layout = wire::common::ACTUATOR_CONTROL_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 140;
+
+	explicit ACTUATOR_CONTROL_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float controls(size_t i) const { return load_field<float>(8 + i * 4); }
+	uint8_t group_mlx() const { return load_field<uint8_t>(40); }
+};
+
+/**
+ * @brief ALTITUDE lazy view, fields are read from the payload on access
+ */
+class ALTITUDE : public View {
+public:
+	using Layout = wire::common::ALTITUDE;
+	static constexpr mavlink::msgid_t MSG_ID = 141;
+
+	explicit ALTITUDE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float altitude_monotonic() const { return load_field<float>(8); }
+	float altitude_amsl() const { return load_field<float>(12); }
+	float altitude_local() const { return load_field<float>(16); }
+	float altitude_relative() const { return load_field<float>(20); }
+	float altitude_terrain() const { return load_field<float>(24); }
+	float bottom_clearance() const { return load_field<float>(28); }
+};
+
+/**
+ * @brief RESOURCE_REQUEST lazy view, fields are read from the payload on access
+ */
+class RESOURCE_REQUEST : public View {
+public:
+	using Layout = wire::common::RESOURCE_REQUEST;
+	static constexpr mavlink::msgid_t MSG_ID = 142;
+
+	explicit RESOURCE_REQUEST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t request_id() const { return load_field<uint8_t>(0); }
+	uint8_t uri_type() const { return load_field<uint8_t>(1); }
+	uint8_t uri(size_t i) const { return load_field<uint8_t>(2 + i * 1); }
+	uint8_t transfer_type() const { return load_field<uint8_t>(122); }
+	uint8_t storage(size_t i) const { return load_field<uint8_t>(123 + i * 1); }
+};
+
+/**
+ * @brief SCALED_PRESSURE3 lazy view, fields are read from the payload on access
+ */
+class SCALED_PRESSURE3 : public View {
+public:
+	using Layout = wire::common::SCALED_PRESSURE3;
+	static constexpr mavlink::msgid_t MSG_ID = 143;
+
+	explicit SCALED_PRESSURE3(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float press_abs() const { return load_field<float>(4); }
+	float press_diff() const { return load_field<float>(8); }
+	int16_t temperature() const { return load_field<int16_t>(12); }
+};
+
+/**
+ * @brief FOLLOW_TARGET lazy view, fields are read from the payload on access
+ */
+class FOLLOW_TARGET : public View {
+public:
+	using Layout = wire::common::FOLLOW_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 144;
+
+	explicit FOLLOW_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t timestamp() const { return load_field<uint64_t>(0); }
+	uint64_t custom_state() const { return load_field<uint64_t>(8); }
+	int32_t lat() const { return load_field<int32_t>(16); }
+	int32_t lon() const { return load_field<int32_t>(20); }
+	float alt() const { return load_field<float>(24); }
+	float vel(size_t i) const { return load_field<float>(28 + i * 4); }
+	float acc(size_t i) const { return load_field<float>(40 + i * 4); }
+	float attitude_q(size_t i) const { return load_field<float>(52 + i * 4); }
+	float rates(size_t i) const { return load_field<float>(68 + i * 4); }
+	float position_cov(size_t i) const { return load_field<float>(80 + i * 4); }
+	uint8_t est_capabilities() const { return load_field<uint8_t>(92); }
+};
+
+/**
+ * @brief CONTROL_SYSTEM_STATE lazy view, fields are read from the payload on access
+ */
+class CONTROL_SYSTEM_STATE : public View {
+public:
+	using Layout = wire::common::CONTROL_SYSTEM_STATE;
+	static constexpr mavlink::msgid_t MSG_ID = 146;
+
+	explicit CONTROL_SYSTEM_STATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float x_acc() const { return load_field<float>(8); }
+	float y_acc() const { return load_field<float>(12); }
+	float z_acc() const { return load_field<float>(16); }
+	float x_vel() const { return load_field<float>(20); }
+	float y_vel() const { return load_field<float>(24); }
+	float z_vel() const { return load_field<float>(28); }
+	float x_pos() const { return load_field<float>(32); }
+	float y_pos() const { return load_field<float>(36); }
+	float z_pos() const { return load_field<float>(40); }
+	float airspeed() const { return load_field<float>(44); }
+	float vel_variance(size_t i) const { return load_field<float>(48 + i * 4); }
+	float pos_variance(size_t i) const { return load_field<float>(60 + i * 4); }
+	float q(size_t i) const { return load_field<float>(72 + i * 4); }
+	float roll_rate() const { return load_field<float>(88); }
+	float pitch_rate() const { return load_field<float>(92); }
+	float yaw_rate() const { return load_field<float>(96); }
+};
+
+/**
+ * @brief BATTERY_STATUS lazy view, fields are read from the payload on access
+ */
+class BATTERY_STATUS : public View {
+public:
+	using Layout = wire::common::BATTERY_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 147;
+
+	explicit BATTERY_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t current_consumed() const { return load_field<int32_t>(0); }
+	int32_t energy_consumed() const { return load_field<int32_t>(4); }
+	int16_t temperature() const { return load_field<int16_t>(8); }
+	uint16_t voltages(size_t i) const { return load_field<uint16_t>(10 + i * 2); }
+	int16_t current_battery() const { return load_field<int16_t>(30); }
+	uint8_t id() const { return load_field<uint8_t>(32); }
+	uint8_t battery_function() const { return load_field<uint8_t>(33); }
+	uint8_t type() const { return load_field<uint8_t>(34); }
+	int8_t battery_remaining() const { return load_field<int8_t>(35); }
+};
+
+/**
+ * @brief AUTOPILOT_VERSION lazy view, fields are read from the payload on access
+ */
+class AUTOPILOT_VERSION : public View {
+public:
+	using Layout = wire::common::AUTOPILOT_VERSION;
+	static constexpr mavlink::msgid_t MSG_ID = 148;
+
+	explicit AUTOPILOT_VERSION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t capabilities() const { return load_field<uint64_t>(0); }
+	uint64_t uid() const { return load_field<uint64_t>(8); }
+	uint32_t flight_sw_version() const { return load_field<uint32_t>(16); }
+	uint32_t middleware_sw_version() const { return load_field<uint32_t>(20); }
+	uint32_t os_sw_version() const { return load_field<uint32_t>(24); }
+	uint32_t board_version() const { return load_field<uint32_t>(28); }
+	uint16_t vendor_id() const { return load_field<uint16_t>(32); }
+	uint16_t product_id() const { return load_field<uint16_t>(34); }
+	uint8_t flight_custom_version(size_t i) const { return load_field<uint8_t>(36 + i * 1); }
+	uint8_t middleware_custom_version(size_t i) const { return load_field<uint8_t>(44 + i * 1); }
+	uint8_t os_custom_version(size_t i) const { return load_field<uint8_t>(52 + i * 1); }
+};
+
+/**
+ * @brief LANDING_TARGET lazy view, fields are read from the payload on access
+ */
+class LANDING_TARGET : public View {
+public:
+	using Layout = wire::common::LANDING_TARGET;
+	static constexpr mavlink::msgid_t MSG_ID = 149;
+
+	explicit LANDING_TARGET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float angle_x() const { return load_field<float>(8); }
+	float angle_y() const { return load_field<float>(12); }
+	float distance() const { return load_field<float>(16); }
+	float size_x() const { return load_field<float>(20); }
+	float size_y() const { return load_field<float>(24); }
+	uint8_t target_num() const { return load_field<uint8_t>(28); }
+	uint8_t frame() const { return load_field<uint8_t>(29); }
+	float x() const { return load_field<float>(30); }
+	float y() const { return load_field<float>(34); }
+	float z() const { return load_field<float>(38); }
+	float q(size_t i) const { return load_field<float>(42 + i * 4); }
+	uint8_t type() const { return load_field<uint8_t>(58); }
+	uint8_t position_valid() const { return load_field<uint8_t>(59); }
+};
+
+/**
+ * @brief ESTIMATOR_STATUS lazy view, fields are read from the payload on access
+ */
+class ESTIMATOR_STATUS : public View {
+public:
+	using Layout = wire::common::ESTIMATOR_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 230;
+
+	explicit ESTIMATOR_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float vel_ratio() const { return load_field<float>(8); }
+	float pos_horiz_ratio() const { return load_field<float>(12); }
+	float pos_vert_ratio() const { return load_field<float>(16); }
+	float mag_ratio() const { return load_field<float>(20); }
+	float hagl_ratio() const { return load_field<float>(24); }
+	float tas_ratio() const { return load_field<float>(28); }
+	float pos_horiz_accuracy() const { return load_field<float>(32); }
+	float pos_vert_accuracy() const { return load_field<float>(36); }
+	uint16_t flags() const { return load_field<uint16_t>(40); }
+};
+
+/**
+ * @brief WIND_COV lazy view, fields are read from the payload on access
+ */
+class WIND_COV : public View {
+public:
+	using Layout = wire::common::WIND_COV;
+	static constexpr mavlink::msgid_t MSG_ID = 231;
+
+	explicit WIND_COV(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float wind_x() const { return load_field<float>(8); }
+	float wind_y() const { return load_field<float>(12); }
+	float wind_z() const { return load_field<float>(16); }
+	float var_horiz() const { return load_field<float>(20); }
+	float var_vert() const { return load_field<float>(24); }
+	float wind_alt() const { return load_field<float>(28); }
+	float horiz_accuracy() const { return load_field<float>(32); }
+	float vert_accuracy() const { return load_field<float>(36); }
+};
+
+/**
+ * @brief GPS_INPUT lazy view, fields are read from the payload on access
+ */
+class GPS_INPUT : public View {
+public:
+	using Layout = wire::common::GPS_INPUT;
+	static constexpr mavlink::msgid_t MSG_ID = 232;
+
+	explicit GPS_INPUT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t time_week_ms() const { return load_field<uint32_t>(8); }
+	int32_t lat() const { return load_field<int32_t>(12); }
+	int32_t lon() const { return load_field<int32_t>(16); }
+	float alt() const { return load_field<float>(20); }
+	float hdop() const { return load_field<float>(24); }
+	float vdop() const { return load_field<float>(28); }
+	float vn() const { return load_field<float>(32); }
+	float ve() const { return load_field<float>(36); }
+	float vd() const { return load_field<float>(40); }
+	float speed_accuracy() const { return load_field<float>(44); }
+	float horiz_accuracy() const { return load_field<float>(48); }
+	float vert_accuracy() const { return load_field<float>(52); }
+	uint16_t ignore_flags() const { return load_field<uint16_t>(56); }
+	uint16_t time_week() const { return load_field<uint16_t>(58); }
+	uint8_t gps_id() const { return load_field<uint8_t>(60); }
+	uint8_t fix_type() const { return load_field<uint8_t>(61); }
+	uint8_t satellites_visible() const { return load_field<uint8_t>(62); }
+};
+
+/**
+ * @brief GPS_RTCM_DATA lazy view, fields are read from the payload on access
+ */
+class GPS_RTCM_DATA : public View {
+public:
+	using Layout = wire::common::GPS_RTCM_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 233;
+
+	explicit GPS_RTCM_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t flags() const { return load_field<uint8_t>(0); }
+	uint8_t len() const { return load_field<uint8_t>(1); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(2 + i * 1); }
+};
+
+/**
+ * @brief HIGH_LATENCY lazy view, fields are read from the payload on access
+ */
+class HIGH_LATENCY : public View {
+public:
+	using Layout = wire::common::HIGH_LATENCY;
+	static constexpr mavlink::msgid_t MSG_ID = 234;
+
+	explicit HIGH_LATENCY(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t custom_mode() const { return load_field<uint32_t>(0); }
+	int32_t latitude() const { return load_field<int32_t>(4); }
+	int32_t longitude() const { return load_field<int32_t>(8); }
+	int16_t roll() const { return load_field<int16_t>(12); }
+	int16_t pitch() const { return load_field<int16_t>(14); }
+	uint16_t heading() const { return load_field<uint16_t>(16); }
+	int16_t heading_sp() const { return load_field<int16_t>(18); }
+	int16_t altitude_amsl() const { return load_field<int16_t>(20); }
+	int16_t altitude_sp() const { return load_field<int16_t>(22); }
+	uint16_t wp_distance() const { return load_field<uint16_t>(24); }
+	uint8_t base_mode() const { return load_field<uint8_t>(26); }
+	uint8_t landed_state() const { return load_field<uint8_t>(27); }
+	int8_t throttle() const { return load_field<int8_t>(28); }
+	uint8_t airspeed() const { return load_field<uint8_t>(29); }
+	uint8_t airspeed_sp() const { return load_field<uint8_t>(30); }
+	uint8_t groundspeed() const { return load_field<uint8_t>(31); }
+	int8_t climb_rate() const { return load_field<int8_t>(32); }
+	uint8_t gps_nsat() const { return load_field<uint8_t>(33); }
+	uint8_t gps_fix_type() const { return load_field<uint8_t>(34); }
+	uint8_t battery_remaining() const { return load_field<uint8_t>(35); }
+	int8_t temperature() const { return load_field<int8_t>(36); }
+	int8_t temperature_air() const { return load_field<int8_t>(37); }
+	uint8_t failsafe() const { return load_field<uint8_t>(38); }
+	uint8_t wp_num() const { return load_field<uint8_t>(39); }
+};
+
+/**
+ * @brief VIBRATION lazy view, fields are read from the payload on access
+ */
+class VIBRATION : public View {
+public:
+	using Layout = wire::common::VIBRATION;
+	static constexpr mavlink::msgid_t MSG_ID = 241;
+
+	explicit VIBRATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float vibration_x() const { return load_field<float>(8); }
+	float vibration_y() const { return load_field<float>(12); }
+	float vibration_z() const { return load_field<float>(16); }
+	uint32_t clipping_0() const { return load_field<uint32_t>(20); }
+	uint32_t clipping_1() const { return load_field<uint32_t>(24); }
+	uint32_t clipping_2() const { return load_field<uint32_t>(28); }
+};
+
+/**
+ * @brief HOME_POSITION lazy view, fields are read from the payload on access
+ */
+class HOME_POSITION : public View {
+public:
+	using Layout = wire::common::HOME_POSITION;
+	static constexpr mavlink::msgid_t MSG_ID = 242;
+
+	explicit HOME_POSITION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t latitude() const { return load_field<int32_t>(0); }
+	int32_t longitude() const { return load_field<int32_t>(4); }
+	int32_t altitude() const { return load_field<int32_t>(8); }
+	float x() const { return load_field<float>(12); }
+	float y() const { return load_field<float>(16); }
+	float z() const { return load_field<float>(20); }
+	float q(size_t i) const { return load_field<float>(24 + i * 4); }
+	float approach_x() const { return load_field<float>(40); }
+	float approach_y() const { return load_field<float>(44); }
+	float approach_z() const { return load_field<float>(48); }
+	uint64_t time_usec() const { return load_field<uint64_t>(52); }
+};
+
+/**
+ * @brief SET_HOME_POSITION lazy view, fields are read from the payload on access
+ */
+class SET_HOME_POSITION : public View {
+public:
+	using Layout = wire::common::SET_HOME_POSITION;
+	static constexpr mavlink::msgid_t MSG_ID = 243;
+
+	explicit SET_HOME_POSITION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t latitude() const { return load_field<int32_t>(0); }
+	int32_t longitude() const { return load_field<int32_t>(4); }
+	int32_t altitude() const { return load_field<int32_t>(8); }
+	float x() const { return load_field<float>(12); }
+	float y() const { return load_field<float>(16); }
+	float z() const { return load_field<float>(20); }
+	float q(size_t i) const { return load_field<float>(24 + i * 4); }
+	float approach_x() const { return load_field<float>(40); }
+	float approach_y() const { return load_field<float>(44); }
+	float approach_z() const { return load_field<float>(48); }
+	uint8_t target_system() const { return load_field<uint8_t>(52); }
+	uint64_t time_usec() const { return load_field<uint64_t>(53); }
+};
+
+/**
+ * @brief MESSAGE_INTERVAL lazy view, fields are read from the payload on access
+ */
+class MESSAGE_INTERVAL : public View {
+public:
+	using Layout = wire::common::MESSAGE_INTERVAL;
+	static constexpr mavlink::msgid_t MSG_ID = 244;
+
+	explicit MESSAGE_INTERVAL(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int32_t interval_us() const { return load_field<int32_t>(0); }
+	uint16_t message_id() const { return load_field<uint16_t>(4); }
+};
+
+/**
+ * @brief EXTENDED_SYS_STATE lazy view, fields are read from the payload on access
+ */
+class EXTENDED_SYS_STATE : public View {
+public:
+	using Layout = wire::common::EXTENDED_SYS_STATE;
+	static constexpr mavlink::msgid_t MSG_ID = 245;
+
+	explicit EXTENDED_SYS_STATE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t vtol_state() const { return load_field<uint8_t>(0); }
+	uint8_t landed_state() const { return load_field<uint8_t>(1); }
+};
+
+/**
+ * @brief ADSB_VEHICLE lazy view, fields are read from the payload on access
+ */
+class ADSB_VEHICLE : public View {
+public:
+	using Layout = wire::common::ADSB_VEHICLE;
+	static constexpr mavlink::msgid_t MSG_ID = 246;
+
+	explicit ADSB_VEHICLE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t ICAO_address() const { return load_field<uint32_t>(0); }
+	int32_t lat() const { return load_field<int32_t>(4); }
+	int32_t lon() const { return load_field<int32_t>(8); }
+	int32_t altitude() const { return load_field<int32_t>(12); }
+	uint16_t heading() const { return load_field<uint16_t>(16); }
+	uint16_t hor_velocity() const { return load_field<uint16_t>(18); }
+	int16_t ver_velocity() const { return load_field<int16_t>(20); }
+	uint16_t flags() const { return load_field<uint16_t>(22); }
+	uint16_t squawk() const { return load_field<uint16_t>(24); }
+	uint8_t altitude_type() const { return load_field<uint8_t>(26); }
+	std::string callsign() const { return load_string(27, 9); }
+	char callsign(size_t i) const { return load_field<char>(27 + i * 1); }
+	uint8_t emitter_type() const { return load_field<uint8_t>(36); }
+	uint8_t tslc() const { return load_field<uint8_t>(37); }
+};
+
+/**
+ * @brief COLLISION lazy view, fields are read from the payload on access
+ */
+class COLLISION : public View {
+public:
+	using Layout = wire::common::COLLISION;
+	static constexpr mavlink::msgid_t MSG_ID = 247;
+
+	explicit COLLISION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t id() const { return load_field<uint32_t>(0); }
+	float time_to_minimum_delta() const { return load_field<float>(4); }
+	float altitude_minimum_delta() const { return load_field<float>(8); }
+	float horizontal_minimum_delta() const { return load_field<float>(12); }
+	uint8_t src() const { return load_field<uint8_t>(16); }
+	uint8_t action() const { return load_field<uint8_t>(17); }
+	uint8_t threat_level() const { return load_field<uint8_t>(18); }
+};
+
+/**
+ * @brief V2_EXTENSION lazy view, fields are read from the payload on access
+ */
+class V2_EXTENSION : public View {
+public:
+	using Layout = wire::common::V2_EXTENSION;
+	static constexpr mavlink::msgid_t MSG_ID = 248;
+
+	explicit V2_EXTENSION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t message_type() const { return load_field<uint16_t>(0); }
+	uint8_t target_network() const { return load_field<uint8_t>(2); }
+	uint8_t target_system() const { return load_field<uint8_t>(3); }
+	uint8_t target_component() const { return load_field<uint8_t>(4); }
+	uint8_t payload(size_t i) const { return load_field<uint8_t>(5 + i * 1); }
+};
+
+/**
+ * @brief MEMORY_VECT lazy view, fields are read from the payload on access
+ */
+class MEMORY_VECT : public View {
+public:
+	using Layout = wire::common::MEMORY_VECT;
+	static constexpr mavlink::msgid_t MSG_ID = 249;
+
+	explicit MEMORY_VECT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t address() const { return load_field<uint16_t>(0); }
+	uint8_t ver() const { return load_field<uint8_t>(2); }
+	uint8_t type() const { return load_field<uint8_t>(3); }
+	int8_t value(size_t i) const { return load_field<int8_t>(4 + i * 1); }
+};
+
+/**
+ * @brief DEBUG_VECT lazy view, fields are read from the payload on access
+ */
+class DEBUG_VECT : public View {
+public:
+	using Layout = wire::common::DEBUG_VECT;
+	static constexpr mavlink::msgid_t MSG_ID = 250;
+
+	explicit DEBUG_VECT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	float x() const { return load_field<float>(8); }
+	float y() const { return load_field<float>(12); }
+	float z() const { return load_field<float>(16); }
+	std::string name() const { return load_string(20, 10); }
+	char name(size_t i) const { return load_field<char>(20 + i * 1); }
+};
+
+/**
+ * @brief NAMED_VALUE_FLOAT lazy view, fields are read from the payload on access
+ */
+class NAMED_VALUE_FLOAT : public View {
+public:
+	using Layout = wire::common::NAMED_VALUE_FLOAT;
+	static constexpr mavlink::msgid_t MSG_ID = 251;
+
+	explicit NAMED_VALUE_FLOAT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float value() const { return load_field<float>(4); }
+	std::string name() const { return load_string(8, 10); }
+	char name(size_t i) const { return load_field<char>(8 + i * 1); }
+};
+
+/**
+ * @brief NAMED_VALUE_INT lazy view, fields are read from the payload on access
+ */
+class NAMED_VALUE_INT : public View {
+public:
+	using Layout = wire::common::NAMED_VALUE_INT;
+	static constexpr mavlink::msgid_t MSG_ID = 252;
+
+	explicit NAMED_VALUE_INT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	int32_t value() const { return load_field<int32_t>(4); }
+	std::string name() const { return load_string(8, 10); }
+	char name(size_t i) const { return load_field<char>(8 + i * 1); }
+};
+
+/**
+ * @brief STATUSTEXT lazy view, fields are read from the payload on access
+ */
+class STATUSTEXT : public View {
+public:
+	using Layout = wire::common::STATUSTEXT;
+	static constexpr mavlink::msgid_t MSG_ID = 253;
+
+	explicit STATUSTEXT(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t severity() const { return load_field<uint8_t>(0); }
+	std::string text() const { return load_string(1, 50); }
+	char text(size_t i) const { return load_field<char>(1 + i * 1); }
+};
+
+/**
+ * @brief DEBUG lazy view, fields are read from the payload on access
+ */
+class DEBUG : public View {
+public:
+	using Layout = wire::common::DEBUG;
+	static constexpr mavlink::msgid_t MSG_ID = 254;
+
+	explicit DEBUG(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float value() const { return load_field<float>(4); }
+	uint8_t ind() const { return load_field<uint8_t>(8); }
+};
+
+/**
+ * @brief SETUP_SIGNING lazy view, fields are read from the payload on access
+ */
+class SETUP_SIGNING : public View {
+public:
+	using Layout = wire::common::SETUP_SIGNING;
+	static constexpr mavlink::msgid_t MSG_ID = 256;
+
+	explicit SETUP_SIGNING(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t initial_timestamp() const { return load_field<uint64_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(8); }
+	uint8_t target_component() const { return load_field<uint8_t>(9); }
+	uint8_t secret_key(size_t i) const { return load_field<uint8_t>(10 + i * 1); }
+};
+
+/**
+ * @brief BUTTON_CHANGE lazy view, fields are read from the payload on access
+ */
+class BUTTON_CHANGE : public View {
+public:
+	using Layout = wire::common::BUTTON_CHANGE;
+	static constexpr mavlink::msgid_t MSG_ID = 257;
+
+	explicit BUTTON_CHANGE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint32_t last_change_ms() const { return load_field<uint32_t>(4); }
+	uint8_t state() const { return load_field<uint8_t>(8); }
+};
+
+/**
+ * @brief PLAY_TUNE lazy view, fields are read from the payload on access
+ */
+class PLAY_TUNE : public View {
+public:
+	using Layout = wire::common::PLAY_TUNE;
+	static constexpr mavlink::msgid_t MSG_ID = 258;
+
+	explicit PLAY_TUNE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	std::string tune() const { return load_string(2, 30); }
+	char tune(size_t i) const { return load_field<char>(2 + i * 1); }
+};
+
+/**
+ * @brief CAMERA_INFORMATION lazy view, fields are read from the payload on access
+ */
+class CAMERA_INFORMATION : public View {
+public:
+	using Layout = wire::common::CAMERA_INFORMATION;
+	static constexpr mavlink::msgid_t MSG_ID = 259;
+
+	explicit CAMERA_INFORMATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint32_t firmware_version() const { return load_field<uint32_t>(4); }
+	float focal_length() const { return load_field<float>(8); }
+	float sensor_size_h() const { return load_field<float>(12); }
+	float sensor_size_v() const { return load_field<float>(16); }
+	uint32_t flags() const { return load_field<uint32_t>(20); }
+	uint16_t resolution_h() const { return load_field<uint16_t>(24); }
+	uint16_t resolution_v() const { return load_field<uint16_t>(26); }
+	uint16_t cam_definition_version() const { return load_field<uint16_t>(28); }
+	uint8_t vendor_name(size_t i) const { return load_field<uint8_t>(30 + i * 1); }
+	uint8_t model_name(size_t i) const { return load_field<uint8_t>(62 + i * 1); }
+	uint8_t lens_id() const { return load_field<uint8_t>(94); }
+	std::string cam_definition_uri() const { return load_string(95, 140); }
+	char cam_definition_uri(size_t i) const { return load_field<char>(95 + i * 1); }
+};
+
+/**
+ * @brief CAMERA_SETTINGS lazy view, fields are read from the payload on access
+ */
+class CAMERA_SETTINGS : public View {
+public:
+	using Layout = wire::common::CAMERA_SETTINGS;
+	static constexpr mavlink::msgid_t MSG_ID = 260;
+
+	explicit CAMERA_SETTINGS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	uint8_t mode_id() const { return load_field<uint8_t>(4); }
+};
+
+/**
+ * @brief STORAGE_INFORMATION lazy view, fields are read from the payload on access
+ */
+class STORAGE_INFORMATION : public View {
+public:
+	using Layout = wire::common::STORAGE_INFORMATION;
+	static constexpr mavlink::msgid_t MSG_ID = 261;
+
+	explicit STORAGE_INFORMATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float total_capacity() const { return load_field<float>(4); }
+	float used_capacity() const { return load_field<float>(8); }
+	float available_capacity() const { return load_field<float>(12); }
+	float read_speed() const { return load_field<float>(16); }
+	float write_speed() const { return load_field<float>(20); }
+	uint8_t storage_id() const { return load_field<uint8_t>(24); }
+	uint8_t storage_count() const { return load_field<uint8_t>(25); }
+	uint8_t status() const { return load_field<uint8_t>(26); }
+};
+
+/**
+ * @brief CAMERA_CAPTURE_STATUS lazy view, fields are read from the payload on access
+ */
+class CAMERA_CAPTURE_STATUS : public View {
+public:
+	using Layout = wire::common::CAMERA_CAPTURE_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 262;
+
+	explicit CAMERA_CAPTURE_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float image_interval() const { return load_field<float>(4); }
+	uint32_t recording_time_ms() const { return load_field<uint32_t>(8); }
+	float available_capacity() const { return load_field<float>(12); }
+	uint8_t image_status() const { return load_field<uint8_t>(16); }
+	uint8_t video_status() const { return load_field<uint8_t>(17); }
+};
+
+/**
+ * @brief CAMERA_IMAGE_CAPTURED lazy view, fields are read from the payload on access
+ */
+class CAMERA_IMAGE_CAPTURED : public View {
+public:
+	using Layout = wire::common::CAMERA_IMAGE_CAPTURED;
+	static constexpr mavlink::msgid_t MSG_ID = 263;
+
+	explicit CAMERA_IMAGE_CAPTURED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_utc() const { return load_field<uint64_t>(0); }
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(8); }
+	int32_t lat() const { return load_field<int32_t>(12); }
+	int32_t lon() const { return load_field<int32_t>(16); }
+	int32_t alt() const { return load_field<int32_t>(20); }
+	int32_t relative_alt() const { return load_field<int32_t>(24); }
+	float q(size_t i) const { return load_field<float>(28 + i * 4); }
+	int32_t image_index() const { return load_field<int32_t>(44); }
+	uint8_t camera_id() const { return load_field<uint8_t>(48); }
+	int8_t capture_result() const { return load_field<int8_t>(49); }
+	std::string file_url() const { return load_string(50, 205); }
+	char file_url(size_t i) const { return load_field<char>(50 + i * 1); }
+};
+
+/**
+ * @brief FLIGHT_INFORMATION lazy view, fields are read from the payload on access
+ */
+class FLIGHT_INFORMATION : public View {
+public:
+	using Layout = wire::common::FLIGHT_INFORMATION;
+	static constexpr mavlink::msgid_t MSG_ID = 264;
+
+	explicit FLIGHT_INFORMATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t arming_time_utc() const { return load_field<uint64_t>(0); }
+	uint64_t takeoff_time_utc() const { return load_field<uint64_t>(8); }
+	uint64_t flight_uuid() const { return load_field<uint64_t>(16); }
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(24); }
+};
+
+/**
+ * @brief MOUNT_ORIENTATION lazy view, fields are read from the payload on access
+ */
+class MOUNT_ORIENTATION : public View {
+public:
+	using Layout = wire::common::MOUNT_ORIENTATION;
+	static constexpr mavlink::msgid_t MSG_ID = 265;
+
+	explicit MOUNT_ORIENTATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint32_t time_boot_ms() const { return load_field<uint32_t>(0); }
+	float roll() const { return load_field<float>(4); }
+	float pitch() const { return load_field<float>(8); }
+	float yaw() const { return load_field<float>(12); }
+};
+
+/**
+ * @brief LOGGING_DATA lazy view, fields are read from the payload on access
+ */
+class LOGGING_DATA : public View {
+public:
+	using Layout = wire::common::LOGGING_DATA;
+	static constexpr mavlink::msgid_t MSG_ID = 266;
+
+	explicit LOGGING_DATA(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t sequence() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t length() const { return load_field<uint8_t>(4); }
+	uint8_t first_message_offset() const { return load_field<uint8_t>(5); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(6 + i * 1); }
+};
+
+/**
+ * @brief LOGGING_DATA_ACKED lazy view, fields are read from the payload on access
+ */
+class LOGGING_DATA_ACKED : public View {
+public:
+	using Layout = wire::common::LOGGING_DATA_ACKED;
+	static constexpr mavlink::msgid_t MSG_ID = 267;
+
+	explicit LOGGING_DATA_ACKED(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t sequence() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	uint8_t length() const { return load_field<uint8_t>(4); }
+	uint8_t first_message_offset() const { return load_field<uint8_t>(5); }
+	uint8_t data(size_t i) const { return load_field<uint8_t>(6 + i * 1); }
+};
+
+/**
+ * @brief LOGGING_ACK lazy view, fields are read from the payload on access
+ */
+class LOGGING_ACK : public View {
+public:
+	using Layout = wire::common::LOGGING_ACK;
+	static constexpr mavlink::msgid_t MSG_ID = 268;
+
+	explicit LOGGING_ACK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t sequence() const { return load_field<uint16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+};
+
+/**
+ * @brief VIDEO_STREAM_INFORMATION lazy view, fields are read from the payload on access
+ */
+class VIDEO_STREAM_INFORMATION : public View {
+public:
+	using Layout = wire::common::VIDEO_STREAM_INFORMATION;
+	static constexpr mavlink::msgid_t MSG_ID = 269;
+
+	explicit VIDEO_STREAM_INFORMATION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float framerate() const { return load_field<float>(0); }
+	uint32_t bitrate() const { return load_field<uint32_t>(4); }
+	uint16_t resolution_h() const { return load_field<uint16_t>(8); }
+	uint16_t resolution_v() const { return load_field<uint16_t>(10); }
+	uint16_t rotation() const { return load_field<uint16_t>(12); }
+	uint8_t camera_id() const { return load_field<uint8_t>(14); }
+	uint8_t status() const { return load_field<uint8_t>(15); }
+	std::string uri() const { return load_string(16, 230); }
+	char uri(size_t i) const { return load_field<char>(16 + i * 1); }
+};
+
+/**
+ * @brief SET_VIDEO_STREAM_SETTINGS lazy view, fields are read from the payload on access
+ */
+class SET_VIDEO_STREAM_SETTINGS : public View {
+public:
+	using Layout = wire::common::SET_VIDEO_STREAM_SETTINGS;
+	static constexpr mavlink::msgid_t MSG_ID = 270;
+
+	explicit SET_VIDEO_STREAM_SETTINGS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	float framerate() const { return load_field<float>(0); }
+	uint32_t bitrate() const { return load_field<uint32_t>(4); }
+	uint16_t resolution_h() const { return load_field<uint16_t>(8); }
+	uint16_t resolution_v() const { return load_field<uint16_t>(10); }
+	uint16_t rotation() const { return load_field<uint16_t>(12); }
+	uint8_t target_system() const { return load_field<uint8_t>(14); }
+	uint8_t target_component() const { return load_field<uint8_t>(15); }
+	uint8_t camera_id() const { return load_field<uint8_t>(16); }
+	std::string uri() const { return load_string(17, 230); }
+	char uri(size_t i) const { return load_field<char>(17 + i * 1); }
+};
+
+/**
+ * @brief WIFI_CONFIG_AP lazy view, fields are read from the payload on access
+ */
+class WIFI_CONFIG_AP : public View {
+public:
+	using Layout = wire::common::WIFI_CONFIG_AP;
+	static constexpr mavlink::msgid_t MSG_ID = 299;
+
+	explicit WIFI_CONFIG_AP(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	std::string ssid() const { return load_string(0, 32); }
+	char ssid(size_t i) const { return load_field<char>(0 + i * 1); }
+	std::string password() const { return load_string(32, 64); }
+	char password(size_t i) const { return load_field<char>(32 + i * 1); }
+};
+
+/**
+ * @brief PROTOCOL_VERSION lazy view, fields are read from the payload on access
+ */
+class PROTOCOL_VERSION : public View {
+public:
+	using Layout = wire::common::PROTOCOL_VERSION;
+	static constexpr mavlink::msgid_t MSG_ID = 300;
+
+	explicit PROTOCOL_VERSION(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t version() const { return load_field<uint16_t>(0); }
+	uint16_t min_version() const { return load_field<uint16_t>(2); }
+	uint16_t max_version() const { return load_field<uint16_t>(4); }
+	uint8_t spec_version_hash(size_t i) const { return load_field<uint8_t>(6 + i * 1); }
+	uint8_t library_version_hash(size_t i) const { return load_field<uint8_t>(14 + i * 1); }
+};
+
+/**
+ * @brief UAVCAN_NODE_STATUS lazy view, fields are read from the payload on access
+ */
+class UAVCAN_NODE_STATUS : public View {
+public:
+	using Layout = wire::common::UAVCAN_NODE_STATUS;
+	static constexpr mavlink::msgid_t MSG_ID = 310;
+
+	explicit UAVCAN_NODE_STATUS(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t uptime_sec() const { return load_field<uint32_t>(8); }
+	uint16_t vendor_specific_status_code() const { return load_field<uint16_t>(12); }
+	uint8_t health() const { return load_field<uint8_t>(14); }
+	uint8_t mode() const { return load_field<uint8_t>(15); }
+	uint8_t sub_mode() const { return load_field<uint8_t>(16); }
+};
+
+/**
+ * @brief UAVCAN_NODE_INFO lazy view, fields are read from the payload on access
+ */
+class UAVCAN_NODE_INFO : public View {
+public:
+	using Layout = wire::common::UAVCAN_NODE_INFO;
+	static constexpr mavlink::msgid_t MSG_ID = 311;
+
+	explicit UAVCAN_NODE_INFO(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint64_t time_usec() const { return load_field<uint64_t>(0); }
+	uint32_t uptime_sec() const { return load_field<uint32_t>(8); }
+	uint32_t sw_vcs_commit() const { return load_field<uint32_t>(12); }
+	std::string name() const { return load_string(16, 80); }
+	char name(size_t i) const { return load_field<char>(16 + i * 1); }
+	uint8_t hw_version_major() const { return load_field<uint8_t>(96); }
+	uint8_t hw_version_minor() const { return load_field<uint8_t>(97); }
+	uint8_t hw_unique_id(size_t i) const { return load_field<uint8_t>(98 + i * 1); }
+	uint8_t sw_version_major() const { return load_field<uint8_t>(114); }
+	uint8_t sw_version_minor() const { return load_field<uint8_t>(115); }
+};
+
+/**
+ * @brief PARAM_EXT_REQUEST_READ lazy view, fields are read from the payload on access
+ */
+class PARAM_EXT_REQUEST_READ : public View {
+public:
+	using Layout = wire::common::PARAM_EXT_REQUEST_READ;
+	static constexpr mavlink::msgid_t MSG_ID = 320;
+
+	explicit PARAM_EXT_REQUEST_READ(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	int16_t param_index() const { return load_field<int16_t>(0); }
+	uint8_t target_system() const { return load_field<uint8_t>(2); }
+	uint8_t target_component() const { return load_field<uint8_t>(3); }
+	std::string param_id() const { return load_string(4, 16); }
+	char param_id(size_t i) const { return load_field<char>(4 + i * 1); }
+};
+
+/**
+ * @brief PARAM_EXT_REQUEST_LIST lazy view, fields are read from the payload on access
+ */
+class PARAM_EXT_REQUEST_LIST : public View {
+public:
+	using Layout = wire::common::PARAM_EXT_REQUEST_LIST;
+	static constexpr mavlink::msgid_t MSG_ID = 321;
+
+	explicit PARAM_EXT_REQUEST_LIST(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+};
+
+/**
+ * @brief PARAM_EXT_VALUE lazy view, fields are read from the payload on access
+ */
+class PARAM_EXT_VALUE : public View {
+public:
+	using Layout = wire::common::PARAM_EXT_VALUE;
+	static constexpr mavlink::msgid_t MSG_ID = 322;
+
+	explicit PARAM_EXT_VALUE(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint16_t param_count() const { return load_field<uint16_t>(0); }
+	uint16_t param_index() const { return load_field<uint16_t>(2); }
+	std::string param_id() const { return load_string(4, 16); }
+	char param_id(size_t i) const { return load_field<char>(4 + i * 1); }
+	std::string param_value() const { return load_string(20, 128); }
+	char param_value(size_t i) const { return load_field<char>(20 + i * 1); }
+	uint8_t param_type() const { return load_field<uint8_t>(148); }
+};
+
+/**
+ * @brief PARAM_EXT_SET lazy view, fields are read from the payload on access
+ */
+class PARAM_EXT_SET : public View {
+public:
+	using Layout = wire::common::PARAM_EXT_SET;
+	static constexpr mavlink::msgid_t MSG_ID = 323;
+
+	explicit PARAM_EXT_SET(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	uint8_t target_system() const { return load_field<uint8_t>(0); }
+	uint8_t target_component() const { return load_field<uint8_t>(1); }
+	std::string param_id() const { return load_string(2, 16); }
+	char param_id(size_t i) const { return load_field<char>(2 + i * 1); }
+	std::string param_value() const { return load_string(18, 128); }
+	char param_value(size_t i) const { return load_field<char>(18 + i * 1); }
+	uint8_t param_type() const { return load_field<uint8_t>(146); }
+};
+
+/**
+ * @brief PARAM_EXT_ACK lazy view, fields are read from the payload on access
+ */
+class PARAM_EXT_ACK : public View {
+public:
+	using Layout = wire::common::PARAM_EXT_ACK;
+	static constexpr mavlink::msgid_t MSG_ID = 324;
+
+	explicit PARAM_EXT_ACK(const mavlink::mavlink_message_t *msg) : View(msg) {}
+
+	std::string param_id() const { return load_string(0, 16); }
+	char param_id(size_t i) const { return load_field<char>(0 + i * 1); }
+	std::string param_value() const { return load_string(16, 128); }
+	char param_value(size_t i) const { return load_field<char>(16 + i * 1); }
+	uint8_t param_type() const { return load_field<uint8_t>(144); }
+	uint8_t param_result() const { return load_field<uint8_t>(145); }
+};
+
+}	// namespace view
+}	// namespace common
+}	// namespace wire
+}	// namespace mavconn
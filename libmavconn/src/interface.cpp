@@ -16,6 +16,7 @@
  */
 
 #include <set>
+#include <cctype>
 #include <cassert>
 
 #include <mavconn/interface.h>
@@ -23,6 +24,9 @@
 #include <mavconn/serial.h>
 #include <mavconn/udp.h>
 #include <mavconn/tcp.h>
+#include <mavconn/unix.h>
+#include <mavconn/shm.h>
+#include <mavconn/replay.h>
 
 namespace mavconn {
 #define PFX	"mavconn: "
@@ -41,12 +45,18 @@ MAVConnInterface::MAVConnInterface(uint8_t system_id, uint8_t component_id) :
 	comp_id(component_id),
 	m_status {},
 	m_buffer {},
+	recording(false),
+	recording_tx(false),
 	tx_total_bytes(0),
 	rx_total_bytes(0),
 	last_tx_total_bytes(0),
 	last_rx_total_bytes(0),
 	last_iostat(steady_clock::now())
 {
+	for (auto &n : n_send_refused)
+		n = 0;
+	n_send_coalesced = 0;
+
 	conn_id = conn_id_counter.fetch_add(1);
 	std::call_once(init_flag, init_msg_entry);
 }
@@ -81,6 +91,18 @@ MAVConnInterface::IOStat MAVConnInterface::get_iostat()
 	return stat;
 }
 
+MAVConnInterface::SendStats MAVConnInterface::get_send_stats()
+{
+	SendStats stats;
+
+	stats.dropped_full = n_send_refused[size_t(SendStatus::dropped_full)];
+	stats.closed = n_send_refused[size_t(SendStatus::closed)];
+	stats.no_remote = n_send_refused[size_t(SendStatus::no_remote)];
+	stats.coalesced = n_send_coalesced;
+
+	return stats;
+}
+
 void MAVConnInterface::iostat_tx_add(size_t bytes)
 {
 	tx_total_bytes += bytes;
@@ -118,53 +140,69 @@ void MAVConnInterface::parse_buffer(const char *pfx, uint8_t *buf, const size_t
 		if (msg_received != Framing::incomplete) {
 			log_recv(pfx, message, msg_received);
 
+			if (msg_received == Framing::ok && recording.load(std::memory_order_relaxed)) {
+				uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+				record_frame(frame, mavlink::mavlink_msg_to_send_buffer(frame, &message));
+			}
+
 			if (message_received_cb)
 				message_received_cb(&message, msg_received);
 		}
 	}
 }
 
-void MAVConnInterface::log_recv(const char *pfx, mavlink_message_t &msg, Framing framing)
+void MAVConnInterface::set_recorder(std::shared_ptr<TlogWriter> writer)
 {
-	const char *framing_str = (framing == Framing::ok) ? "OK" :
-			(framing == Framing::bad_crc) ? "!CRC" :
-			(framing == Framing::bad_signature) ? "!SIG" : "ERR";
+	set_rx_recorder(writer);
+	recording_tx = static_cast<bool>(writer);
+}
 
-	const char *proto_version_str = (msg.magic == MAVLINK_STX) ? "v2.0" : "v1.0";
+void MAVConnInterface::set_rx_recorder(std::shared_ptr<TlogWriter> writer)
+{
+	recording = false;
+	recording_tx = false;
+	std::atomic_store(&recorder, writer);
+	recording = static_cast<bool>(writer);
+}
 
-	
+std::shared_ptr<TlogWriter> MAVConnInterface::get_recorder()
+{
+	return std::atomic_load(&recorder);
 }
 
-void MAVConnInterface::log_send(const char *pfx, const mavlink_message_t *msg)
+void MAVConnInterface::record_frame(const uint8_t *frame, size_t length)
 {
-	const char *proto_version_str = (msg->magic == MAVLINK_STX) ? "v2.0" : "v1.0";
+	auto writer = std::atomic_load(&recorder);
+	if (writer)
+		writer->write(frame, length);
+}
 
-	
+void MAVConnInterface::send_message(const mavlink::mavlink_message_t *message)
+{
+	if (try_send_message(message) == SendStatus::dropped_full)
+		throw std::length_error("MAVConnInterface::send_message: TX queue overflow");
 }
 
-void MAVConnInterface::log_send_obj(const char *pfx, const mavlink::Message &msg)
+void MAVConnInterface::send_message(const mavlink::Message &message)
 {
-	
+	if (try_send_message(message) == SendStatus::dropped_full)
+		throw std::length_error("MAVConnInterface::send_message: TX queue overflow");
+}
+
+void MAVConnInterface::send_bytes(const uint8_t *bytes, size_t length)
+{
+	if (try_send_bytes(bytes, length) == SendStatus::dropped_full)
+		throw std::length_error("MAVConnInterface::send_bytes: TX queue overflow");
 }
 
 void MAVConnInterface::send_message_ignore_drop(const mavlink::mavlink_message_t *msg)
 {
-	try {
-		send_message(msg);
-	}
-	catch (std::length_error &e) {
-		
-	}
+	try_send_message(msg);
 }
 
 void MAVConnInterface::send_message_ignore_drop(const mavlink::Message &msg)
 {
-	try {
-		send_message(msg);
-	}
-	catch (std::length_error &e) {
-		
-	}
+	try_send_message(msg);
 }
 
 void MAVConnInterface::set_protocol_version(Protocol pver)
@@ -253,6 +291,132 @@ static void url_parse_query(std::string query, uint8_t &sysid, uint8_t &compid)
 	
 }
 
+/**
+ * Parse a number of a query, throws DeviceError when it does not fit size_t
+ */
+static size_t url_parse_number(std::string::const_iterator begin, std::string::const_iterator end,
+		const std::string &key)
+{
+	try {
+		return std::stoull(std::string(begin, end));
+	}
+	catch (std::out_of_range &) {
+		throw DeviceError("url", ("value of " + key + " out of range").c_str());
+	}
+}
+
+/**
+ * Parse a numeric ?key=value, at most @a max_size
+ */
+static size_t url_parse_size(std::string query, std::string key, size_t def_size, size_t max_size = SIZE_MAX)
+{
+	key += "=";
+
+	auto it = std::search(query.begin(), query.end(),
+			key.begin(), key.end());
+	if (it == query.end())
+		return def_size;
+
+	std::advance(it, key.length());
+	auto end_it = std::find_if(it, query.end(), [](char c) { return !std::isdigit(c); });
+	if (end_it == it)
+		return def_size;
+
+	return std::min(url_parse_number(it, end_it, key), max_size);
+}
+
+/**
+ * Parse ?rxbuf=bytes
+ */
+static size_t url_parse_rxbuf(std::string query, size_t def_size)
+{
+	// links clamp it to [MIN_RX_BUFFER_SIZE, MAX_RX_BUFFER_SIZE]
+	return url_parse_size(query, "rxbuf", def_size);
+}
+
+/**
+ * Parse ?io=uring, links fall back to asio where io_uring is not available
+ */
+static IoBackend url_parse_io_backend(std::string query)
+{
+	const std::string io_uring("io=uring");
+
+	if (std::search(query.begin(), query.end(), io_uring.begin(), io_uring.end()) != query.end())
+		return IoBackend::uring;
+
+	return IoBackend::asio;
+}
+
+/**
+ * Parse ?slow=policy&txq=frames of tcp-l
+ */
+static void url_parse_slow_client(std::string query, MAVConnTCPServer &server)
+{
+	using TxPolicy = MAVConnTCPClient::TxPolicy;
+
+	const std::pair<const char *, TxPolicy> policies[] = {
+		{ "slow=drop-newest", TxPolicy::drop_newest },
+		{ "slow=drop-oldest", TxPolicy::drop_oldest },
+		{ "slow=disconnect", TxPolicy::disconnect },
+		{ "slow=latest", TxPolicy::latest_per_msgid },
+	};
+
+	auto policy = TxPolicy::drop_newest;
+	for (auto &p : policies) {
+		if (query.find(p.first) != std::string::npos)
+			policy = p.second;
+	}
+
+	server.set_slow_client_policy(policy, url_parse_size(query, "txq", 0));
+}
+
+/**
+ * Parse TX queue options:
+ * ?txprio=strict|weighted, commands first and transfers last
+ * ?coalesce=msgid,msgid,... latest value wins for these msgids
+ * ?txrate=bytes/s&txburst=bytes paces the drain to the link throughput
+ */
+static MAVConnInterface::Ptr url_parse_tx_queue(std::string query, MAVConnInterface::Ptr link)
+{
+	TxQueueConfig cfg;
+	bool configured = false;
+
+	if (query.find("txprio=strict") != std::string::npos) {
+		cfg = TxQueueConfig::command_first(TxScheduling::strict);
+		configured = true;
+	}
+	else if (query.find("txprio=weighted") != std::string::npos) {
+		cfg = TxQueueConfig::command_first(TxScheduling::weighted);
+		configured = true;
+	}
+
+	const std::string key("coalesce=");
+	auto it = std::search(query.begin(), query.end(),
+			key.begin(), key.end());
+	if (it != query.end()) {
+		std::advance(it, key.length());
+		while (it != query.end() && std::isdigit(*it)) {
+			auto end_it = std::find_if(it, query.end(), [](char c) { return !std::isdigit(c); });
+			cfg.coalesce_latest(url_parse_number(it, end_it, "coalesce"));
+
+			it = end_it;
+			if (it != query.end() && *it == ',')
+				++it;
+		}
+		configured = true;
+	}
+
+	cfg.rate = url_parse_size(query, "txrate", 0);
+	cfg.burst = url_parse_size(query, "txburst", 0);
+	if (cfg.rate != 0)
+		configured = true;
+
+	if (configured)
+		link->set_tx_queue_config(cfg);
+
+	return link;
+}
+
 static MAVConnInterface::Ptr url_parse_serial(
 		std::string path, std::string query,
 		uint8_t system_id, uint8_t component_id, bool hwflow)
@@ -264,8 +428,10 @@ static MAVConnInterface::Ptr url_parse_serial(
 	url_parse_host(path, file_path, baudrate, MAVConnSerial::DEFAULT_DEVICE, MAVConnSerial::DEFAULT_BAUDRATE);
 	url_parse_query(query, system_id, component_id);
 
-	return std::make_shared<MAVConnSerial>(system_id, component_id,
-			file_path, baudrate, hwflow);
+	return url_parse_tx_queue(query, std::make_shared<MAVConnSerial>(system_id, component_id,
+			file_path, baudrate, hwflow,
+			url_parse_rxbuf(query, MAVConnSerial::DEFAULT_RX_BUFFER_SIZE),
+			url_parse_io_backend(query)));
 }
 
 static MAVConnInterface::Ptr url_parse_udp(
@@ -293,9 +459,11 @@ static MAVConnInterface::Ptr url_parse_udp(
 	if (is_udpb)
 		remote_host = MAVConnUDP::BROADCAST_REMOTE_HOST;
 
-	return std::make_shared<MAVConnUDP>(system_id, component_id,
+	return url_parse_tx_queue(query, std::make_shared<MAVConnUDP>(system_id, component_id,
 			bind_host, bind_port,
-			remote_host, remote_port);
+			remote_host, remote_port,
+			url_parse_rxbuf(query, MAVConnUDP::DEFAULT_RX_BUFFER_SIZE),
+			url_parse_io_backend(query)));
 }
 
 static MAVConnInterface::Ptr url_parse_tcp_client(
@@ -309,8 +477,10 @@ static MAVConnInterface::Ptr url_parse_tcp_client(
 	url_parse_host(host, server_host, server_port, "localhost", 5760);
 	url_parse_query(query, system_id, component_id);
 
-	return std::make_shared<MAVConnTCPClient>(system_id, component_id,
-			server_host, server_port);
+	return url_parse_tx_queue(query, std::make_shared<MAVConnTCPClient>(system_id, component_id,
+			server_host, server_port,
+			url_parse_rxbuf(query, MAVConnTCPClient::DEFAULT_RX_BUFFER_SIZE),
+			url_parse_io_backend(query)));
 }
 
 static MAVConnInterface::Ptr url_parse_tcp_server(
@@ -324,8 +494,60 @@ static MAVConnInterface::Ptr url_parse_tcp_server(
 	url_parse_host(host, bind_host, bind_port, "0.0.0.0", 5760);
 	url_parse_query(query, system_id, component_id);
 
-	return std::make_shared<MAVConnTCPServer>(system_id, component_id,
-			bind_host, bind_port);
+	auto server = std::make_shared<MAVConnTCPServer>(system_id, component_id,
+			bind_host, bind_port,
+			url_parse_rxbuf(query, MAVConnTCPClient::DEFAULT_RX_BUFFER_SIZE));
+	url_parse_slow_client(query, *server);
+
+	return url_parse_tx_queue(query, server);
+}
+
+static MAVConnInterface::Ptr url_parse_unix(
+		std::string path, std::string query,
+		uint8_t system_id, uint8_t component_id, bool server)
+{
+	// unix:///run/mavlink.sock, unix://@mavlink for an abstract socket
+	if (path.empty())
+		path = MAVConnUnixClient::DEFAULT_PATH;
+	url_parse_query(query, system_id, component_id);
+
+	size_t rx_buffer_size = url_parse_rxbuf(query, MAVConnUnixClient::DEFAULT_RX_BUFFER_SIZE);
+	if (server)
+		return url_parse_tx_queue(query, std::make_shared<MAVConnUnixServer>(system_id, component_id,
+				path, rx_buffer_size));
+	else
+		return url_parse_tx_queue(query, std::make_shared<MAVConnUnixClient>(system_id, component_id,
+				path, rx_buffer_size));
+}
+
+static MAVConnInterface::Ptr url_parse_shm(
+		std::string name, std::string query,
+		uint8_t system_id, uint8_t component_id, bool writer)
+{
+	// shm://mavlink taps the ring, shm-w://mavlink?slots=4096 creates it
+	if (name.empty())
+		name = MAVConnShm::DEFAULT_NAME;
+	url_parse_query(query, system_id, component_id);
+
+	size_t slots = url_parse_size(query, "slots", MAVConnShm::DEFAULT_SLOTS, MAVConnShm::MAX_SLOTS);
+	return std::make_shared<MAVConnShm>(system_id, component_id,
+			name, writer ? MAVConnShm::Role::writer : MAVConnShm::Role::reader, slots);
+}
+
+static MAVConnInterface::Ptr url_parse_replay(
+		std::string file_path, std::string query,
+		uint8_t system_id, uint8_t component_id)
+{
+	const std::string rate_max("rate=max");
+	auto rate = MAVConnReplay::Rate::realtime;
+
+	// file:///var/log/flight.tlog?rate=max
+	if (std::search(query.begin(), query.end(), rate_max.begin(), rate_max.end()) != query.end())
+		rate = MAVConnReplay::Rate::max;
+	url_parse_query(query, system_id, component_id);
+
+	return std::make_shared<MAVConnReplay>(system_id, component_id,
+			file_path, rate);
 }
 
 MAVConnInterface::Ptr MAVConnInterface::open_url(std::string url,
@@ -358,6 +580,7 @@ MAVConnInterface::Ptr MAVConnInterface::open_url(std::string url,
 
 	// copy host
 	std::advance(proto_it, proto_end.length());
+	auto location_it = proto_it;
 	auto path_it = std::find(proto_it, url.end(), '/');
 	std::transform(proto_it, path_it,
 			std::back_inserter(host),
@@ -384,6 +607,26 @@ MAVConnInterface::Ptr MAVConnInterface::open_url(std::string url,
 		return url_parse_serial(path, query, system_id, component_id, false);
 	else if (proto == "serial-hwfc")
 		return url_parse_serial(path, query, system_id, component_id, true);
+	else if (proto == "unix" || proto == "unix-l") {
+		// socket paths are case sensitive too, an abstract name has no '/' before the query
+		auto name_end = std::find(location_it, url.end(), '?');
+		if (name_end != url.end())
+			query.assign(name_end + 1, url.end());
+		return url_parse_unix(std::string(location_it, name_end),
+				query, system_id, component_id, proto == "unix-l");
+	}
+	else if (proto == "shm" || proto == "shm-w") {
+		// object names are case sensitive
+		auto name_end = std::find(location_it, url.end(), '?');
+		if (name_end != url.end())
+			query.assign(name_end + 1, url.end());
+		return url_parse_shm(std::string(location_it, name_end),
+				query, system_id, component_id, proto == "shm-w");
+	}
+	else if (proto == "file" || proto == "replay")
+		// file names are case sensitive, take them before lowercasing
+		return url_parse_replay(std::string(location_it, std::find(location_it, url.end(), '?')),
+				query, system_id, component_id);
 	else
 		throw DeviceError("url", "Unknown URL type");
 }
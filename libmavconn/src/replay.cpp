@@ -0,0 +1,210 @@
+/**
+ * @brief MAVConn tlog replay link class
+ * @file replay.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <cassert>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <mavconn/thread_utils.h>
+#include <mavconn/replay.h>
+
+namespace mavconn {
+using mavlink::mavlink_message_t;
+
+
+#define PFX	"mavconn: replay"
+#define PFXd	PFX "%zu: "
+
+
+constexpr size_t MAVConnReplay::READ_SIZE;
+
+MAVConnReplay::MAVConnReplay(uint8_t system_id, uint8_t component_id,
+		std::string path, Rate rate) :
+	MAVConnInterface(system_id, component_id),
+	fd(-1),
+	rate(rate),
+	running(true),
+	closed(false),
+	n_frames(0),
+	n_skipped(0)
+{
+	fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		throw DeviceError("replay", errno);
+
+	::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+MAVConnReplay::~MAVConnReplay()
+{
+	close();
+
+	// closed from port_closed_cb on the replay thread
+	if (replay_thread.joinable())
+		replay_thread.join();
+}
+
+void MAVConnReplay::start()
+{
+	if (replay_thread.joinable() || !is_open())
+		return;
+
+	replay_thread = std::thread([this] () {
+				utils::set_this_thread_name("mreplay%zu", conn_id);
+				run();
+			});
+}
+
+void MAVConnReplay::close()
+{
+	if (closed.exchange(true))
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(wait_mutex);
+		running = false;
+	}
+	wait_cond.notify_all();
+
+	if (replay_thread.joinable() && replay_thread.get_id() != std::this_thread::get_id())
+		replay_thread.join();
+
+	::close(fd);
+
+	if (port_closed_cb)
+		port_closed_cb();
+}
+
+SendStatus MAVConnReplay::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	MsgBuffer buf(bytes, length);
+	record_tx(buf);
+	iostat_tx_add(length);
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnReplay::try_send_message(const mavlink_message_t *message, TxPriority)
+{
+	assert(message != nullptr);
+
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	log_send(PFX, message);
+
+	MsgBuffer buf(message);
+	record_tx(buf);
+	iostat_tx_add(buf.len);
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnReplay::try_send_message(const mavlink::Message &message, TxPriority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	log_send_obj(PFX, message);
+
+	MsgBuffer buf(message, get_status_p(), sys_id, comp_id);
+	record_tx(buf);
+	iostat_tx_add(buf.len);
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnReplay::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	MsgBuffer buf(enc, get_status_p(), sys_id, comp_id);
+	record_tx(buf);
+	iostat_tx_add(buf.len);
+	return SendStatus::queued;
+}
+
+bool MAVConnReplay::wait_until(steady_clock::time_point tp)
+{
+	std::unique_lock<std::mutex> lock(wait_mutex);
+	return !wait_cond.wait_until(lock, tp, [this] { return !running; });
+}
+
+void MAVConnReplay::run()
+{
+	std::vector<uint8_t> buf(READ_SIZE + MsgBuffer::MAX_SIZE + tlog::TIMESTAMP_SIZE);
+	size_t pos = 0, fill = 0;
+	bool eof = false;
+
+	bool have_start = false;
+	uint64_t start_ts = 0;
+	steady_clock::time_point start_tp;
+
+	while (running) {
+		size_t avail = fill - pos;
+
+		// refill when a whole record might not be in the buffer
+		if (!eof && avail < tlog::TIMESTAMP_SIZE + MAVLINK_MAX_PACKET_LEN) {
+			std::memmove(buf.data(), buf.data() + pos, avail);
+			pos = 0;
+			fill = avail;
+
+			ssize_t ret = ::read(fd, buf.data() + fill, buf.size() - fill);
+			if (ret < 0 && errno == EINTR)
+				continue;
+			if (ret <= 0)
+				eof = true;
+			else
+				fill += ret;
+
+			continue;
+		}
+
+		if (avail <= tlog::TIMESTAMP_SIZE)
+			break;
+
+		uint8_t *record = buf.data() + pos;
+		uint8_t *frame = record + tlog::TIMESTAMP_SIZE;
+		size_t length = tlog::frame_length(frame, avail - tlog::TIMESTAMP_SIZE);
+		if (length == 0) {
+			// not a record, resync byte by byte
+			pos++;
+			n_skipped++;
+			continue;
+		}
+
+		if (rate == Rate::realtime) {
+			uint64_t ts = tlog::get_timestamp(record);
+			if (!have_start) {
+				have_start = true;
+				start_ts = ts;
+				start_tp = steady_clock::now();
+			}
+			else if (ts > start_ts && !wait_until(start_tp + std::chrono::microseconds(ts - start_ts)))
+				break;
+		}
+
+		parse_buffer(PFX, frame, length, length);
+		n_frames++;
+		pos += tlog::TIMESTAMP_SIZE + length;
+	}
+
+	// end of file: behave like a link that went away
+	if (running)
+		close();
+}
+}	// namespace mavconn
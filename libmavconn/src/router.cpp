@@ -0,0 +1,433 @@
+/**
+ * @brief MAVConn message router
+ * @file router.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+#include <mavconn/router.h>
+
+namespace mavconn {
+using mavlink::mavlink_message_t;
+
+
+#define PFX	"mavconn: router"
+#define PFXd	PFX "%zu: "
+
+
+/**
+ * @brief Local endpoint of a Router
+ *
+ * Sending means entering the router, receiving means being routed to.
+ */
+class MAVConnRouterPort : public MAVConnInterface {
+public:
+	MAVConnRouterPort(uint8_t system_id, uint8_t component_id, Router *router) :
+		MAVConnInterface(system_id, component_id),
+		router(router),
+		link_id(0),
+		tx_status {},
+		tx_buffer {}
+	{ }
+
+	~MAVConnRouterPort() {
+		close();
+	}
+
+	void close() override {
+		Router *r = router.exchange(nullptr);
+		if (r == nullptr)
+			return;
+
+		r->remove_link(link_id);
+
+		if (port_closed_cb)
+			port_closed_cb();
+	}
+
+	SendStatus try_send_message(const mavlink_message_t *message,
+			TxPriority = TxPriority::automatic) override {
+		assert(message != nullptr);
+
+		Router *r = router;
+		if (r == nullptr)
+			return send_refused(SendStatus::closed);
+
+		log_send(PFX, message);
+		r->route(link_id, message, Framing::ok);
+		return SendStatus::queued;
+	}
+
+	SendStatus try_send_message(const mavlink::Message &message,
+			TxPriority = TxPriority::automatic) override {
+		Router *r = router;
+		if (r == nullptr)
+			return send_refused(SendStatus::closed);
+
+		log_send_obj(PFX, message);
+
+		mavlink_message_t msg;
+		mavlink::MsgMap map(msg);
+		auto mi = message.get_message_info();
+
+		message.serialize(map);
+		{
+			std::lock_guard<std::mutex> lock(tx_mutex);
+			mavlink::mavlink_finalize_message_buffer(&msg, sys_id, comp_id, get_status_p(),
+					mi.min_length, mi.length, mi.crc_extra);
+		}
+		r->route(link_id, &msg, Framing::ok);
+		return SendStatus::queued;
+	}
+
+	SendStatus try_send_encoded(const MsgBuffer::Encoder &enc,
+			TxPriority priority = TxPriority::automatic) override {
+		if (router == nullptr)
+			return send_refused(SendStatus::closed);
+
+		std::unique_lock<std::mutex> lock(tx_mutex);
+		MsgBuffer buf(enc, get_status_p(), sys_id, comp_id);
+		lock.unlock();
+
+		return try_send_bytes(buf.dpos(), buf.nbytes(), priority);
+	}
+
+	SendStatus try_send_bytes(const uint8_t *bytes, size_t length,
+			TxPriority = TxPriority::automatic) override {
+		Router *r = router;
+		if (r == nullptr)
+			return send_refused(SendStatus::closed);
+
+		// pre-encoded frames (send<T>(), templates) are framed again,
+		// routed after unlocking as routing may call back into us
+		std::vector<mavlink_message_t> frames;
+		{
+			std::lock_guard<std::mutex> lock(tx_mutex);
+			for (size_t i = 0; i < length; i++) {
+				mavlink_message_t msg;
+				mavlink::mavlink_status_t status;
+				auto framing = static_cast<Framing>(mavlink::mavlink_frame_char_buffer(&tx_buffer, &tx_status,
+						bytes[i], &msg, &status));
+				if (framing == Framing::ok)
+					frames.push_back(msg);
+				else if (framing != Framing::incomplete)
+					r->n_bad_frames++;
+			}
+		}
+
+		for (auto &msg : frames)
+			r->route(link_id, &msg, Framing::ok);
+		return SendStatus::queued;
+	}
+
+	inline bool is_open() override {
+		return router != nullptr;
+	}
+
+	void deliver(const mavlink_message_t *msg) {
+		log_recv(PFX, *const_cast<mavlink_message_t *>(msg), Framing::ok);
+		iostat_rx_add(msg->len);
+
+		if (message_received_cb)
+			message_received_cb(msg, Framing::ok);
+	}
+
+private:
+	friend class Router;
+
+	std::atomic<Router *> router;
+	Router::LinkId link_id;
+
+	std::mutex tx_mutex;
+	mavlink::mavlink_status_t tx_status;
+	mavlink_message_t tx_buffer;
+};
+
+
+/**
+ * @brief Frame bytes of a parsed message, exactly as they were received
+ *
+ * Unlike mavlink_msg_to_send_buffer() the payload is not trimmed again:
+ * the received checksum and signature only match the received length.
+ */
+static size_t received_frame(uint8_t *buf, const mavlink_message_t *msg)
+{
+	if (msg->magic == MAVLINK_STX_MAVLINK1)
+		return mavlink::mavlink_msg_to_send_buffer(buf, msg);
+
+	size_t signature_len = (msg->incompat_flags & MAVLINK_IFLAG_SIGNED) ? MAVLINK_SIGNATURE_BLOCK_LEN : 0;
+
+	buf[0] = msg->magic;
+	buf[1] = msg->len;
+	buf[2] = msg->incompat_flags;
+	buf[3] = msg->compat_flags;
+	buf[4] = msg->seq;
+	buf[5] = msg->sysid;
+	buf[6] = msg->compid;
+	buf[7] = msg->msgid & 0xff;
+	buf[8] = (msg->msgid >> 8) & 0xff;
+	buf[9] = (msg->msgid >> 16) & 0xff;
+	std::memcpy(&buf[MAVLINK_NUM_HEADER_BYTES], _MAV_PAYLOAD(msg), msg->len);
+
+	uint8_t *ck = buf + MAVLINK_NUM_HEADER_BYTES + msg->len;
+	ck[0] = msg->checksum & 0xff;
+	ck[1] = msg->checksum >> 8;
+	std::memcpy(&ck[2], msg->signature, signature_len);
+
+	return MAVLINK_NUM_NON_PAYLOAD_BYTES + msg->len + signature_len;
+}
+
+
+Router::Router() :
+	n_received(0),
+	n_forwarded(0),
+	n_dropped(0),
+	n_unroutable(0),
+	n_bad_frames(0)
+{ }
+
+Router::~Router()
+{
+	std::vector<std::shared_ptr<Link>> all;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		all.swap(links);
+	}
+
+	for (auto &l : all) {
+		if (!l)
+			continue;
+
+		if (l->link)
+			deactivate(*l);
+		else if (auto port = l->port.lock())
+			port->router = nullptr;
+	}
+}
+
+void Router::deactivate(Link &l)
+{
+	// waits for a callback running on the link's io thread
+	std::lock_guard<std::recursive_mutex> lock(l.cb_mutex);
+	l.active = false;
+}
+
+Router::LinkId Router::add(std::shared_ptr<Link> l)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	l->id = links.size();
+	links.push_back(l);
+
+	return l->id;
+}
+
+Router::LinkId Router::add_link(MAVConnInterface::Ptr link)
+{
+	auto l = std::make_shared<Link>();
+	MAVConnInterface *dst = link.get();
+
+	l->link = link;
+	l->deliver = [this, dst](const mavlink_message_t *, const uint8_t *frame, size_t length) {
+		auto status = dst->try_send_bytes(frame, length);
+		if (status == SendStatus::queued)
+			n_forwarded++;
+		else if (status == SendStatus::dropped_full)
+			n_dropped++;
+	};
+
+	// the io thread may be in the callback while the link is removed:
+	// it is never reset, it stops routing once the link is inactive
+	std::weak_ptr<Link> weak_l = l;
+	LinkId id = add(l);
+	link->message_received_cb = [this, weak_l](const mavlink_message_t *msg, const Framing framing) {
+		auto l = weak_l.lock();
+		if (!l)
+			return;
+
+		std::lock_guard<std::recursive_mutex> lock(l->cb_mutex);
+		if (l->active)
+			route(l->id, msg, framing);
+	};
+
+	return id;
+}
+
+MAVConnInterface::Ptr Router::open_local(uint8_t system_id, uint8_t component_id)
+{
+	auto port = std::make_shared<MAVConnRouterPort>(system_id, component_id, this);
+	auto l = std::make_shared<Link>();
+	std::weak_ptr<MAVConnRouterPort> weak_port = port;
+
+	// the router does not keep the endpoint alive
+	l->port = port;
+	l->deliver = [this, weak_port](const mavlink_message_t *msg, const uint8_t *, size_t) {
+		if (auto dst = weak_port.lock()) {
+			dst->deliver(msg);
+			n_forwarded++;
+		}
+	};
+
+	port->link_id = add(l);
+
+	// reachable before it sends anything
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		learn(port->link_id, system_id, component_id);
+	}
+
+	return port;
+}
+
+void Router::remove_link(LinkId id)
+{
+	std::shared_ptr<Link> l;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (id >= links.size() || !links[id])
+			return;
+
+		l.swap(links[id]);
+
+		auto erase_id = [id](std::vector<LinkId> &list) {
+			list.erase(std::remove(list.begin(), list.end(), id), list.end());
+		};
+		for (auto &r : component_routes)
+			erase_id(r.second);
+		for (auto &r : system_routes)
+			erase_id(r.second);
+	}
+
+	deactivate(*l);
+}
+
+std::vector<Router::LinkId> Router::routes(uint8_t sysid, uint8_t compid)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (compid == 0) {
+		auto it = system_routes.find(sysid);
+		return (it != system_routes.end()) ? it->second : std::vector<LinkId>();
+	}
+
+	auto it = component_routes.find(sysid << 8 | compid);
+	return (it != component_routes.end()) ? it->second : std::vector<LinkId>();
+}
+
+Router::Stats Router::get_stats()
+{
+	Stats stats;
+
+	stats.received = n_received;
+	stats.forwarded = n_forwarded;
+	stats.dropped = n_dropped;
+	stats.unroutable = n_unroutable;
+	stats.bad_frames = n_bad_frames;
+
+	return stats;
+}
+
+void Router::learn(LinkId from, uint8_t sysid, uint8_t compid)
+{
+	auto &comp_links = component_routes[sysid << 8 | compid];
+	if (std::find(comp_links.begin(), comp_links.end(), from) != comp_links.end())
+		return;
+
+	comp_links.push_back(from);
+
+	auto &sys_links = system_routes[sysid];
+	if (std::find(sys_links.begin(), sys_links.end(), from) == sys_links.end())
+		sys_links.push_back(from);
+}
+
+void Router::route(LinkId from, const mavlink_message_t *msg, Framing framing)
+{
+	if (framing != Framing::ok) {
+		n_bad_frames++;
+		return;
+	}
+
+	n_received++;
+
+	// target fields, missing when trimmed from a v2 payload means 0
+	uint8_t target_system = 0, target_component = 0;
+	auto entry = mavlink::mavlink_get_msg_entry(msg->msgid);
+	if (entry != nullptr) {
+		auto payload = reinterpret_cast<const uint8_t *>(_MAV_PAYLOAD(msg));
+
+		if ((entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_SYSTEM) && entry->target_system_ofs < msg->len)
+			target_system = payload[entry->target_system_ofs];
+		if ((entry->flags & MAV_MSG_ENTRY_FLAG_HAVE_TARGET_COMPONENT) && entry->target_component_ofs < msg->len)
+			target_component = payload[entry->target_component_ofs];
+	}
+
+	// destinations are collected under the lock and served without it
+	std::shared_ptr<Link> dst_buf[16];
+	std::vector<std::shared_ptr<Link>> dst_more;
+	size_t n_dst = 0;
+
+	auto add_dst = [&](const std::shared_ptr<Link> &l) {
+		if (!l || l->id == from)
+			return;
+		if (n_dst < 16)
+			dst_buf[n_dst++] = l;
+		else
+			dst_more.push_back(l);
+	};
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		learn(from, msg->sysid, msg->compid);
+
+		if (target_system == 0) {
+			for (auto &l : links)
+				add_dst(l);
+		}
+		else {
+			const std::vector<LinkId> *list = nullptr;
+
+			if (target_component != 0) {
+				auto it = component_routes.find(target_system << 8 | target_component);
+				if (it != component_routes.end())
+					list = &it->second;
+			}
+			if (list == nullptr) {
+				auto it = system_routes.find(target_system);
+				if (it != system_routes.end())
+					list = &it->second;
+			}
+
+			if (list != nullptr) {
+				for (auto id : *list)
+					add_dst(links[id]);
+			}
+			else
+				n_unroutable++;
+		}
+	}
+
+	if (n_dst == 0)
+		return;
+
+	uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+	size_t length = received_frame(frame, msg);
+
+	for (size_t i = 0; i < n_dst; i++)
+		dst_buf[i]->deliver(msg, frame, length);
+	for (auto &l : dst_more)
+		l->deliver(msg, frame, length);
+}
+}	// namespace mavconn
@@ -32,13 +32,15 @@ using mavlink::mavlink_message_t;
 
 
 MAVConnSerial::MAVConnSerial(uint8_t system_id, uint8_t component_id,
-		std::string device, unsigned baudrate, bool hwflow) :
+		std::string device, unsigned baudrate, bool hwflow, size_t rx_buffer_size,
+		IoBackend io_backend) :
 	MAVConnInterface(system_id, component_id),
 	tx_in_progress(false),
 	tx_q {},
-	rx_buf {},
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
 	io_service(),
-	serial_dev(io_service)
+	serial_dev(io_service),
+	tx_timer(io_service)
 {
 	using SPB = boost::asio::serial_port_base;
 
@@ -58,10 +60,25 @@ MAVConnSerial::MAVConnSerial(uint8_t system_id, uint8_t component_id,
 		throw DeviceError("serial", err);
 	}
 
-	// NOTE: shared_from_this() should not be used in constructors
+	// NOTE: shared_from_this() should not be used in constructors,
+	// the io handlers use this, the destructor joins the io thread
 
-	// give some work to io_service before start
-	io_service.post(std::bind(&MAVConnSerial::do_read, this));
+	if (io_backend == IoBackend::uring)
+		rx_uring = UringReader::open(serial_dev.native_handle(), UringReader::Kind::stream, rx_buf.size());
+
+	if (rx_uring) {
+		// no read keeps io_service busy
+		io_work.reset(new io_service::work(io_service));
+		rx_uring->start(utils::format("mserialr%zu", conn_id),
+				[this] (uint8_t *data, size_t len, const sockaddr *, socklen_t) {
+					parse_buffer(PFX, data, len, len);
+				},
+				[this] (int) { close(); });
+	}
+	else {
+		// give some work to io_service before start
+		io_service.post(std::bind(&MAVConnSerial::do_read, this));
+	}
 
 	// run io_service for async io
 	io_thread = std::thread([this] () {
@@ -73,49 +90,72 @@ MAVConnSerial::MAVConnSerial(uint8_t system_id, uint8_t component_id,
 MAVConnSerial::~MAVConnSerial()
 {
 	close();
+
+	// closed from a handler, the io thread may still be returning from it
+	if (io_thread.joinable()) {
+		if (io_thread.get_id() != std::this_thread::get_id())
+			io_thread.join();
+		else
+			io_thread.detach();
+	}
 }
 
 void MAVConnSerial::close()
 {
+	// before the lock: a callback on the reader may be waiting for it
+	if (rx_uring)
+		rx_uring->stop();
+
 	lock_guard lock(mutex);
 	if (!is_open())
 		return;
 
+	io_work.reset();
 	io_service.stop();
 	serial_dev.close();
 
-	if (io_thread.joinable())
+	// not from a handler on our own io thread, the destructor joins that one
+	if (io_thread.joinable() && io_thread.get_id() != std::this_thread::get_id())
 		io_thread.join();
 
 	if (port_closed_cb)
 		port_closed_cb();
 }
 
-void MAVConnSerial::send_bytes(const uint8_t *bytes, size_t length)
+SendStatus MAVConnSerial::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority priority)
 {
 	if (!is_open()) {
 		//logError(PFXd "send: channel closed!", conn_id);
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnSerial::send_bytes: TX queue overflow");
-
-		tx_q.emplace_back(bytes, length);
+		int64_t msgid = MsgBuffer::frame_msgid(bytes, length);
+		size_t cls = tx_q.classify(msgid, priority);
+		if (tx_q.coalesced(msgid)) {
+			if (!queue_latest(cls, MsgBuffer(bytes, length)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, bytes, length));
+		}
 	}
-	io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
+	io_service.post(std::bind(&MAVConnSerial::do_write, this, true));
+	return SendStatus::queued;
 }
 
-void MAVConnSerial::send_message(const mavlink_message_t *message)
+SendStatus MAVConnSerial::try_send_message(const mavlink_message_t *message, TxPriority priority)
 {
 	assert(message != nullptr);
 
 	if (!is_open()) {
 		//logError(PFXd "send: channel closed!", conn_id);
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	log_send(PFX, message);
@@ -123,19 +163,27 @@ void MAVConnSerial::send_message(const mavlink_message_t *message)
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnSerial::send_message: TX queue overflow");
-
-		tx_q.emplace_back(message);
+		size_t cls = tx_q.classify(message->msgid, priority);
+		if (tx_q.coalesced(message->msgid)) {
+			if (!queue_latest(cls, MsgBuffer(message)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, message));
+		}
 	}
-	io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
+	io_service.post(std::bind(&MAVConnSerial::do_write, this, true));
+	return SendStatus::queued;
 }
 
-void MAVConnSerial::send_message(const mavlink::Message &message)
+SendStatus MAVConnSerial::try_send_message(const mavlink::Message &message, TxPriority priority)
 {
 	if (!is_open()) {
 		//logError(PFXd "send: channel closed!", conn_id);
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	log_send_obj(PFX, message);
@@ -143,28 +191,90 @@ void MAVConnSerial::send_message(const mavlink::Message &message)
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnSerial::send_message: TX queue overflow");
+		size_t cls = tx_q.classify(message.get_message_info().id, priority);
+		if (tx_q.coalesced(message.get_message_info().id)) {
+			if (!queue_latest(cls, MsgBuffer(message, get_status_p(), sys_id, comp_id)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, message, get_status_p(), sys_id, comp_id));
+		}
+	}
+	io_service.post(std::bind(&MAVConnSerial::do_write, this, true));
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnSerial::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority priority)
+{
+	if (!is_open()) {
+		//logError(PFXd "send: channel closed!", conn_id);
+		return send_refused(SendStatus::closed);
+	}
+
+	{
+		lock_guard lock(mutex);
+
+		size_t cls = tx_q.classify(enc.msgid, priority);
+		if (tx_q.coalesced(enc.msgid)) {
+			if (!queue_latest(cls, MsgBuffer(enc, get_status_p(), sys_id, comp_id)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, enc, get_status_p(), sys_id, comp_id));
+		}
+	}
+	io_service.post(std::bind(&MAVConnSerial::do_write, this, true));
+	return SendStatus::queued;
+}
+
+void MAVConnSerial::set_tx_queue_config(const TxQueueConfig &config)
+{
+	lock_guard lock(mutex);
+	tx_q.configure(config);
+	tx_shaper.configure(config);
+}
 
-		tx_q.emplace_back(message, get_status_p(), sys_id, comp_id);
+TxShaper::Stats MAVConnSerial::get_shaping_stats()
+{
+	lock_guard lock(mutex);
+	return tx_shaper.get_stats();
+}
+
+bool MAVConnSerial::queue_latest(size_t cls, const MsgBuffer &buf)
+{
+	auto queued = tx_q.find_stream(cls, buf, [](const MsgBuffer &b) -> const MsgBuffer & { return b; });
+	if (queued != nullptr) {
+		*queued = buf;
+		send_coalesced();
 	}
-	io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
+	else if (tx_q.full(cls, MAX_TXQ_SIZE))
+		return false;
+	else
+		queued = &tx_q.emplace_back(cls, buf);
+
+	record_tx(*queued);
+	return true;
 }
 
 void MAVConnSerial::do_read(void)
 {
-	auto sthis = shared_from_this();
 	serial_dev.async_read_some(
 			buffer(rx_buf),
-			[sthis] (error_code error, size_t bytes_transferred) {
+			[this] (error_code error, size_t bytes_transferred) {
 				if (error) {
-					//logError(PFXd "receive: %s", sthis->conn_id, error.message().c_str());
-					sthis->close();
+					//logError(PFXd "receive: %s", conn_id, error.message().c_str());
+					close();
 					return;
 				}
 
-				sthis->parse_buffer(PFX, sthis->rx_buf.data(), sthis->rx_buf.size(), bytes_transferred);
-				sthis->do_read();
+				parse_buffer(PFX, rx_buf.data(), rx_buf.size(), bytes_transferred);
+				do_read();
 			});
 }
 
@@ -174,40 +284,57 @@ void MAVConnSerial::do_write(bool check_tx_state)
 		return;
 
 	lock_guard lock(mutex);
-	if (tx_q.empty())
+	TxShaper::clock::duration wait;
+	switch (tx_shaper.pace(tx_q, [](MsgBuffer &b) -> const MsgBuffer & { return b; }, wait)) {
+	case TxShaper::Verdict::empty:
+		tx_in_progress = false;
 		return;
 
+	case TxShaper::Verdict::wait:
+		// paced: the timer resumes the drain, sends meanwhile only queue
+		tx_in_progress = true;
+		tx_timer.expires_from_now(wait);
+		tx_timer.async_wait([this] (error_code error) {
+					if (!error)
+						do_write(false);
+				});
+		return;
+
+	case TxShaper::Verdict::send:
+		break;
+	}
+
 	tx_in_progress = true;
-	auto sthis = shared_from_this();
 	auto &buf_ref = tx_q.front();
 	serial_dev.async_write_some(
 			buffer(buf_ref.dpos(), buf_ref.nbytes()),
-			[sthis, &buf_ref] (error_code error, size_t bytes_transferred) {
+			[this, &buf_ref] (error_code error, size_t bytes_transferred) {
 				assert(bytes_transferred <= buf_ref.len);
 
 				if (error) {
-					// logError(PFXd "write: %s", sthis->conn_id, error.message().c_str());
-					sthis->close();
+					// logError(PFXd "write: %s", conn_id, error.message().c_str());
+					close();
 					return;
 				}
 
-				sthis->iostat_tx_add(bytes_transferred);
-				lock_guard lock(sthis->mutex);
+				iostat_tx_add(bytes_transferred);
+				lock_guard lock(mutex);
 
-				if (sthis->tx_q.empty()) {
-					sthis->tx_in_progress = false;
+				if (tx_q.empty()) {
+					tx_in_progress = false;
 					return;
 				}
 
 				buf_ref.pos += bytes_transferred;
 				if (buf_ref.nbytes() == 0) {
-					sthis->tx_q.pop_front();
+					tx_q.pop_front();
+					tx_shaper.frame_done();
 				}
 
-				if (!sthis->tx_q.empty())
-					sthis->do_write(false);
+				if (!tx_q.empty())
+					do_write(false);
 				else
-					sthis->tx_in_progress = false;
+					tx_in_progress = false;
 			});
 }
 }	// namespace mavconn
@@ -0,0 +1,401 @@
+/**
+ * @brief MAVConn shared memory link class
+ * @file shm.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <new>
+#include <cerrno>
+#include <cassert>
+#include <cstring>
+#include <climits>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include <mavconn/thread_utils.h>
+#include <mavconn/shm.h>
+
+namespace mavconn {
+using mavlink::mavlink_message_t;
+
+#define PFX	"mavconn: shm"
+#define PFXd	PFX "%zu: "
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+		"ring atomics are shared between processes");
+
+//! Ring header at the start of the shared memory object
+struct MAVConnShm::Header {
+	char magic[8];				//!< "MAVSHM01", written last by the writer
+	uint32_t slot_size;
+	uint32_t slot_count;
+	std::atomic<int32_t> writer_pid;	//!< 0 once the writer closed
+	std::atomic<uint32_t> futex_word;	//!< bumped on each publish, readers sleep on it
+	std::atomic<uint32_t> sleepers;		//!< readers in FUTEX_WAIT
+	std::atomic<uint64_t> head;		//!< sequence of the next frame
+};
+
+//! Frame slot, seq is the frame sequence + 1 once written, 0 while being written
+struct MAVConnShm::Slot {
+	std::atomic<uint64_t> seq;
+	uint16_t len;
+	uint8_t data[MsgBuffer::MAX_SIZE];
+};
+
+static constexpr char RING_MAGIC[8] = { 'M', 'A', 'V', 'S', 'H', 'M', '0', '1' };
+//! Slots start on a cache line
+static constexpr size_t HEADER_SIZE = 64;
+
+static int futex_wait(std::atomic<uint32_t> *addr, uint32_t val, const struct timespec *timeout)
+{
+	// not FUTEX_PRIVATE: the word is shared with other processes
+	return ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAIT, val, timeout, nullptr, 0);
+}
+
+static void futex_wake_all(std::atomic<uint32_t> *addr)
+{
+	::syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+static bool process_alive(pid_t pid)
+{
+	return pid != 0 && (::kill(pid, 0) == 0 || errno == EPERM);
+}
+
+
+MAVConnShm::MAVConnShm(uint8_t system_id, uint8_t component_id,
+		std::string name, Role role_, size_t slots_) :
+	MAVConnInterface(system_id, component_id),
+	role(role_),
+	shm_name((!name.empty() && name[0] == '/') ? name : "/" + name),
+	fd(-1),
+	map(nullptr),
+	map_size(0),
+	ring(nullptr),
+	slots(nullptr),
+	slot_mask(0),
+	opened(false),
+	rx_buf(DEFAULT_RX_BUFFER_SIZE),
+	cursor(0),
+	n_lost(0)
+{
+	if (role == Role::writer)
+		create(slots_);
+	else
+		attach();
+
+	opened = true;
+
+	if (role == Role::reader) {
+		rx_thread = std::thread([this] () {
+					utils::set_this_thread_name("mshm%zu", conn_id);
+					do_read();
+				});
+	}
+}
+
+MAVConnShm::~MAVConnShm()
+{
+	close();
+}
+
+void MAVConnShm::create(size_t slots_)
+{
+	static_assert(sizeof(Header) <= HEADER_SIZE, "ring header size");
+	size_t count = 1;
+
+	// a power of two, the sequence maps to a slot with a mask
+	while (count < slots_ && count < MAX_SLOTS)
+		count <<= 1;
+
+	// a ring left by a writer that is gone is replaced, a live one is not
+	int old_fd = ::shm_open(shm_name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+	if (old_fd >= 0) {
+		struct stat st;
+		pid_t old_pid = 0;
+
+		if (::fstat(old_fd, &st) == 0 && size_t(st.st_size) >= sizeof(Header)) {
+			void *addr = ::mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, old_fd, 0);
+			if (addr != MAP_FAILED) {
+				old_pid = static_cast<Header *>(addr)->writer_pid.load();
+				::munmap(addr, sizeof(Header));
+			}
+		}
+		::close(old_fd);
+
+		if (process_alive(old_pid))
+			throw DeviceError("shm", ("ring has a live writer: " + shm_name).c_str());
+
+		::shm_unlink(shm_name.c_str());
+	}
+
+	fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0660);
+	if (fd < 0)
+		throw DeviceError("shm", errno);
+
+	map_size = HEADER_SIZE + count * sizeof(Slot);
+	if (::ftruncate(fd, map_size) < 0) {
+		int err = errno;
+		unmap();
+		::shm_unlink(shm_name.c_str());
+		throw DeviceError("shm", err);
+	}
+
+	map = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		int err = errno;
+		map = nullptr;
+		unmap();
+		::shm_unlink(shm_name.c_str());
+		throw DeviceError("shm", err);
+	}
+
+	// ftruncate zero filled the object: every slot seq is 0, nothing written yet
+	ring = new (map) Header;
+	ring->slot_size = sizeof(Slot);
+	ring->slot_count = count;
+	ring->writer_pid = ::getpid();
+	ring->futex_word = 0;
+	ring->sleepers = 0;
+	ring->head = 0;
+	slots = reinterpret_cast<Slot *>(static_cast<uint8_t *>(map) + HEADER_SIZE);
+	slot_mask = count - 1;
+
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(ring->magic, RING_MAGIC, sizeof(RING_MAGIC));
+}
+
+void MAVConnShm::attach()
+{
+	struct stat st;
+
+	fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+	if (fd < 0)
+		throw DeviceError("shm", errno);
+
+	if (::fstat(fd, &st) < 0) {
+		int err = errno;
+		unmap();
+		throw DeviceError("shm", err);
+	}
+
+	map_size = st.st_size;
+	if (map_size < HEADER_SIZE) {
+		unmap();
+		throw DeviceError("shm", ("not a mavconn ring: " + shm_name).c_str());
+	}
+
+	// readers write too: they register as sleepers
+	map = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		int err = errno;
+		map = nullptr;
+		unmap();
+		throw DeviceError("shm", err);
+	}
+
+	ring = static_cast<Header *>(map);
+	size_t count = ring->slot_count;
+	if (std::memcmp(ring->magic, RING_MAGIC, sizeof(RING_MAGIC)) != 0 ||
+			ring->slot_size != sizeof(Slot) ||
+			count == 0 || (count & (count - 1)) != 0 ||
+			map_size < HEADER_SIZE + count * sizeof(Slot)) {
+		unmap();
+		throw DeviceError("shm", ("not a mavconn ring: " + shm_name).c_str());
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	slots = reinterpret_cast<Slot *>(static_cast<uint8_t *>(map) + HEADER_SIZE);
+	slot_mask = count - 1;
+
+	// a tap starts at the live edge
+	cursor = ring->head.load(std::memory_order_acquire);
+}
+
+void MAVConnShm::unmap()
+{
+	if (map != nullptr)
+		::munmap(map, map_size);
+	if (fd >= 0)
+		::close(fd);
+
+	map = nullptr;
+	ring = nullptr;
+	slots = nullptr;
+	fd = -1;
+}
+
+void MAVConnShm::close()
+{
+	{
+		lock_guard lock(mutex);
+		if (!opened)
+			return;
+
+		opened = false;
+		if (role == Role::writer) {
+			// readers see the writer gone and close
+			ring->writer_pid = 0;
+			::shm_unlink(shm_name.c_str());
+		}
+
+		// wakes our reader thread, other sleepers just look again
+		ring->futex_word.fetch_add(1);
+		futex_wake_all(&ring->futex_word);
+	}
+
+	if (rx_thread.joinable()) {
+		// closed from the reader thread when the writer left
+		if (rx_thread.get_id() != std::this_thread::get_id())
+			rx_thread.join();
+		else
+			rx_thread.detach();
+	}
+
+	{
+		lock_guard lock(mutex);
+		unmap();
+	}
+
+	if (port_closed_cb)
+		port_closed_cb();
+}
+
+bool MAVConnShm::writer_alive()
+{
+	return process_alive(ring->writer_pid.load());
+}
+
+SendStatus MAVConnShm::publish(const MsgBuffer &buf)
+{
+	const size_t length = buf.len - buf.pos;
+
+	lock_guard lock(mutex);
+	if (!opened)
+		return send_refused(SendStatus::closed);
+	if (role != Role::writer)
+		return send_refused(SendStatus::no_remote);
+
+	// seqlock: a reader that sees seq change while copying drops the frame
+	uint64_t seq = ring->head.load(std::memory_order_relaxed);
+	Slot &slot = slots[seq & slot_mask];
+	slot.seq.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.len = length;
+	std::memcpy(slot.data, buf.data + buf.pos, length);
+
+	slot.seq.store(seq + 1, std::memory_order_release);
+	ring->head.store(seq + 1, std::memory_order_seq_cst);
+
+	// pairs with the sleeper count in do_read(): either it sees the new head or we see it
+	ring->futex_word.fetch_add(1, std::memory_order_seq_cst);
+	if (ring->sleepers.load(std::memory_order_seq_cst) != 0)
+		futex_wake_all(&ring->futex_word);
+
+	record_tx(buf);
+	iostat_tx_add(length);
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnShm::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority)
+{
+	return publish(MsgBuffer(bytes, length));
+}
+
+SendStatus MAVConnShm::try_send_message(const mavlink_message_t *message, TxPriority)
+{
+	assert(message != nullptr);
+
+	log_send(PFX, message);
+
+	return publish(MsgBuffer(message));
+}
+
+SendStatus MAVConnShm::try_send_message(const mavlink::Message &message, TxPriority)
+{
+	log_send_obj(PFX, message);
+
+	// the mutex also guards the tx sequence number
+	lock_guard lock(mutex);
+	return publish(MsgBuffer(message, get_status_p(), sys_id, comp_id));
+}
+
+SendStatus MAVConnShm::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority)
+{
+	lock_guard lock(mutex);
+	return publish(MsgBuffer(enc, get_status_p(), sys_id, comp_id));
+}
+
+size_t MAVConnShm::read_batch()
+{
+	const size_t slot_count = slot_mask + 1;
+	uint64_t head = ring->head.load(std::memory_order_acquire);
+	size_t n = 0;
+
+	while (cursor != head && n + MsgBuffer::MAX_SIZE <= rx_buf.size()) {
+		// a full ring behind: the oldest frames are gone
+		if (head - cursor > slot_count) {
+			n_lost += head - cursor - slot_count;
+			cursor = head - slot_count;
+		}
+
+		Slot &slot = slots[cursor & slot_mask];
+		uint64_t seq1 = slot.seq.load(std::memory_order_acquire);
+		size_t length = slot.len;
+		if (seq1 == cursor + 1 && length <= size_t(MsgBuffer::MAX_SIZE))
+			std::memcpy(rx_buf.data() + n, slot.data, length);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64_t seq2 = slot.seq.load(std::memory_order_relaxed);
+
+		if (seq1 == cursor + 1 && seq2 == seq1 && length <= size_t(MsgBuffer::MAX_SIZE))
+			n += length;
+		else
+			n_lost++;	// overwritten while we copied
+
+		cursor++;
+	}
+
+	return n;
+}
+
+void MAVConnShm::do_read()
+{
+	while (opened) {
+		size_t n = read_batch();
+		if (n > 0) {
+			parse_buffer(PFX, rx_buf.data(), rx_buf.size(), n);
+			continue;
+		}
+
+		// sleep until the writer publishes, wake up now and then to see it is still there
+		uint32_t word = ring->futex_word.load(std::memory_order_seq_cst);
+		ring->sleepers.fetch_add(1, std::memory_order_seq_cst);
+		if (opened && ring->head.load(std::memory_order_seq_cst) == cursor) {
+			struct timespec timeout = { 1, 0 };
+			futex_wait(&ring->futex_word, word, &timeout);
+		}
+		ring->sleepers.fetch_sub(1, std::memory_order_seq_cst);
+
+		if (opened && !writer_alive()) {
+			close();
+			return;
+		}
+	}
+}
+}	// namespace mavconn
@@ -16,6 +16,7 @@
  */
 
 #include <cassert>
+#include <algorithm>
 
 #include <mavconn/thread_utils.h>
 #include <mavconn/tcp.h>
@@ -27,7 +28,7 @@ using boost::asio::ip::tcp;
 using boost::asio::buffer;
 using utils::to_string_ss;
 using mavlink::mavlink_message_t;
-using mavlink::mavlink_status_t;
+using std::chrono::steady_clock;
 
 #define PFX	"mavconn: tcp"
 #define PFXd	PFX "%zu: "
@@ -60,14 +61,22 @@ static bool resolve_address_tcp(io_service &io, size_t chan, std::string host, u
 /* -*- TCP client variant -*- */
 
 MAVConnTCPClient::MAVConnTCPClient(uint8_t system_id, uint8_t component_id,
-		std::string server_host, unsigned short server_port) :
+		std::string server_host, unsigned short server_port, size_t rx_buffer_size,
+		IoBackend io_backend) :
 	MAVConnInterface(system_id, component_id),
+	standalone(true),
 	tx_in_progress(false),
 	tx_q {},
-	rx_buf {},
+	tx_policy(TxPolicy::overflow_error),
+	tx_q_limit(MAX_TXQ_SIZE),
+	n_tx_dropped(0),
+	n_tx_replaced(0),
+	max_tx_lag(0),
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
 	io_service(),
 	io_work(new io_service::work(io_service)),
-	socket(io_service)
+	socket(io_service),
+	tx_timer(io_service)
 {
 	if (!resolve_address_tcp(io_service, conn_id, server_host, server_port, server_ep))
 		throw DeviceError("tcp: resolve", "Bind address resolve failed");
@@ -82,10 +91,23 @@ MAVConnTCPClient::MAVConnTCPClient(uint8_t system_id, uint8_t component_id,
 		throw DeviceError("tcp", err);
 	}
 
-	// NOTE: shared_from_this() should not be used in constructors
+	// NOTE: shared_from_this() should not be used in constructors,
+	// the io handlers use this, the destructor joins the io thread
 
-	// give some work to io_service before start
-	io_service.post(std::bind(&MAVConnTCPClient::do_recv, this));
+	if (io_backend == IoBackend::uring)
+		rx_uring = UringReader::open(socket.native_handle(), UringReader::Kind::stream, rx_buf.size());
+
+	if (rx_uring) {
+		rx_uring->start(utils::format("mtcpr%zu", conn_id),
+				[this] (uint8_t *data, size_t len, const sockaddr *, socklen_t) {
+					parse_buffer(PFX, data, len, len);
+				},
+				[this] (int) { close(); });
+	}
+	else {
+		// give some work to io_service before start
+		io_service.post(std::bind(&MAVConnTCPClient::do_recv, this));
+	}
 
 	// run io_service for async io
 	io_thread = std::thread([this] () {
@@ -95,31 +117,57 @@ MAVConnTCPClient::MAVConnTCPClient(uint8_t system_id, uint8_t component_id,
 }
 
 MAVConnTCPClient::MAVConnTCPClient(uint8_t system_id, uint8_t component_id,
-		boost::asio::io_service &server_io) :
+		boost::asio::io_service &server_io, size_t rx_buffer_size) :
 	MAVConnInterface(system_id, component_id),
+	standalone(false),
 	tx_in_progress(false),
 	tx_q {},
-	rx_buf {},
-	socket(server_io)
+	tx_policy(TxPolicy::overflow_error),
+	tx_q_limit(MAX_TXQ_SIZE),
+	n_tx_dropped(0),
+	n_tx_replaced(0),
+	max_tx_lag(0),
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
+	socket(server_io),
+	tx_timer(server_io)
 {
 	// waiting when server call client_connected()
 }
 
-void MAVConnTCPClient::client_connected(size_t server_channel)
+void MAVConnTCPClient::client_connected()
 {
-	
-
-	// start recv
-	socket.get_io_service().post(std::bind(&MAVConnTCPClient::do_recv, shared_from_this()));
+	// from the accept handler, on the server's io thread
+	do_recv();
 }
 
 MAVConnTCPClient::~MAVConnTCPClient()
 {
 	close();
+
+	// closed from a handler, the io thread may still be returning from it
+	if (io_thread.joinable()) {
+		if (io_thread.get_id() != std::this_thread::get_id())
+			io_thread.join();
+		else
+			io_thread.detach();
+	}
+}
+
+std::shared_ptr<MAVConnTCPClient> MAVConnTCPClient::handler_ref()
+{
+	// a standalone client joins its io thread before it goes
+	if (standalone)
+		return nullptr;
+
+	return shared_from_this();
 }
 
 void MAVConnTCPClient::close()
 {
+	// before the lock: a callback on the reader may be waiting for it
+	if (rx_uring)
+		rx_uring->stop();
+
 	lock_guard lock(mutex);
 	if (!is_open())
 		return;
@@ -128,87 +176,192 @@ void MAVConnTCPClient::close()
 	io_service.stop();
 	socket.close();
 
-	if (io_thread.joinable())
+	// not from a handler on our own io thread (EOF), the destructor joins that one
+	if (io_thread.joinable() && io_thread.get_id() != std::this_thread::get_id())
 		io_thread.join();
 
 	if (port_closed_cb)
 		port_closed_cb();
 }
 
-void MAVConnTCPClient::send_bytes(const uint8_t *bytes, size_t length)
+SendStatus MAVConnTCPClient::queue_frame(const TxBuffer &entry, TxPriority priority)
 {
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnTCPClient::send_bytes: TX queue overflow");
+		auto &buf = entry.frame();
+		int64_t msgid = buf.msgid();
+		size_t cls = tx_q.classify(msgid, priority);
+		if (tx_q.coalesced(msgid)) {
+			auto queued = tx_q.find_stream(cls, buf, [](const TxBuffer &b) -> const MsgBuffer & { return b.frame(); });
+			if (queued != nullptr) {
+				// the frame keeps its place, the drain already waits for it
+				queued->replace(entry);
+				record_tx(buf);
+				send_coalesced();
+				return SendStatus::queued;
+			}
+		}
+
+		bool replaced = false;
+		if (tx_q.full(cls, tx_q_limit) && !tx_q_overflow(cls, entry, replaced))
+			return replaced ? SendStatus::queued : send_refused(SendStatus::dropped_full);
+
+		tx_q.emplace_back(cls, entry);
+		record_tx(buf);
+	}
+	auto sthis = handler_ref();
+	socket.get_io_service().post([this, sthis] () { do_send(true); });
+	return SendStatus::queued;
+}
 
-		tx_q.emplace_back(bytes, length);
+bool MAVConnTCPClient::tx_q_overflow(size_t cls, const TxBuffer &entry, bool &replaced)
+{
+	// first frame of a class that may be touched, the one on the wire is not
+	auto first = [this](size_t c) {
+		auto &q = tx_q.at(c);
+		auto it = q.begin();
+		if (tx_q.current_class() == c && it != q.end())
+			++it;
+		return it;
+	};
+
+	switch (tx_policy) {
+	case TxPolicy::overflow_error:
+		return false;
+
+	case TxPolicy::drop_oldest: {
+		// a full class makes room in itself, a full link in the least urgent class
+		size_t victim = cls;
+		if (!tx_q.class_full(cls)) {
+			for (size_t c = TxQueueConfig::NUM_CLASSES - 1; c > cls; c--) {
+				if (first(c) != tx_q.at(c).end()) {
+					victim = c;
+					break;
+				}
+			}
+		}
+
+		auto it = first(victim);
+		if (it == tx_q.at(victim).end())
+			break;
+
+		tx_q.erase(victim, it);
+		n_tx_dropped++;
+		return true;
 	}
-	socket.get_io_service().post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
+
+	case TxPolicy::disconnect:
+		if (n_tx_dropped++ == 0) {
+			// not from here: the server may be iterating its client list
+			
+			auto sthis = handler_ref();
+			socket.get_io_service().post([this, sthis] () { close(); });
+		}
+		return false;
+
+	case TxPolicy::latest_per_msgid: {
+		// the newest frame of that stream takes the new value, keeping its place
+		auto queued = tx_q.find_stream(cls, entry.frame(), [](const TxBuffer &b) -> const MsgBuffer & { return b.frame(); });
+		if (queued == nullptr)
+			break;
+
+		queued->replace(entry);
+		record_tx(entry.frame());
+		n_tx_replaced++;
+		replaced = true;
+		return false;
+	}
+
+	case TxPolicy::drop_newest:
+		break;
+	}
+
+	n_tx_dropped++;
+	return false;
 }
 
-void MAVConnTCPClient::send_message(const mavlink_message_t *message)
+SendStatus MAVConnTCPClient::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority priority)
+{
+	if (!is_open()) {
+		
+		return send_refused(SendStatus::closed);
+	}
+
+	return queue_frame(TxBuffer(steady_clock::now(), bytes, length), priority);
+}
+
+SendStatus MAVConnTCPClient::try_send_message(const mavlink_message_t *message, TxPriority priority)
 {
 	assert(message != nullptr);
 
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
-	
+	log_send(PFX, message);
 
-	{
-		lock_guard lock(mutex);
-
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnTCPClient::send_message: TX queue overflow");
+	return queue_frame(TxBuffer(steady_clock::now(), message), priority);
+}
 
-		tx_q.emplace_back(message);
+SendStatus MAVConnTCPClient::try_send_message(const mavlink::Message &message, TxPriority priority)
+{
+	if (!is_open()) {
+		
+		return send_refused(SendStatus::closed);
 	}
-	socket.get_io_service().post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
+
+	log_send_obj(PFX, message);
+
+	// the mutex also guards the tx sequence number
+	lock_guard lock(mutex);
+	return queue_frame(TxBuffer(steady_clock::now(), message, get_status_p(), sys_id, comp_id), priority);
 }
 
-void MAVConnTCPClient::send_message(const mavlink::Message &message)
+SendStatus MAVConnTCPClient::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority priority)
 {
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
-	
-
-	{
-		lock_guard lock(mutex);
+	lock_guard lock(mutex);
+	return queue_frame(TxBuffer(steady_clock::now(), enc, get_status_p(), sys_id, comp_id), priority);
+}
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnTCPClient::send_message: TX queue overflow");
+void MAVConnTCPClient::set_tx_queue_config(const TxQueueConfig &config)
+{
+	lock_guard lock(mutex);
+	tx_q.configure(config);
+	tx_shaper.configure(config);
+}
 
-		tx_q.emplace_back(message, get_status_p(), sys_id, comp_id);
-	}
-	socket.get_io_service().post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
+TxShaper::Stats MAVConnTCPClient::get_shaping_stats()
+{
+	lock_guard lock(mutex);
+	return tx_shaper.get_stats();
 }
 
 void MAVConnTCPClient::do_recv()
 {
-	auto sthis = shared_from_this();
+	auto sthis = handler_ref();
 	socket.async_receive(
 			buffer(rx_buf),
-			[sthis] (error_code error, size_t bytes_transferred) {
+			[this, sthis] (error_code error, size_t bytes_transferred) {
 				if (error) {
 					
-					sthis->close();
+					close();
 					return;
 				}
 
-				sthis->parse_buffer(PFX, sthis->rx_buf.data(), sthis->rx_buf.size(), bytes_transferred);
-				sthis->do_recv();
+				parse_buffer(PFX, rx_buf.data(), rx_buf.size(), bytes_transferred);
+				do_recv();
 			});
 }
 
@@ -218,40 +371,67 @@ void MAVConnTCPClient::do_send(bool check_tx_state)
 		return;
 
 	lock_guard lock(mutex);
-	if (tx_q.empty())
+	auto sthis = handler_ref();
+	TxShaper::clock::duration wait;
+	switch (tx_shaper.pace(tx_q, [](TxBuffer &b) -> const MsgBuffer & { return b.frame(); }, wait)) {
+	case TxShaper::Verdict::empty:
+		tx_in_progress = false;
 		return;
 
+	case TxShaper::Verdict::wait:
+		// paced: the timer resumes the drain, sends meanwhile only queue
+		tx_in_progress = true;
+		tx_timer.expires_from_now(wait);
+		tx_timer.async_wait([this, sthis] (error_code error) {
+					if (!error)
+						do_send(false);
+				});
+		return;
+
+	case TxShaper::Verdict::send:
+		break;
+	}
+
 	tx_in_progress = true;
-	auto sthis = shared_from_this();
 	auto &buf_ref = tx_q.front();
+	// queue policies may move the entry, the handler keeps the frame on the wire
+	auto frame = buf_ref.buf;
+	const uint8_t *data = buf_ref.dpos();
+	size_t length = buf_ref.nbytes();
 	socket.async_send(
-			buffer(buf_ref.dpos(), buf_ref.nbytes()),
-			[sthis, &buf_ref] (error_code error, size_t bytes_transferred) {
-				assert(bytes_transferred <= buf_ref.len);
+			buffer(data, length),
+			[this, sthis, frame, length] (error_code error, size_t bytes_transferred) {
+				assert(bytes_transferred <= length);
 
 				if (error) {
 					
-					sthis->close();
+					close();
 					return;
 				}
 
-				sthis->iostat_tx_add(bytes_transferred);
-				lock_guard lock(sthis->mutex);
+				iostat_tx_add(bytes_transferred);
+				lock_guard lock(mutex);
 
-				if (sthis->tx_q.empty()) {
-					sthis->tx_in_progress = false;
+				if (tx_q.empty()) {
+					tx_in_progress = false;
 					return;
 				}
 
+				auto &buf_ref = tx_q.front();
 				buf_ref.pos += bytes_transferred;
 				if (buf_ref.nbytes() == 0) {
-					sthis->tx_q.pop_front();
+					auto lag = steady_clock::now() - buf_ref.queued_at;
+					if (lag > max_tx_lag)
+						max_tx_lag = lag;
+
+					tx_q.pop_front();
+					tx_shaper.frame_done();
 				}
 
-				if (!sthis->tx_q.empty())
-					sthis->do_send(false);
+				if (!tx_q.empty())
+					do_send(false);
 				else
-					sthis->tx_in_progress = false;
+					tx_in_progress = false;
 			});
 }
 
@@ -259,16 +439,15 @@ void MAVConnTCPClient::do_send(bool check_tx_state)
 /* -*- TCP server variant -*- */
 
 MAVConnTCPServer::MAVConnTCPServer(uint8_t system_id, uint8_t component_id,
-		std::string server_host, unsigned short server_port) :
-	MAVConnInterface(system_id, component_id),
-	io_service(),
-	acceptor(io_service)
+		std::string server_host, unsigned short server_port, size_t rx_buffer_size) :
+	MAVConnStreamServer(system_id, component_id, rx_buffer_size, PFX),
+	acceptor(io_service),
+	client_tx_policy(MAVConnTCPClient::TxPolicy::drop_newest),
+	client_tx_q_limit(MAX_TXQ_SIZE)
 {
 	if (!resolve_address_tcp(io_service, conn_id, server_host, server_port, bind_ep))
 		throw DeviceError("tcp-l: resolve", "Bind address resolve failed");
 
-	
-
 	try {
 		acceptor.open(tcp::v4());
 		acceptor.set_option(tcp::acceptor::reuse_address(true));
@@ -292,138 +471,97 @@ MAVConnTCPServer::MAVConnTCPServer(uint8_t system_id, uint8_t component_id,
 MAVConnTCPServer::~MAVConnTCPServer()
 {
 	close();
+	join_io();
 }
 
 void MAVConnTCPServer::close()
 {
-	lock_guard lock(mutex);
-	if (!is_open())
-		return;
+	{
+		lock_guard lock(mutex);
+		if (!is_open())
+			return;
 
-	
-	io_service.stop();
-	acceptor.close();
+		acceptor.close();
+	}
 
-	if (io_thread.joinable())
-		io_thread.join();
+	// the io thread takes the lock: it is joined without
+	stop_io();
 
 	if (port_closed_cb)
 		port_closed_cb();
 }
 
-mavlink_status_t MAVConnTCPServer::get_status()
+void MAVConnTCPServer::set_slow_client_policy(MAVConnTCPClient::TxPolicy policy, size_t queue_limit)
 {
-	mavlink_status_t status {};
+	// a throw would cut the broadcast short for the clients after this one
+	if (policy == MAVConnTCPClient::TxPolicy::overflow_error)
+		policy = MAVConnTCPClient::TxPolicy::drop_newest;
+	if (queue_limit == 0)
+		queue_limit = MAX_TXQ_SIZE;
 
 	lock_guard lock(mutex);
-	for (auto &instp : client_list) {
-		auto inst_status = instp->get_status();
-
-		// [[[cog:
-		// for f in ('packet_rx_success_count', 'packet_rx_drop_count', 'buffer_overrun', 'parse_error'):
-		//     cog.outl("status.{f:23s} += inst_status.{f};".format(**locals()))
-		// ]]]
-		status.packet_rx_success_count += inst_status.packet_rx_success_count;
-		status.packet_rx_drop_count    += inst_status.packet_rx_drop_count;
-		status.buffer_overrun          += inst_status.buffer_overrun;
-		status.parse_error             += inst_status.parse_error;
-		// [[[end]]] (checksum: a6186246ed026f1cf2b4ffc7407e893b)
-
-		/* seq counters always 0 for this connection type */
-	}
+	client_tx_policy = policy;
+	client_tx_q_limit = queue_limit;
 
-	return status;
-}
-
-MAVConnInterface::IOStat MAVConnTCPServer::get_iostat()
-{
-	MAVConnInterface::IOStat iostat {};
-
-	lock_guard lock(mutex);
 	for (auto &instp : client_list) {
-		auto inst_iostat = instp->get_iostat();
-
-		// [[[cog:
-		// for p in ('tx', 'rx'):
-		//     for f in ('total_bytes', 'speed'):
-		//         cog.outl("iostat.{p}_{f:11s} += inst_iostat.{p}_{f};".format(**locals()))
-		// ]]]
-		iostat.tx_total_bytes += inst_iostat.tx_total_bytes;
-		iostat.tx_speed       += inst_iostat.tx_speed;
-		iostat.rx_total_bytes += inst_iostat.rx_total_bytes;
-		iostat.rx_speed       += inst_iostat.rx_speed;
-		// [[[end]]] (checksum: fb4fe06794471d9b068ce0c129ee7673)
+		lock_guard client_lock(instp->mutex);
+		instp->tx_policy = policy;
+		instp->tx_q_limit = queue_limit;
 	}
-
-	return iostat;
 }
 
-void MAVConnTCPServer::send_bytes(const uint8_t *bytes, size_t length)
+std::vector<MAVConnTCPServer::ClientStats> MAVConnTCPServer::get_client_stats()
 {
-	lock_guard lock(mutex);
-	for (auto &instp : client_list) {
-		instp->send_bytes(bytes, length);
-	}
-}
+	using std::chrono::duration_cast;
+	using std::chrono::microseconds;
 
-void MAVConnTCPServer::send_message(const mavlink_message_t *message)
-{
-	lock_guard lock(mutex);
-	for (auto &instp : client_list) {
-		instp->send_message(message);
-	}
-}
+	std::vector<ClientStats> stats;
+	auto now = steady_clock::now();
 
-void MAVConnTCPServer::send_message(const mavlink::Message &message)
-{
 	lock_guard lock(mutex);
 	for (auto &instp : client_list) {
-		instp->send_message(message);
+		ClientStats cs {};
+
+		lock_guard client_lock(instp->mutex);
+		cs.conn_id = instp->conn_id;
+		cs.remote = to_string_ss(instp->server_ep);
+		cs.queued = instp->tx_q.size();
+		cs.dropped = instp->n_tx_dropped;
+		cs.replaced = instp->n_tx_replaced;
+		for (size_t cls = 0; cls < TxQueueConfig::NUM_CLASSES; cls++) {
+			auto &q = instp->tx_q.at(cls);
+			for (auto &b : q)
+				cs.queued_bytes += b.nbytes();
+			if (!q.empty())
+				cs.lag = std::max(cs.lag, duration_cast<microseconds>(now - q.front().queued_at));
+		}
+		cs.max_lag = duration_cast<microseconds>(instp->max_tx_lag);
+		cs.shaping = instp->tx_shaper.get_stats();
+
+		stats.push_back(cs);
 	}
+
+	return stats;
 }
 
 void MAVConnTCPServer::do_accept()
 {
-	auto sthis = shared_from_this();
-	auto acceptor_client = std::make_shared<MAVConnTCPClient>(sys_id, comp_id, io_service);
+	auto acceptor_client = make_client();
 	acceptor.async_accept(
 			acceptor_client->socket,
 			acceptor_client->server_ep,
-			[sthis, acceptor_client] (error_code error) {
+			[this, acceptor_client] (error_code error) {
 				if (error) {
-					
-					sthis->close();
+					close();
 					return;
 				}
 
-				lock_guard lock(sthis->mutex);
+				lock_guard lock(mutex);
 
-				std::weak_ptr<MAVConnTCPClient> weak_client{acceptor_client};
-				acceptor_client->client_connected(sthis->conn_id);
-				acceptor_client->message_received_cb = std::bind(&MAVConnTCPServer::recv_message, sthis, std::placeholders::_1, std::placeholders::_2);
-				acceptor_client->port_closed_cb = [weak_client, sthis] () { sthis->client_closed(weak_client); };
-
-				sthis->client_list.push_back(acceptor_client);
-				sthis->do_accept();
+				acceptor_client->tx_policy = client_tx_policy;
+				acceptor_client->tx_q_limit = client_tx_q_limit;
+				client_accepted(acceptor_client);
+				do_accept();
 			});
 }
-
-void MAVConnTCPServer::client_closed(std::weak_ptr<MAVConnTCPClient> weak_instp)
-{
-	if (auto instp = weak_instp.lock()) {
-		bool locked = mutex.try_lock();
-		
-
-		client_list.remove(instp);
-
-		if (locked)
-			mutex.unlock();
-	}
-}
-
-void MAVConnTCPServer::recv_message(const mavlink_message_t *message, const Framing framing)
-{
-	if (message_received_cb)
-		message_received_cb(message, framing);
-}
 }	// namespace mavconn
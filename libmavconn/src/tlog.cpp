@@ -0,0 +1,388 @@
+/**
+ * @brief MAVConn telemetry log (tlog) files
+ * @file tlog.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <mavconn/interface.h>
+#include <mavconn/thread_utils.h>
+#include <mavconn/tlog.h>
+
+namespace mavconn {
+constexpr size_t TlogWriter::BLOCK_SIZE;
+constexpr size_t TlogWriter::MAX_PENDING;
+constexpr std::chrono::milliseconds TlogWriter::FLUSH_INTERVAL;
+
+namespace tlog {
+uint64_t now_us()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+size_t frame_length(const uint8_t *p, size_t avail)
+{
+	size_t length;
+
+	if (avail < 3)
+		return 0;
+
+	if (p[0] == MAVLINK_STX_MAVLINK1)
+		length = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 + p[1] + MAVLINK_NUM_CHECKSUM_BYTES;
+	else if (p[0] == MAVLINK_STX) {
+		length = MAVLINK_NUM_NON_PAYLOAD_BYTES + p[1];
+		if (p[2] & MAVLINK_IFLAG_SIGNED)
+			length += MAVLINK_SIGNATURE_BLOCK_LEN;
+	}
+	else
+		return 0;
+
+	return (length <= avail) ? length : 0;
+}
+}	// namespace tlog
+
+TlogWriter::TlogWriter(const std::string &path) :
+	fd(-1),
+	writing(false),
+	stopping(false),
+	n_frames(0),
+	n_errors(0)
+{
+	fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (fd < 0)
+		throw DeviceError("tlog", errno);
+
+	block.reserve(BLOCK_SIZE);
+	flush_thread = std::thread(&TlogWriter::run, this);
+}
+
+TlogWriter::~TlogWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		hand_off_locked();
+		stopping = true;
+	}
+	flush_cond.notify_one();
+	flush_thread.join();
+
+	::close(fd);
+}
+
+void TlogWriter::write(const uint8_t *frame, size_t length, uint64_t time_us)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// stamped in the order the frames go into the log
+	uint8_t ts[tlog::TIMESTAMP_SIZE];
+	tlog::put_timestamp(ts, (time_us != 0) ? time_us : tlog::now_us());
+
+	if (block.size() + sizeof(ts) + length > BLOCK_SIZE) {
+		hand_off_locked();
+		flush_cond.notify_one();
+	}
+
+	block.insert(block.end(), ts, ts + sizeof(ts));
+	block.insert(block.end(), frame, frame + length);
+	n_frames++;
+}
+
+void TlogWriter::flush()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	hand_off_locked();
+	flush_cond.notify_one();
+	done_cond.wait(lock, [this] { return pending.empty() && !writing; });
+}
+
+void TlogWriter::hand_off_locked()
+{
+	if (block.empty())
+		return;
+
+	if (pending.size() < MAX_PENDING)
+		pending.push_back(std::move(block));
+	else
+		n_errors++;
+
+	// reuse a written block, the io threads should not allocate
+	if (!spare.empty()) {
+		block = std::move(spare.back());
+		spare.pop_back();
+	}
+	block.clear();
+	block.reserve(BLOCK_SIZE);
+}
+
+void TlogWriter::run()
+{
+	utils::set_this_thread_name("mtlog");
+
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		if (pending.empty()) {
+			done_cond.notify_all();
+			if (stopping)
+				break;
+
+			if (!flush_cond.wait_for(lock, FLUSH_INTERVAL, [this] { return !pending.empty() || stopping; }))
+				hand_off_locked();
+			continue;
+		}
+
+		auto data = std::move(pending.front());
+		pending.pop_front();
+		writing = true;
+
+		lock.unlock();
+		bool ok = write_block(data);
+		lock.lock();
+
+		writing = false;
+		if (!ok)
+			n_errors++;
+		if (spare.size() < MAX_PENDING) {
+			data.clear();
+			spare.push_back(std::move(data));
+		}
+	}
+}
+
+bool TlogWriter::write_block(const std::vector<uint8_t> &data)
+{
+	const uint8_t *p = data.data();
+	size_t left = data.size();
+
+	while (left > 0) {
+		ssize_t ret = ::write(fd, p, left);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+
+			// the block is lost, keep recording into the next one
+			return false;
+		}
+
+		p += ret;
+		left -= ret;
+	}
+
+	return true;
+}
+
+TlogReader::TlogReader(const std::string &path, std::string index_path) :
+	fd(-1),
+	map(nullptr),
+	map_size(0),
+	mtime_ns(0),
+	loaded(false)
+{
+	struct stat st;
+
+	fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		throw DeviceError("tlog", errno);
+
+	if (::fstat(fd, &st) < 0) {
+		int err = errno;
+		::close(fd);
+		throw DeviceError("tlog", err);
+	}
+
+	map_size = st.st_size;
+	mtime_ns = int64_t(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+
+	if (map_size > 0) {
+		void *addr = ::mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (addr == MAP_FAILED) {
+			int err = errno;
+			::close(fd);
+			throw DeviceError("tlog", err);
+		}
+		map = static_cast<const uint8_t *>(addr);
+	}
+
+	if (index_path.empty())
+		index_path = path + ".idx";
+
+	loaded = load_index(index_path);
+	if (!loaded) {
+		build_index();
+		save_index(index_path);
+	}
+
+	if (map_size > 0)
+		::madvise(const_cast<uint8_t *>(map), map_size, MADV_RANDOM);
+
+	for (size_t i = 0; i < index.size(); i++)
+		by_msgid[index[i].msgid].push_back(i);
+
+	// the framer needs the CRC extra table, normally set up by the first link
+	std::call_once(MAVConnInterface::init_flag, MAVConnInterface::init_msg_entry);
+}
+
+TlogReader::~TlogReader()
+{
+	if (map != nullptr)
+		::munmap(const_cast<uint8_t *>(map), map_size);
+	::close(fd);
+}
+
+bool TlogReader::load_index(const std::string &index_path)
+{
+	IndexHeader hdr;
+	bool ok = false;
+
+	FILE *fp = std::fopen(index_path.c_str(), "rb");
+	if (fp == nullptr)
+		return false;
+
+	if (std::fread(&hdr, sizeof(hdr), 1, fp) == 1 &&
+			std::memcmp(hdr.magic, "MAVTLIDX", sizeof(hdr.magic)) == 0 &&
+			hdr.version == 1 &&
+			hdr.entry_size == sizeof(Entry) &&
+			hdr.log_size == map_size &&
+			hdr.log_mtime_ns == mtime_ns) {
+		index.resize(hdr.count);
+		ok = std::fread(index.data(), sizeof(Entry), hdr.count, fp) == hdr.count;
+	}
+
+	std::fclose(fp);
+	if (!ok)
+		index.clear();
+	return ok;
+}
+
+void TlogReader::build_index()
+{
+	size_t pos = 0;
+
+	if (map_size > 0)
+		::madvise(const_cast<uint8_t *>(map), map_size, MADV_SEQUENTIAL);
+
+	index.clear();
+	while (pos + tlog::TIMESTAMP_SIZE < map_size) {
+		const uint8_t *p = map + pos + tlog::TIMESTAMP_SIZE;
+		size_t length = tlog::frame_length(p, map_size - pos - tlog::TIMESTAMP_SIZE);
+		if (length == 0) {
+			// not a record, resync byte by byte
+			pos++;
+			continue;
+		}
+
+		Entry e {};
+		e.time_us = tlog::get_timestamp(map + pos);
+		e.offset = pos + tlog::TIMESTAMP_SIZE;
+		e.length = length;
+		if (p[0] == MAVLINK_STX_MAVLINK1)
+			e.msgid = p[5];
+		else
+			e.msgid = p[7] | (p[8] << 8) | (p[9] << 16);
+
+		index.push_back(e);
+		pos += tlog::TIMESTAMP_SIZE + length;
+	}
+}
+
+void TlogReader::save_index(const std::string &index_path)
+{
+	IndexHeader hdr {};
+	std::memcpy(hdr.magic, "MAVTLIDX", sizeof(hdr.magic));
+	hdr.version = 1;
+	hdr.entry_size = sizeof(Entry);
+	hdr.log_size = map_size;
+	hdr.log_mtime_ns = mtime_ns;
+	hdr.count = index.size();
+
+	// write aside and rename, a reader never sees a partial index
+	std::string tmp_path = index_path + ".tmp";
+	FILE *fp = std::fopen(tmp_path.c_str(), "wb");
+	if (fp == nullptr)
+		return;		// read-only location, rebuild next time
+
+	bool ok = std::fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+	if (ok && !index.empty())
+		ok = std::fwrite(index.data(), sizeof(Entry), index.size(), fp) == index.size();
+	ok = (std::fclose(fp) == 0) && ok;
+
+	if (!ok || std::rename(tmp_path.c_str(), index_path.c_str()) != 0)
+		std::remove(tmp_path.c_str());
+}
+
+const TlogReader::IndexList &TlogReader::entries(mavlink::msgid_t msgid) const
+{
+	static const IndexList empty;
+
+	auto it = by_msgid.find(msgid);
+	return (it != by_msgid.end()) ? it->second : empty;
+}
+
+size_t TlogReader::seek(uint64_t time_us) const
+{
+	auto it = std::lower_bound(index.begin(), index.end(), time_us,
+			[](const Entry &e, uint64_t t) { return e.time_us < t; });
+	return it - index.begin();
+}
+
+const TlogReader::Entry *TlogReader::find(mavlink::msgid_t msgid, uint64_t time_us) const
+{
+	auto &list = entries(msgid);
+	auto it = std::lower_bound(list.begin(), list.end(), time_us,
+			[this](uint32_t i, uint64_t t) { return index[i].time_us < t; });
+	return (it != list.end()) ? &index[*it] : nullptr;
+}
+
+std::vector<const TlogReader::Entry *> TlogReader::select(const std::vector<mavlink::msgid_t> &msgids,
+		uint64_t from_us, uint64_t to_us) const
+{
+	std::vector<uint32_t> positions;
+
+	for (auto msgid : msgids) {
+		auto &list = entries(msgid);
+		auto first = std::lower_bound(list.begin(), list.end(), from_us,
+				[this](uint32_t i, uint64_t t) { return index[i].time_us < t; });
+		auto last = std::lower_bound(first, list.end(), to_us,
+				[this](uint32_t i, uint64_t t) { return index[i].time_us <= t; });
+		positions.insert(positions.end(), first, last);
+	}
+
+	std::sort(positions.begin(), positions.end());
+
+	std::vector<const Entry *> out;
+	out.reserve(positions.size());
+	for (auto i : positions)
+		out.push_back(&index[i]);
+	return out;
+}
+
+bool TlogReader::decode(const Entry &e, mavlink::mavlink_message_t &msg) const
+{
+	mavlink::mavlink_status_t status {};
+	mavlink::mavlink_message_t buffer {};
+	mavlink::mavlink_status_t rx_status;
+	const uint8_t *p = frame(e);
+	uint8_t framing = mavlink::MAVLINK_FRAMING_INCOMPLETE;
+
+	for (size_t i = 0; i < e.length && framing == mavlink::MAVLINK_FRAMING_INCOMPLETE; i++)
+		framing = mavlink::mavlink_frame_char_buffer(&buffer, &status, p[i], &msg, &rx_status);
+
+	return framing == mavlink::MAVLINK_FRAMING_OK;
+}
+}	// namespace mavconn
@@ -0,0 +1,167 @@
+/**
+ * @brief MAVConn frame tracing
+ * @file trace.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <mavconn/trace.h>
+
+namespace mavconn {
+namespace trace {
+
+static bool env_enabled()
+{
+	const char *env = std::getenv("MAVCONN_TRACE");
+	return env != nullptr && env[0] != '\0' && env[0] != '0';
+}
+
+std::atomic<bool> enabled_flag {env_enabled()};
+
+namespace {
+/**
+ * Single writer (the owning thread), any reader.
+ *
+ * Records are plain memory, so the writer announces each write in
+ * @a begun before touching the slot and publishes it in @a head after.
+ * Readers copy, then check @a begun and discard every slot a write
+ * may have started on meanwhile (a seqlock over the whole ring).
+ */
+struct Ring {
+	std::atomic<uint64_t> begun;
+	std::atomic<uint64_t> head;
+	uint16_t index;
+	Record records[RING_SIZE];
+
+	Ring(uint16_t idx) : begun(0), head(0), index(idx) {}
+};
+
+std::mutex rings_mutex;
+// rings outlive their threads, so records of finished threads still get dumped
+std::vector<std::unique_ptr<Ring>> rings;
+
+Ring *this_thread_ring()
+{
+	static thread_local Ring *ring = nullptr;
+
+	if (ring == nullptr) {
+		std::lock_guard<std::mutex> lock(rings_mutex);
+		rings.emplace_back(new Ring(rings.size()));
+		ring = rings.back().get();
+	}
+	return ring;
+}
+
+uint64_t now_ns(std::chrono::steady_clock::time_point tp)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+}	// namespace
+
+void set_enabled(bool enable)
+{
+	enabled_flag.store(enable);
+}
+
+void record(Event event, size_t conn_id, uint32_t msgid, uint8_t seq, uint8_t len,
+		uint8_t sysid, uint8_t compid, uint8_t framing)
+{
+	Ring *ring = this_thread_ring();
+	uint64_t head = ring->head.load(std::memory_order_relaxed);
+	Record &r = ring->records[head % RING_SIZE];
+
+	ring->begun.store(head + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	r.time_ns = now_ns(std::chrono::steady_clock::now());
+	r.msgid = msgid;
+	r.conn_id = conn_id;
+	r.thread = ring->index;
+	r.event = static_cast<uint8_t>(event);
+	r.framing = framing;
+	r.seq = seq;
+	r.len = len;
+	r.sysid = sysid;
+	r.compid = compid;
+
+	ring->head.store(head + 1, std::memory_order_release);
+}
+
+ssize_t dump(const std::string &path)
+{
+	std::vector<Record> out;
+
+	{
+		std::lock_guard<std::mutex> lock(rings_mutex);
+		for (auto &ring : rings) {
+			uint64_t head = ring->head.load(std::memory_order_acquire);
+			uint64_t first = head > RING_SIZE ? head - RING_SIZE : 0;
+			size_t start = out.size();
+
+			for (uint64_t i = first; i < head; i++)
+				out.push_back(ring->records[i % RING_SIZE]);
+
+			// the writer may have lapped us while copying: the last write
+			// begun, finished or not, overwrites record begun - 1 - RING_SIZE
+			std::atomic_thread_fence(std::memory_order_acquire);
+			uint64_t begun = ring->begun.load(std::memory_order_relaxed);
+			uint64_t valid_from = begun > RING_SIZE ? begun - RING_SIZE : 0;
+			if (valid_from > first) {
+				size_t stale = std::min<uint64_t>(valid_from - first, head - first);
+				out.erase(out.begin() + start, out.begin() + start + stale);
+			}
+		}
+	}
+
+	std::stable_sort(out.begin(), out.end(), [](const Record &a, const Record &b) {
+		return a.time_ns < b.time_ns;
+	});
+
+	FileHeader hdr {};
+	std::memcpy(hdr.magic, "MAVTRACE", sizeof(hdr.magic));
+	hdr.version = 2;
+	hdr.record_size = sizeof(Record);
+	hdr.count = out.size();
+	hdr.steady_ns = now_ns(std::chrono::steady_clock::now());
+	hdr.system_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+
+	FILE *fp = std::fopen(path.c_str(), "wb");
+	if (fp == nullptr)
+		return -1;
+
+	bool ok = std::fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+	if (ok && !out.empty())
+		ok = std::fwrite(out.data(), sizeof(Record), out.size(), fp) == out.size();
+	ok = (std::fclose(fp) == 0) && ok;
+
+	return ok ? static_cast<ssize_t>(out.size()) : -1;
+}
+
+void clear()
+{
+	std::lock_guard<std::mutex> lock(rings_mutex);
+	for (auto &ring : rings) {
+		ring->head.store(0);
+		ring->begun.store(0);
+	}
+}
+
+}	// namespace trace
+}	// namespace mavconn
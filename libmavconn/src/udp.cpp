@@ -16,6 +16,7 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include <mavconn/thread_utils.h>
 #include <mavconn/udp.h>
@@ -59,15 +60,17 @@ static bool resolve_address_udp(io_service &io, size_t chan, std::string host, u
 
 MAVConnUDP::MAVConnUDP(uint8_t system_id, uint8_t component_id,
 		std::string bind_host, unsigned short bind_port,
-		std::string remote_host, unsigned short remote_port) :
+		std::string remote_host, unsigned short remote_port, size_t rx_buffer_size,
+		IoBackend io_backend) :
 	MAVConnInterface(system_id, component_id),
 	remote_exists(false),
 	tx_in_progress(false),
 	tx_q {},
-	rx_buf {},
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
 	io_service(),
 	io_work(new io_service::work(io_service)),
-	socket(io_service)
+	socket(io_service),
+	tx_timer(io_service)
 {
 	using udps = boost::asio::ip::udp::socket;
 
@@ -101,10 +104,22 @@ MAVConnUDP::MAVConnUDP(uint8_t system_id, uint8_t component_id,
 		throw DeviceError("udp", err);
 	}
 
-	// NOTE: shared_from_this() should not be used in constructors
+	// NOTE: shared_from_this() should not be used in constructors,
+	// the io handlers use this, the destructor joins the io thread
 
-	// give some work to io_service before start
-	io_service.post(std::bind(&MAVConnUDP::do_recvfrom, this));
+	if (io_backend == IoBackend::uring)
+		rx_uring = UringReader::open(socket.native_handle(), UringReader::Kind::datagram, rx_buf.size());
+
+	if (rx_uring) {
+		using namespace std::placeholders;
+		rx_uring->start(utils::format("mudpr%zu", conn_id),
+				std::bind(&MAVConnUDP::uring_recv, this, _1, _2, _3, _4),
+				[this] (int) { close(); });
+	}
+	else {
+		// give some work to io_service before start
+		io_service.post(std::bind(&MAVConnUDP::do_recvfrom, this));
+	}
 
 	// run io_service for async io
 	io_thread = std::thread([this] () {
@@ -116,10 +131,22 @@ MAVConnUDP::MAVConnUDP(uint8_t system_id, uint8_t component_id,
 MAVConnUDP::~MAVConnUDP()
 {
 	close();
+
+	// closed from a handler, the io thread may still be returning from it
+	if (io_thread.joinable()) {
+		if (io_thread.get_id() != std::this_thread::get_id())
+			io_thread.join();
+		else
+			io_thread.detach();
+	}
 }
 
 void MAVConnUDP::close()
 {
+	// before the lock: a callback on the reader may be waiting for it
+	if (rx_uring)
+		rx_uring->stop();
+
 	lock_guard lock(mutex);
 	if (!is_open())
 		return;
@@ -128,109 +155,212 @@ void MAVConnUDP::close()
 	io_service.stop();
 	socket.close();
 
-	if (io_thread.joinable())
+	// not from a handler on our own io thread, the destructor joins that one
+	if (io_thread.joinable() && io_thread.get_id() != std::this_thread::get_id())
 		io_thread.join();
 
 	if (port_closed_cb)
 		port_closed_cb();
 }
 
-void MAVConnUDP::send_bytes(const uint8_t *bytes, size_t length)
+SendStatus MAVConnUDP::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority priority)
 {
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	if (!remote_exists) {
 		
-		return;
+		return send_refused(SendStatus::no_remote);
 	}
 
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnUDP::send_bytes: TX queue overflow");
+		int64_t msgid = MsgBuffer::frame_msgid(bytes, length);
+		size_t cls = tx_q.classify(msgid, priority);
+		if (tx_q.coalesced(msgid)) {
+			if (!queue_latest(cls, MsgBuffer(bytes, length)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
 
-		tx_q.emplace_back(bytes, length);
+			record_tx(tx_q.emplace_back(cls, bytes, length));
+		}
 	}
-	io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
+	io_service.post(std::bind(&MAVConnUDP::do_sendto, this, true));
+	return SendStatus::queued;
 }
 
-void MAVConnUDP::send_message(const mavlink_message_t *message)
+SendStatus MAVConnUDP::try_send_message(const mavlink_message_t *message, TxPriority priority)
 {
 	assert(message != nullptr);
 
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	if (!remote_exists) {
 		
-		return;
+		return send_refused(SendStatus::no_remote);
 	}
 
-	
+	log_send(PFX, message);
 
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnUDP::send_message: TX queue overflow");
+		size_t cls = tx_q.classify(message->msgid, priority);
+		if (tx_q.coalesced(message->msgid)) {
+			if (!queue_latest(cls, MsgBuffer(message)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
 
-		tx_q.emplace_back(message);
+			record_tx(tx_q.emplace_back(cls, message));
+		}
 	}
-	io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
+	io_service.post(std::bind(&MAVConnUDP::do_sendto, this, true));
+	return SendStatus::queued;
 }
 
-void MAVConnUDP::send_message(const mavlink::Message &message)
+SendStatus MAVConnUDP::try_send_message(const mavlink::Message &message, TxPriority priority)
 {
 	if (!is_open()) {
 		
-		return;
+		return send_refused(SendStatus::closed);
 	}
 
 	if (!remote_exists) {
 		
-		return;
+		return send_refused(SendStatus::no_remote);
 	}
 
-	
+	log_send_obj(PFX, message);
+
+	{
+		lock_guard lock(mutex);
+
+		size_t cls = tx_q.classify(message.get_message_info().id, priority);
+		if (tx_q.coalesced(message.get_message_info().id)) {
+			if (!queue_latest(cls, MsgBuffer(message, get_status_p(), sys_id, comp_id)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, message, get_status_p(), sys_id, comp_id));
+		}
+	}
+	io_service.post(std::bind(&MAVConnUDP::do_sendto, this, true));
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnUDP::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority priority)
+{
+	if (!is_open()) {
+		
+		return send_refused(SendStatus::closed);
+	}
+
+	if (!remote_exists) {
+		
+		return send_refused(SendStatus::no_remote);
+	}
 
 	{
 		lock_guard lock(mutex);
 
-		if (tx_q.size() >= MAX_TXQ_SIZE)
-			throw std::length_error("MAVConnUDP::send_message: TX queue overflow");
+		size_t cls = tx_q.classify(enc.msgid, priority);
+		if (tx_q.coalesced(enc.msgid)) {
+			if (!queue_latest(cls, MsgBuffer(enc, get_status_p(), sys_id, comp_id)))
+				return send_refused(SendStatus::dropped_full);
+		}
+		else {
+			if (tx_q.full(cls, MAX_TXQ_SIZE))
+				return send_refused(SendStatus::dropped_full);
+
+			record_tx(tx_q.emplace_back(cls, enc, get_status_p(), sys_id, comp_id));
+		}
+	}
+	io_service.post(std::bind(&MAVConnUDP::do_sendto, this, true));
+	return SendStatus::queued;
+}
+
+void MAVConnUDP::set_tx_queue_config(const TxQueueConfig &config)
+{
+	lock_guard lock(mutex);
+	tx_q.configure(config);
+	tx_shaper.configure(config);
+}
+
+TxShaper::Stats MAVConnUDP::get_shaping_stats()
+{
+	lock_guard lock(mutex);
+	return tx_shaper.get_stats();
+}
+
+bool MAVConnUDP::queue_latest(size_t cls, const MsgBuffer &buf)
+{
+	auto queued = tx_q.find_stream(cls, buf, [](const MsgBuffer &b) -> const MsgBuffer & { return b; });
+	if (queued != nullptr) {
+		*queued = buf;
+		send_coalesced();
+	}
+	else if (tx_q.full(cls, MAX_TXQ_SIZE))
+		return false;
+	else
+		queued = &tx_q.emplace_back(cls, buf);
+
+	record_tx(*queued);
+	return true;
+}
 
-		tx_q.emplace_back(message, get_status_p(), sys_id, comp_id);
+void MAVConnUDP::uring_recv(uint8_t *data, size_t len, const sockaddr *addr, socklen_t addrlen)
+{
+	{
+		lock_guard lock(mutex);
+		if (addrlen <= remote_ep.capacity()) {
+			std::memcpy(remote_ep.data(), addr, addrlen);
+			remote_ep.resize(addrlen);
+		}
+
+		if (remote_ep != last_remote_ep) {
+			remote_exists = true;
+			last_remote_ep = remote_ep;
+		}
 	}
-	io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
+
+	parse_buffer(PFX, data, len, len);
 }
 
 void MAVConnUDP::do_recvfrom()
 {
-	auto sthis = shared_from_this();
 	socket.async_receive_from(
 			buffer(rx_buf),
 			remote_ep,
-			[sthis] (error_code error, size_t bytes_transferred) {
+			[this] (error_code error, size_t bytes_transferred) {
 				if (error) {
 					
-					sthis->close();
+					close();
 					return;
 				}
 
-				if (sthis->remote_ep != sthis->last_remote_ep) {
+				if (remote_ep != last_remote_ep) {
 					
-					sthis->remote_exists = true;
-					sthis->last_remote_ep = sthis->remote_ep;
+					remote_exists = true;
+					last_remote_ep = remote_ep;
 				}
 
-				sthis->parse_buffer(PFX, sthis->rx_buf.data(), sthis->rx_buf.size(), bytes_transferred);
-				sthis->do_recvfrom();
+				parse_buffer(PFX, rx_buf.data(), rx_buf.size(), bytes_transferred);
+				do_recvfrom();
 			});
 }
 
@@ -240,16 +370,32 @@ void MAVConnUDP::do_sendto(bool check_tx_state)
 		return;
 
 	lock_guard lock(mutex);
-	if (tx_q.empty())
+	TxShaper::clock::duration wait;
+	switch (tx_shaper.pace(tx_q, [](MsgBuffer &b) -> const MsgBuffer & { return b; }, wait)) {
+	case TxShaper::Verdict::empty:
+		tx_in_progress = false;
 		return;
 
+	case TxShaper::Verdict::wait:
+		// paced: the timer resumes the drain, sends meanwhile only queue
+		tx_in_progress = true;
+		tx_timer.expires_from_now(wait);
+		tx_timer.async_wait([this] (error_code error) {
+					if (!error)
+						do_sendto(false);
+				});
+		return;
+
+	case TxShaper::Verdict::send:
+		break;
+	}
+
 	tx_in_progress = true;
-	auto sthis = shared_from_this();
 	auto &buf_ref = tx_q.front();
 	socket.async_send_to(
 			buffer(buf_ref.dpos(), buf_ref.nbytes()),
 			remote_ep,
-			[sthis, &buf_ref] (error_code error, size_t bytes_transferred) {
+			[this, &buf_ref] (error_code error, size_t bytes_transferred) {
 				assert(bytes_transferred <= buf_ref.len);
 
 				if (error == boost::asio::error::network_unreachable) {
@@ -258,27 +404,28 @@ void MAVConnUDP::do_sendto(bool check_tx_state)
 				}
 				else if (error) {
 					
-					sthis->close();
+					close();
 					return;
 				}
 
-				sthis->iostat_tx_add(bytes_transferred);
-				lock_guard lock(sthis->mutex);
+				iostat_tx_add(bytes_transferred);
+				lock_guard lock(mutex);
 
-				if (sthis->tx_q.empty()) {
-					sthis->tx_in_progress = false;
+				if (tx_q.empty()) {
+					tx_in_progress = false;
 					return;
 				}
 
 				buf_ref.pos += bytes_transferred;
 				if (buf_ref.nbytes() == 0) {
-					sthis->tx_q.pop_front();
+					tx_q.pop_front();
+					tx_shaper.frame_done();
 				}
 
-				if (!sthis->tx_q.empty())
-					sthis->do_sendto(false);
+				if (!tx_q.empty())
+					do_sendto(false);
 				else
-					sthis->tx_in_progress = false;
+					tx_in_progress = false;
 			});
 }
 }	// namespace mavconn
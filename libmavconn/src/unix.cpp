@@ -0,0 +1,419 @@
+/**
+ * @brief MAVConn Unix domain socket link classes
+ * @file unix.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <cassert>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+#include <mavconn/thread_utils.h>
+#include <mavconn/unix.h>
+
+namespace mavconn {
+using boost::system::error_code;
+using boost::asio::io_service;
+using boost::asio::buffer;
+using mavlink::mavlink_message_t;
+using std::chrono::steady_clock;
+using seqpacket = boost::asio::generic::seq_packet_protocol;
+
+#define PFX	"mavconn: unix"
+#define PFXd	PFX "%zu: "
+
+
+/**
+ * Socket path to endpoint, a leading '@' names an abstract socket
+ */
+static seqpacket::endpoint make_endpoint(std::string path)
+{
+	if (!path.empty() && path[0] == '@')
+		path[0] = '\0';
+
+	return seqpacket::endpoint(boost::asio::local::stream_protocol::endpoint(path));
+}
+
+//! MsgBuffer of a TX queue entry
+static const MsgBuffer &frame_of(const StreamTxBuffer &b)
+{
+	return b.frame();
+}
+
+
+/* -*- Unix socket client variant -*- */
+
+MAVConnUnixClient::MAVConnUnixClient(uint8_t system_id, uint8_t component_id,
+		std::string path, size_t rx_buffer_size) :
+	MAVConnInterface(system_id, component_id),
+	io_service(),
+	io_work(new io_service::work(io_service)),
+	standalone(true),
+	io(io_service),
+	socket(io_service),
+	tx_in_progress(false),
+	tx_q {},
+	tx_timer(io_service),
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
+	rx_flags(0)
+{
+	try {
+		auto ep = make_endpoint(path);
+		socket.open(ep.protocol());
+		socket.connect(ep);
+	}
+	catch (boost::system::system_error &err) {
+		throw DeviceError("unix", err);
+	}
+
+	// NOTE: shared_from_this() should not be used in constructors,
+	// the io handlers use this, the destructor joins the io thread
+
+	// give some work to io_service before start
+	io_service.post(std::bind(&MAVConnUnixClient::do_recv, this));
+
+	// run io_service for async io
+	io_thread = std::thread([this] () {
+				utils::set_this_thread_name("munix%zu", conn_id);
+				io_service.run();
+			});
+}
+
+MAVConnUnixClient::MAVConnUnixClient(uint8_t system_id, uint8_t component_id,
+		boost::asio::io_service &server_io, size_t rx_buffer_size) :
+	MAVConnInterface(system_id, component_id),
+	standalone(false),
+	io(server_io),
+	socket(server_io),
+	tx_in_progress(false),
+	tx_q {},
+	tx_timer(server_io),
+	rx_buf(clamp_rx_buffer_size(rx_buffer_size)),
+	rx_flags(0)
+{
+	// waiting when server call client_connected()
+}
+
+void MAVConnUnixClient::client_connected()
+{
+	// from the accept handler, on the server's io thread
+	do_recv();
+}
+
+MAVConnUnixClient::~MAVConnUnixClient()
+{
+	close();
+
+	// closed from a handler, the io thread may still be returning from it
+	if (io_thread.joinable()) {
+		if (io_thread.get_id() != std::this_thread::get_id())
+			io_thread.join();
+		else
+			io_thread.detach();
+	}
+}
+
+std::shared_ptr<MAVConnUnixClient> MAVConnUnixClient::handler_ref()
+{
+	// a standalone client joins its io thread before it goes
+	if (standalone)
+		return nullptr;
+
+	return shared_from_this();
+}
+
+void MAVConnUnixClient::close()
+{
+	lock_guard lock(mutex);
+	if (!is_open())
+		return;
+
+	io_work.reset();
+	io_service.stop();
+	socket.close();
+
+	// not from a handler on our own io thread, the destructor joins that one
+	if (io_thread.joinable() && io_thread.get_id() != std::this_thread::get_id())
+		io_thread.join();
+
+	if (port_closed_cb)
+		port_closed_cb();
+}
+
+SendStatus MAVConnUnixClient::queue_frame(const TxBuffer &entry, TxPriority priority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	{
+		lock_guard lock(mutex);
+
+		auto &buf = entry.frame();
+		int64_t msgid = buf.msgid();
+		size_t cls = tx_q.classify(msgid, priority);
+		if (tx_q.coalesced(msgid)) {
+			auto queued = tx_q.find_stream(cls, buf, frame_of);
+			if (queued != nullptr) {
+				queued->replace(entry);
+				record_tx(buf);
+				send_coalesced();
+				return SendStatus::queued;
+			}
+		}
+
+		if (tx_q.full(cls, MAX_TXQ_SIZE))
+			return send_refused(SendStatus::dropped_full);
+
+		tx_q.emplace_back(cls, entry);
+		record_tx(buf);
+	}
+	auto sthis = handler_ref();
+	io.post([this, sthis] () { do_send(true); });
+	return SendStatus::queued;
+}
+
+SendStatus MAVConnUnixClient::try_send_bytes(const uint8_t *bytes, size_t length, TxPriority priority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	return queue_frame(TxBuffer(steady_clock::now(), bytes, length), priority);
+}
+
+SendStatus MAVConnUnixClient::try_send_message(const mavlink_message_t *message, TxPriority priority)
+{
+	assert(message != nullptr);
+
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	log_send(PFX, message);
+
+	return queue_frame(TxBuffer(steady_clock::now(), message), priority);
+}
+
+SendStatus MAVConnUnixClient::try_send_message(const mavlink::Message &message, TxPriority priority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	log_send_obj(PFX, message);
+
+	// the mutex also guards the tx sequence number
+	lock_guard lock(mutex);
+	return queue_frame(TxBuffer(steady_clock::now(), message, get_status_p(), sys_id, comp_id), priority);
+}
+
+SendStatus MAVConnUnixClient::try_send_encoded(const MsgBuffer::Encoder &enc, TxPriority priority)
+{
+	if (!is_open())
+		return send_refused(SendStatus::closed);
+
+	lock_guard lock(mutex);
+	return queue_frame(TxBuffer(steady_clock::now(), enc, get_status_p(), sys_id, comp_id), priority);
+}
+
+void MAVConnUnixClient::set_tx_queue_config(const TxQueueConfig &config)
+{
+	lock_guard lock(mutex);
+	tx_q.configure(config);
+	tx_shaper.configure(config);
+}
+
+TxShaper::Stats MAVConnUnixClient::get_shaping_stats()
+{
+	lock_guard lock(mutex);
+	return tx_shaper.get_stats();
+}
+
+void MAVConnUnixClient::do_recv()
+{
+	auto sthis = handler_ref();
+	socket.async_receive(
+			buffer(rx_buf),
+			rx_flags,
+			[this, sthis] (error_code error, size_t bytes_transferred) {
+				// an empty packet is the peer's shutdown
+				if (error || bytes_transferred == 0) {
+					close();
+					return;
+				}
+
+				parse_buffer(PFX, rx_buf.data(), rx_buf.size(), bytes_transferred);
+				do_recv();
+			});
+}
+
+void MAVConnUnixClient::do_send(bool check_tx_state)
+{
+	if (check_tx_state && tx_in_progress)
+		return;
+
+	lock_guard lock(mutex);
+	auto sthis = handler_ref();
+	TxShaper::clock::duration wait;
+	switch (tx_shaper.pace(tx_q, frame_of, wait)) {
+	case TxShaper::Verdict::empty:
+		tx_in_progress = false;
+		return;
+
+	case TxShaper::Verdict::wait:
+		// paced: the timer resumes the drain, sends meanwhile only queue
+		tx_in_progress = true;
+		tx_timer.expires_from_now(wait);
+		tx_timer.async_wait([this, sthis] (error_code error) {
+					if (!error)
+						do_send(false);
+				});
+		return;
+
+	case TxShaper::Verdict::send:
+		break;
+	}
+
+	tx_in_progress = true;
+	// a packet is sent whole, coalescing may replace the entry but not the frame on the wire
+	auto &buf_ref = tx_q.front();
+	auto frame = buf_ref.buf;
+	socket.async_send(
+			buffer(buf_ref.dpos(), buf_ref.nbytes()),
+			0,
+			[this, sthis, frame] (error_code error, size_t bytes_transferred) {
+				if (error) {
+					close();
+					return;
+				}
+
+				iostat_tx_add(bytes_transferred);
+				lock_guard lock(mutex);
+
+				if (tx_q.empty()) {
+					tx_in_progress = false;
+					return;
+				}
+
+				tx_q.pop_front();
+				tx_shaper.frame_done();
+
+				if (!tx_q.empty())
+					do_send(false);
+				else
+					tx_in_progress = false;
+			});
+}
+
+
+/* -*- Unix socket server variant -*- */
+
+MAVConnUnixServer::MAVConnUnixServer(uint8_t system_id, uint8_t component_id,
+		std::string path, size_t rx_buffer_size) :
+	MAVConnStreamServer(system_id, component_id, rx_buffer_size, PFX),
+	acceptor(io_service),
+	socket_path(path),
+	lock_fd(-1)
+{
+	lock_socket_path();
+
+	try {
+		auto ep = make_endpoint(path);
+
+		acceptor.open(ep.protocol());
+		acceptor.bind(ep);
+		acceptor.listen();
+	}
+	catch (boost::system::system_error &err) {
+		if (lock_fd >= 0)
+			::close(lock_fd);
+		throw DeviceError("unix-l", err);
+	}
+
+	// give some work to io_service before start
+	io_service.post(std::bind(&MAVConnUnixServer::do_accept, this));
+
+	// run io_service for async io
+	io_thread = std::thread([this] () {
+				utils::set_this_thread_name("munixs%zu", conn_id);
+				io_service.run();
+			});
+}
+
+MAVConnUnixServer::~MAVConnUnixServer()
+{
+	close();
+	join_io();
+}
+
+void MAVConnUnixServer::lock_socket_path()
+{
+	if (socket_path.empty() || socket_path[0] == '@')
+		return;
+
+	auto lock_path = socket_path + ".lock";
+	lock_fd = ::open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (lock_fd < 0)
+		throw DeviceError("unix-l", errno);
+
+	if (::flock(lock_fd, LOCK_EX | LOCK_NB) != 0) {
+		int err = errno;
+		::close(lock_fd);
+		lock_fd = -1;
+		if (err == EWOULDBLOCK)
+			throw DeviceError("unix-l", ("socket in use by a live server: " + socket_path).c_str());
+		throw DeviceError("unix-l", err);
+	}
+
+	// ours now: a socket file still there was left by a server that is gone
+	::unlink(socket_path.c_str());
+}
+
+void MAVConnUnixServer::close()
+{
+	{
+		lock_guard lock(mutex);
+		if (!is_open())
+			return;
+
+		acceptor.close();
+	}
+
+	// the io thread takes the lock: it is joined without
+	stop_io();
+
+	if (lock_fd >= 0) {
+		// the lock file stays: a server that opened it meanwhile locks the same file
+		::unlink(socket_path.c_str());
+		::close(lock_fd);
+		lock_fd = -1;
+	}
+
+	if (port_closed_cb)
+		port_closed_cb();
+}
+
+void MAVConnUnixServer::do_accept()
+{
+	auto acceptor_client = make_client();
+	acceptor.async_accept(
+			acceptor_client->socket,
+			[this, acceptor_client] (error_code error) {
+				if (error) {
+					close();
+					return;
+				}
+
+				client_accepted(acceptor_client);
+				do_accept();
+			});
+}
+}	// namespace mavconn
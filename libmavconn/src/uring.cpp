@@ -0,0 +1,609 @@
+/**
+ * @brief MAVConn io_uring receive backend
+ * @file uring.cpp
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+/*
+ * libmavconn
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#include <mavconn/thread_utils.h>
+#include <mavconn/uring.h>
+
+#ifdef MAVCONN_IO_URING
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <endian.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+namespace mavconn {
+
+#ifdef MAVCONN_IO_URING
+
+// user_data of the requests: kind in the high word, slot in the low one
+static constexpr uint64_t TAG_READ = 0;
+static constexpr uint64_t TAG_POLL = 1ULL << 32;
+static constexpr uint64_t TAG_STOP = 2ULL << 32;
+static constexpr uint64_t TAG_CANCEL = 3ULL << 32;
+static constexpr uint64_t TAG_MASK = ~0ULL << 32;
+
+static int sys_io_uring_setup(unsigned entries, io_uring_params *p)
+{
+	return ::syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+	return ::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nr_args)
+{
+	return ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+struct UringReader::Ring {
+	int ring_fd;
+	int efd;		//!< stop() rings it, a poll on it ends the loop
+	int fd;
+	Kind kind;
+	size_t buffer_size;
+	size_t depth;
+	bool fixed;		//!< buffers registered, streams use READ_FIXED
+
+	void *sq_ptr;
+	void *cq_ptr;
+	size_t sq_size;
+	size_t cq_size;
+	io_uring_sqe *sqes;
+	size_t sqes_size;
+	unsigned sq_entries;
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	io_uring_cqe *cqes;
+	unsigned sq_local_tail;
+
+	uint8_t *buffers;
+	size_t buffers_size;
+	std::vector<iovec> iovs;
+	std::vector<msghdr> msgs;
+	std::vector<sockaddr_storage> addrs;
+	std::vector<bool> armed;	//!< read of the slot not completed yet
+	std::vector<int> poll_err;
+	size_t n_armed;
+	bool stop_armed;
+	bool leak_buffers;		//!< reads the kernel may still fill, never unmap
+
+	std::thread thread;
+	std::mutex thread_mutex;	//!< guards the thread and the hand over below
+	std::condition_variable thread_cv;
+	bool setup_done;
+	bool set_up;
+	bool started;		//!< start() gave us the callbacks
+	std::atomic<bool> stopping;
+	std::string thread_name;
+	RecvCb recv_cb;
+	ErrorCb error_cb;
+
+	Ring(int fd_, Kind kind_, size_t buffer_size_, size_t depth_) :
+		ring_fd(-1),
+		efd(-1),
+		fd(fd_),
+		kind(kind_),
+		buffer_size(buffer_size_),
+		depth(depth_),
+		fixed(false),
+		sq_ptr(MAP_FAILED),
+		cq_ptr(MAP_FAILED),
+		sq_size(0),
+		cq_size(0),
+		sqes(static_cast<io_uring_sqe *>(MAP_FAILED)),
+		sqes_size(0),
+		sq_entries(0),
+		sq_local_tail(0),
+		buffers(static_cast<uint8_t *>(MAP_FAILED)),
+		buffers_size(0),
+		n_armed(0),
+		stop_armed(false),
+		leak_buffers(false),
+		setup_done(false),
+		set_up(false),
+		started(false),
+		stopping(false)
+	{ }
+
+	~Ring();
+
+	bool setup();
+	bool probe();
+	io_uring_sqe *get_sqe(uint64_t user_data);
+	int submit_and_wait(unsigned wait_nr);
+	bool arm(size_t slot);
+	bool arm_stop();
+	void cancel(uint64_t user_data);
+	template<typename Handler>
+	void drain(Handler handler);
+	void serve();
+	void run();
+	void teardown();
+};
+
+UringReader::Ring::~Ring()
+{
+	if (sqes != MAP_FAILED)
+		::munmap(sqes, sqes_size);
+	if (cq_ptr != MAP_FAILED && cq_ptr != sq_ptr)
+		::munmap(cq_ptr, cq_size);
+	if (sq_ptr != MAP_FAILED)
+		::munmap(sq_ptr, sq_size);
+	// closing the ring drops the pinned pages of the registered buffers
+	if (ring_fd >= 0)
+		::close(ring_fd);
+	if (efd >= 0)
+		::close(efd);
+	if (buffers != MAP_FAILED && !leak_buffers)
+		::munmap(buffers, buffers_size);
+}
+
+bool UringReader::Ring::setup()
+{
+	io_uring_params p {};
+
+	// a poll and a read per slot, the stop poll and the cancels of teardown
+	ring_fd = sys_io_uring_setup(4 * depth + 4, &p);
+	if (ring_fd < 0)
+		return false;
+
+	// reads at the current position of a tty or socket need 5.6
+	if (!(p.features & IORING_FEAT_RW_CUR_POS))
+		return false;
+
+	sq_entries = p.sq_entries;
+	sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	cq_size = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		sq_size = cq_size = std::max(sq_size, cq_size);
+
+	sq_ptr = ::mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring_fd, IORING_OFF_SQ_RING);
+	if (sq_ptr == MAP_FAILED)
+		return false;
+
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		cq_ptr = sq_ptr;
+	else {
+		cq_ptr = ::mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				ring_fd, IORING_OFF_CQ_RING);
+		if (cq_ptr == MAP_FAILED)
+			return false;
+	}
+
+	sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+	sqes = static_cast<io_uring_sqe *>(::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+	if (sqes == MAP_FAILED)
+		return false;
+
+	auto sq = static_cast<uint8_t *>(sq_ptr);
+	auto cq = static_cast<uint8_t *>(cq_ptr);
+	sq_head = reinterpret_cast<unsigned *>(sq + p.sq_off.head);
+	sq_tail = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+	sq_mask = reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+	sq_array = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+	cq_head = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+	cq_tail = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+	cq_mask = reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+	cqes = reinterpret_cast<io_uring_cqe *>(cq + p.cq_off.cqes);
+	sq_local_tail = *sq_tail;
+
+	if (!probe())
+		return false;
+
+	efd = ::eventfd(0, EFD_CLOEXEC);
+	if (efd < 0)
+		return false;
+
+	if (fd < 0)
+		return true;	// availability check only
+
+	buffers_size = depth * buffer_size;
+	buffers = static_cast<uint8_t *>(::mmap(nullptr, buffers_size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	if (buffers == MAP_FAILED)
+		return false;
+
+	iovs.resize(depth);
+	msgs.resize(depth);
+	addrs.resize(depth);
+	armed.assign(depth, false);
+	poll_err.assign(depth, 0);
+	for (size_t i = 0; i < depth; i++) {
+		iovs[i].iov_base = buffers + i * buffer_size;
+		iovs[i].iov_len = buffer_size;
+	}
+
+	// pinned once instead of on every read; RLIMIT_MEMLOCK may refuse, plain reads do too
+	if (kind == Kind::stream)
+		fixed = sys_io_uring_register(ring_fd, IORING_REGISTER_BUFFERS, iovs.data(), iovs.size()) == 0;
+
+	return true;
+}
+
+bool UringReader::Ring::probe()
+{
+	const size_t n_ops = 256;
+	std::vector<uint8_t> mem(sizeof(io_uring_probe) + n_ops * sizeof(io_uring_probe_op));
+	auto pr = reinterpret_cast<io_uring_probe *>(mem.data());
+
+	if (sys_io_uring_register(ring_fd, IORING_REGISTER_PROBE, pr, n_ops) < 0)
+		return false;
+
+	for (auto op : { IORING_OP_POLL_ADD, IORING_OP_ASYNC_CANCEL, IORING_OP_READ,
+			IORING_OP_READ_FIXED, IORING_OP_RECVMSG }) {
+		if (op > pr->last_op || !(pr->ops[op].flags & IO_URING_OP_SUPPORTED))
+			return false;
+	}
+
+	return true;
+}
+
+io_uring_sqe *UringReader::Ring::get_sqe(uint64_t user_data)
+{
+	unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+	if (sq_local_tail - head >= sq_entries)
+		return nullptr;
+
+	unsigned idx = sq_local_tail & *sq_mask;
+	io_uring_sqe *sqe = &sqes[idx];
+	std::memset(sqe, 0, sizeof(*sqe));
+	sqe->user_data = user_data;
+	sq_array[idx] = idx;
+	sq_local_tail++;
+	return sqe;
+}
+
+int UringReader::Ring::submit_and_wait(unsigned wait_nr)
+{
+	// the re-armed reads go in with the wait for the next completions
+	__atomic_store_n(sq_tail, sq_local_tail, __ATOMIC_RELEASE);
+	unsigned to_submit = sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+
+	int ret = sys_io_uring_enter(ring_fd, to_submit, wait_nr, IORING_ENTER_GETEVENTS);
+	return (ret < 0) ? -errno : ret;
+}
+
+static uint32_t poll_events(uint32_t events)
+{
+#if __BYTE_ORDER == __BIG_ENDIAN
+	return (events << 16) | (events >> 16);	// poll32_events is word-reversed
+#else
+	return events;
+#endif
+}
+
+bool UringReader::Ring::arm(size_t slot)
+{
+	// wait for data first: asio may have made the fd non-blocking for its writes
+	io_uring_sqe *poll = get_sqe(TAG_POLL | slot);
+	if (poll == nullptr)
+		return false;
+
+	poll->opcode = IORING_OP_POLL_ADD;
+	poll->fd = fd;
+	poll->poll32_events = poll_events(POLLIN);
+	poll->flags = IOSQE_IO_LINK;
+
+	io_uring_sqe *rd = get_sqe(TAG_READ | slot);
+	if (rd == nullptr)
+		return false;
+
+	rd->fd = fd;
+	if (kind == Kind::datagram) {
+		msghdr &msg = msgs[slot];
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_name = &addrs[slot];
+		msg.msg_namelen = sizeof(addrs[slot]);
+		msg.msg_iov = &iovs[slot];
+		msg.msg_iovlen = 1;
+
+		rd->opcode = IORING_OP_RECVMSG;
+		rd->addr = reinterpret_cast<uint64_t>(&msg);
+		rd->len = 1;
+	}
+	else {
+		rd->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+		rd->addr = reinterpret_cast<uint64_t>(iovs[slot].iov_base);
+		rd->len = buffer_size;
+		rd->off = uint64_t(-1);		// current position
+		if (fixed)
+			rd->buf_index = slot;
+	}
+
+	poll_err[slot] = 0;
+	armed[slot] = true;
+	n_armed++;
+	return true;
+}
+
+bool UringReader::Ring::arm_stop()
+{
+	io_uring_sqe *sqe = get_sqe(TAG_STOP);
+	if (sqe == nullptr)
+		return false;
+
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = efd;
+	sqe->poll32_events = poll_events(POLLIN);
+	stop_armed = true;
+	return true;
+}
+
+void UringReader::Ring::cancel(uint64_t user_data)
+{
+	io_uring_sqe *sqe = get_sqe(TAG_CANCEL);
+	if (sqe == nullptr)
+		return;
+
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = user_data;
+}
+
+template<typename Handler>
+void UringReader::Ring::drain(Handler handler)
+{
+	for (;;) {
+		unsigned head = *cq_head;
+		if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+			break;
+
+		// consumed before the handler: a stop() from a callback drains the rest itself
+		io_uring_cqe cqe = cqes[head & *cq_mask];
+		__atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+
+		uint64_t tag = cqe.user_data & TAG_MASK;
+		size_t slot = cqe.user_data & ~TAG_MASK;
+
+		if (tag == TAG_STOP)
+			stop_armed = false;
+		else if (tag == TAG_POLL && slot < depth && cqe.res < 0 && cqe.res != -ECANCELED)
+			poll_err[slot] = -cqe.res;
+		else if (tag == TAG_READ && slot < depth) {
+			armed[slot] = false;
+			n_armed--;
+		}
+
+		handler(tag, slot, cqe.res);
+	}
+}
+
+void UringReader::Ring::serve()
+{
+	// set up here: once a ring goes, the kernel interrupts the thread that made it
+	bool ok = setup();
+
+	std::unique_lock<std::mutex> lock(thread_mutex);
+	setup_done = true;
+	set_up = ok;
+	thread_cv.notify_all();
+	if (!ok)
+		return;
+
+	thread_cv.wait(lock, [this] () { return started || stopping; });
+	if (stopping)
+		return;
+	lock.unlock();
+
+	utils::set_this_thread_name("%s", thread_name.c_str());
+	run();
+}
+
+void UringReader::Ring::run()
+{
+	int err = -1;	// >= 0 once the fd failed, 0 for EOF
+
+	for (size_t slot = 0; slot < depth; slot++)
+		arm(slot);
+	arm_stop();
+
+	while (err < 0 && !stopping) {
+		int ret = submit_and_wait(1);
+		if (ret < 0 && ret != -EINTR && ret != -EBUSY && ret != -EAGAIN) {
+			err = -ret;
+			break;
+		}
+
+		drain([&] (uint64_t tag, size_t slot, int res) {
+				if (tag == TAG_STOP)
+					stopping = true;
+				if (tag != TAG_READ || stopping || err >= 0)
+					return;
+
+				if (res > 0) {
+					auto addr = reinterpret_cast<const sockaddr *>(&addrs.data()[slot]);
+					if (kind == Kind::datagram)
+						recv_cb(static_cast<uint8_t *>(iovs[slot].iov_base), res,
+								addr, msgs[slot].msg_namelen);
+					else
+						recv_cb(static_cast<uint8_t *>(iovs[slot].iov_base), res, nullptr, 0);
+				}
+				else if (res == 0 && kind == Kind::stream)
+					err = 0;			// EOF
+				else if (res == -ECANCELED && poll_err[slot] != 0)
+					err = poll_err[slot];
+				else if (res < 0 && res != -EAGAIN && res != -EINTR && res != -ECANCELED)
+					err = -res;
+
+				// an empty datagram or a spurious wakeup reads again
+				if (err < 0 && !stopping && !arm(slot))
+					err = ENOBUFS;
+			});
+	}
+
+	teardown();
+
+	if (err >= 0 && !stopping && error_cb)
+		error_cb(err);
+}
+
+void UringReader::Ring::teardown()
+{
+	// the buffers may only go once the kernel is done with every read,
+	// run() and stop() from a callback may both get here, the second finds nothing armed
+	for (size_t slot = 0; slot < depth; slot++) {
+		if (armed[slot]) {
+			cancel(TAG_POLL | slot);
+			cancel(TAG_READ | slot);
+		}
+	}
+	if (stop_armed)
+		cancel(TAG_STOP);
+
+	while (n_armed > 0 || stop_armed) {
+		int ret = submit_and_wait(1);
+		if (ret < 0 && ret != -EINTR && ret != -EBUSY && ret != -EAGAIN) {
+			leak_buffers = true;
+			return;
+		}
+
+		drain([] (uint64_t, size_t, int) { });
+	}
+}
+
+
+UringReader::UringReader(std::shared_ptr<Ring> ring_) :
+	ring(std::move(ring_))
+{ }
+
+UringReader::~UringReader()
+{
+	stop();
+
+	// dropped from a callback: the reads are reaped, the loop ends when it returns
+	std::lock_guard<std::mutex> lock(ring->thread_mutex);
+	if (ring->thread.joinable())
+		ring->thread.detach();
+}
+
+bool UringReader::available()
+{
+	static const bool ok = [] () {
+		bool set_up = false;
+
+		// on a thread of its own, like the rings of the readers
+		std::thread([&set_up] () {
+					Ring probe_ring(-1, Kind::stream, 0, 1);
+					set_up = probe_ring.setup();
+				}).join();
+
+		return set_up;
+	}();
+
+	return ok;
+}
+
+std::unique_ptr<UringReader> UringReader::open(int fd, Kind kind, size_t buffer_size)
+{
+	if (!available())
+		return nullptr;
+
+	auto r = std::make_shared<Ring>(fd, kind, buffer_size,
+			(kind == Kind::datagram) ? DATAGRAM_DEPTH : 1);
+
+	// the thread keeps the ring: a callback may drop the last UringReader
+	std::unique_lock<std::mutex> lock(r->thread_mutex);
+	r->thread = std::thread([r] () { r->serve(); });
+	r->thread_cv.wait(lock, [&r] () { return r->setup_done; });
+	if (!r->set_up) {
+		lock.unlock();
+		r->thread.join();
+		return nullptr;
+	}
+
+	return std::unique_ptr<UringReader>(new UringReader(std::move(r)));
+}
+
+void UringReader::start(const std::string &thread_name, RecvCb recv_cb, ErrorCb error_cb)
+{
+	std::lock_guard<std::mutex> lock(ring->thread_mutex);
+	ring->thread_name = thread_name;
+	ring->recv_cb = std::move(recv_cb);
+	ring->error_cb = std::move(error_cb);
+	ring->started = true;
+	ring->thread_cv.notify_all();
+}
+
+void UringReader::stop()
+{
+	ring->stopping = true;
+
+	uint64_t one = 1;
+	ssize_t ret = ::write(ring->efd, &one, sizeof(one));
+	(void) ret;
+
+	std::thread loop;
+	bool from_loop;
+	{
+		std::lock_guard<std::mutex> lock(ring->thread_mutex);
+		from_loop = ring->thread.get_id() == std::this_thread::get_id();
+		if (!from_loop)
+			loop = std::move(ring->thread);
+		ring->thread_cv.notify_all();	// not started yet
+	}
+
+	// from a callback: nothing may stay in flight once the link closes the fd,
+	// the loop ends when the callback returns and a later stop() joins it
+	if (from_loop)
+		ring->teardown();
+	else if (loop.joinable())
+		loop.join();
+}
+
+#else	// !MAVCONN_IO_URING
+
+struct UringReader::Ring {};
+
+UringReader::UringReader(std::shared_ptr<Ring> ring_) :
+	ring(std::move(ring_))
+{ }
+
+UringReader::~UringReader()
+{ }
+
+bool UringReader::available()
+{
+	return false;
+}
+
+std::unique_ptr<UringReader> UringReader::open(int, Kind, size_t)
+{
+	return nullptr;
+}
+
+void UringReader::start(const std::string &, RecvCb, ErrorCb)
+{ }
+
+void UringReader::stop()
+{ }
+
+#endif	// MAVCONN_IO_URING
+}	// namespace mavconn
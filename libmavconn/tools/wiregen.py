@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Generate packed wire layouts for MAVLink messages.
+
+Reads the generated C++ message headers (mavlink/v2.0/<dialect>/mavlink_msg_*.hpp),
+takes field types from the member declarations and wire offsets from the
+"// offset: N" comments in deserialize(), and writes include/mavconn/wire_<dialect>.h
+with one packed struct per message and one lazy view per message.
+
+Usage: tools/wiregen.py [dialect ...]    (default: common)
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+MAVLINK_DIR = os.path.join(ROOT, 'include', 'mavlink', 'include', 'mavlink', 'v2.0')
+OUT_DIR = os.path.join(ROOT, 'include', 'mavconn')
+
+TYPE_SIZE = {
+    'char': 1, 'int8_t': 1, 'uint8_t': 1,
+    'int16_t': 2, 'uint16_t': 2,
+    'int32_t': 4, 'uint32_t': 4, 'float': 4,
+    'int64_t': 8, 'uint64_t': 8, 'double': 8,
+}
+
+RE_CONST = re.compile(r'static constexpr \w+ (MSG_ID|LENGTH|MIN_LENGTH|CRC_EXTRA) = (\d+);')
+RE_NAME = re.compile(r'^struct (\w+) : mavlink::Message', re.M)
+RE_FIELD = re.compile(r'^    (?:std::array<(\w+), (\d+)>|(\w+)) (\w+); /\*<', re.M)
+RE_OFFSET = re.compile(r'map >> (\w+);\s+// offset: (\d+)')
+
+
+class Field(object):
+    def __init__(self, name, type_, array_len, offset):
+        self.name = name
+        self.type = type_
+        self.array_len = array_len
+        self.offset = offset
+
+    @property
+    def size(self):
+        return TYPE_SIZE[self.type] * (self.array_len or 1)
+
+
+class Message(object):
+    def __init__(self, name, consts, fields):
+        self.name = name
+        self.msg_id = consts['MSG_ID']
+        self.length = consts['LENGTH']
+        self.min_length = consts['MIN_LENGTH']
+        self.crc_extra = consts['CRC_EXTRA']
+        self.fields = fields
+
+
+def parse_message(path):
+    with open(path) as fd:
+        text = fd.read()
+
+    name = RE_NAME.search(text).group(1)
+    consts = {k: int(v) for k, v in RE_CONST.findall(text)}
+
+    decls = {}
+    for arr_type, arr_len, type_, fname in RE_FIELD.findall(text):
+        if arr_type:
+            decls[fname] = (arr_type, int(arr_len))
+        else:
+            decls[fname] = (type_, 0)
+
+    fields = []
+    for fname, offset in RE_OFFSET.findall(text):
+        type_, array_len = decls[fname]
+        fields.append(Field(fname, type_, array_len, int(offset)))
+
+    # offsets must tile the payload exactly, otherwise the packed struct is wrong
+    pos = 0
+    for f in fields:
+        if f.offset != pos:
+            raise ValueError("%s.%s: offset %d, expected %d" % (name, f.name, f.offset, pos))
+        pos += f.size
+    if pos != consts['LENGTH']:
+        raise ValueError("%s: fields cover %d bytes, LENGTH is %d" % (name, pos, consts['LENGTH']))
+
+    return Message(name, consts, fields)
+
+
+def parse_dialect(dialect):
+    ddir = os.path.join(MAVLINK_DIR, dialect)
+    msgs = []
+    for fn in sorted(os.listdir(ddir)):
+        if fn.startswith('mavlink_msg_') and fn.endswith('.hpp'):
+            msgs.append(parse_message(os.path.join(ddir, fn)))
+    msgs.sort(key=lambda m: m.msg_id)
+    return msgs
+
+
+def field_decl(f):
+    if f.array_len:
+        return "%s %s[%d];" % (f.type, f.name, f.array_len)
+    return "%s %s;" % (f.type, f.name)
+
+
+def gen_struct(m, out):
+    out.append("/**")
+    out.append(" * @brief %s wire layout" % m.name)
+    out.append(" */")
+    out.append("MAVPACKED(")
+    out.append("struct %s {" % m.name)
+    out.append("\tstatic constexpr mavlink::msgid_t MSG_ID = %d;" % m.msg_id)
+    out.append("\tstatic constexpr size_t LENGTH = %d;" % m.length)
+    out.append("\tstatic constexpr size_t MIN_LENGTH = %d;" % m.min_length)
+    out.append("\tstatic constexpr uint8_t CRC_EXTRA = %d;" % m.crc_extra)
+    out.append("")
+    for f in m.fields:
+        out.append("\t%-40s// offset: %d" % (field_decl(f), f.offset))
+    out.append("});")
+    out.append("static_assert(sizeof(%s) == %s::LENGTH, \"%s wire layout\");" % (m.name, m.name, m.name))
+    out.append("")
+
+
+def gen_view(m, out):
+    out.append("/**")
+    out.append(" * @brief %s lazy view, fields are read from the payload on access" % m.name)
+    out.append(" */")
+    out.append("class %s : public View {" % m.name)
+    out.append("public:")
+    out.append("\tusing Layout = wire::%s::%s;" % ('@DIALECT@', m.name))
+    out.append("\tstatic constexpr mavlink::msgid_t MSG_ID = %d;" % m.msg_id)
+    out.append("")
+    out.append("\texplicit %s(const mavlink::mavlink_message_t *msg) : View(msg) {}" % m.name)
+    out.append("")
+    for f in m.fields:
+        if f.array_len and f.type == 'char':
+            out.append("\tstd::string %s() const { return load_string(%d, %d); }" % (f.name, f.offset, f.array_len))
+        if f.array_len:
+            out.append("\t%s %s(size_t i) const { return load_field<%s>(%d + i * %d); }" % (
+                f.type, f.name, f.type, f.offset, TYPE_SIZE[f.type]))
+        else:
+            out.append("\t%s %s() const { return load_field<%s>(%d); }" % (f.type, f.name, f.type, f.offset))
+    out.append("};")
+    out.append("")
+
+
+def generate(dialect):
+    msgs = parse_dialect(dialect)
+
+    out = []
+    out.append("/**")
+    out.append(" * @brief MAVConn packed wire layouts, %s dialect" % dialect)
+    out.append(" * @file wire_%s.h" % dialect)
+    out.append(" *")
+    out.append(" * @addtogroup mavconn")
+    out.append(" * @{")
+    out.append(" */")
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("// AUTOMATIC GENERATED FILE!")
+    out.append("// from tools/wiregen.py, do not edit")
+    out.append("")
+    out.append("// include through <mavconn/wire.h>")
+    out.append("")
+    out.append("namespace mavconn {")
+    out.append("namespace wire {")
+    out.append("namespace %s {" % dialect)
+    out.append("")
+    for m in msgs:
+        gen_struct(m, out)
+    out.append("namespace view {")
+    out.append("")
+    for m in msgs:
+        vout = []
+        gen_view(m, vout)
+        out.extend(l.replace('@DIALECT@', dialect) for l in vout)
+    out.append("}	// namespace view")
+    out.append("}	// namespace %s" % dialect)
+    out.append("}	// namespace wire")
+    out.append("}	// namespace mavconn")
+
+    path = os.path.join(OUT_DIR, 'wire_%s.h' % dialect)
+    with open(path, 'w') as fd:
+        fd.write('\n'.join(out) + '\n')
+    print("%s: %d messages" % (os.path.relpath(path, ROOT), len(msgs)))
+
+
+def main():
+    for dialect in sys.argv[1:] or ['common']:
+        generate(dialect)
+
+
+if __name__ == '__main__':
+    main()